@@ -0,0 +1,310 @@
+/*********************************************************************
+** Program name: AllocationTracker.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 6:00 AM
+** Description: Class implementation file for AllocationTracker class.
+ *              AllocationTracker counts every heap allocation made
+ *              through operator new, and its bytes, by the day phase
+ *              it was made in (see PhaseTimer) and by its source, set
+ *              with a Scope around the code that allocates. It stays
+ *              off unless enabled. A day's own phases should never
+ *              allocate once a zoo has stopped growing, so any
+ *              allocation in them that is not exhibit growth is
+ *              counted as a stray, and the days with strays are
+ *              counted too, for a test mode that fails on them.
+ *              This file also replaces the global operator new and
+ *              delete, which only call countAllocation on their way
+ *              to malloc and free.
+*********************************************************************/
+
+
+#include "AllocationTracker.hpp"
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+
+//Initialize constants
+const char *const AllocationTracker::SOURCE_NAMES[] =
+        {"other", "makeAnimal", "increaseExhibit", "writeRead",
+         "printAnimalAdded", "ValidateInput"};
+
+//Initialize static members
+bool AllocationTracker::enabled = false;
+std::atomic<int64_t> AllocationTracker::allocations
+        [AllocationTracker::PHASE_SLOTS][AllocationTracker::NUM_SOURCES];
+std::atomic<int64_t> AllocationTracker::bytes
+        [AllocationTracker::PHASE_SLOTS][AllocationTracker::NUM_SOURCES];
+std::atomic<int64_t> AllocationTracker::stray_allocations(0);
+std::atomic<int64_t> AllocationTracker::days(0);
+std::atomic<int64_t> AllocationTracker::allocating_days(0);
+thread_local AllocationTracker::Source AllocationTracker::current_source =
+        AllocationTracker::OTHER;
+thread_local int64_t AllocationTracker::strays_today = 0;
+
+/********************************************************************
+** Function: Scope::Constructor: Makes source this thread's current
+ *           source.
+** Params:   Source source: code about to allocate.
+** Returns:  None
+*********************************************************************/
+AllocationTracker::Scope::Scope(Source source)
+    : outer_source(current_source)
+{
+    current_source = source;
+}
+
+
+/********************************************************************
+** Function: Scope::Destructor: Restores the source it was started in.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+AllocationTracker::Scope::~Scope()
+{
+    current_source = outer_source;
+}
+
+
+/********************************************************************
+** Function: enable: Turns counting on or off. Call it before
+ *           starting threads.
+** Params:   bool on: true to count allocations.
+** Returns:  None
+*********************************************************************/
+void AllocationTracker::enable(bool on)
+{
+    enabled = on;
+}
+
+
+/********************************************************************
+** Function: isEnabled: Returns true if allocations are counted.
+** Params:   None
+** Returns:  bool: true if counting.
+*********************************************************************/
+bool AllocationTracker::isEnabled()
+{
+    return enabled;
+}
+
+
+/********************************************************************
+** Function: countAllocation: Counts one allocation, if counting is
+ *           on. Called by operator new, so it never allocates.
+** Params:   size_t size: bytes asked for.
+** Returns:  None
+*********************************************************************/
+void AllocationTracker::countAllocation(size_t size)
+{
+    if (!enabled)
+    {
+        return;
+    }
+
+    int phase = PhaseTimer::currentPhase();
+    allocations[phase][current_source].fetch_add(1,
+                                                std::memory_order_relaxed);
+    bytes[phase][current_source].fetch_add(static_cast<int64_t>(size),
+                                            std::memory_order_relaxed);
+
+    if (isStray(phase, current_source))
+    {
+        stray_allocations.fetch_add(1, std::memory_order_relaxed);
+        strays_today++;
+    }
+}
+
+
+/********************************************************************
+** Function: dayEnded: Counts the day, and counts it as allocating
+ *           if this thread made a stray allocation since the last
+ *           call. The Zoo calls it at the end of every day.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void AllocationTracker::dayEnded()
+{
+    if (!enabled)
+    {
+        return;
+    }
+
+    days.fetch_add(1, std::memory_order_relaxed);
+    if (strays_today > 0)
+    {
+        allocating_days.fetch_add(1, std::memory_order_relaxed);
+        strays_today = 0;
+    }
+}
+
+
+/********************************************************************
+** Function: getCounts: Returns the allocations made in one phase
+ *           by one source.
+** Params:   PhaseTimer::Phase phase: phase, NUM_PHASES for none.
+ *           Source source: code that allocated.
+** Returns:  Counts: allocations and bytes.
+*********************************************************************/
+AllocationTracker::Counts AllocationTracker::getCounts(
+        PhaseTimer::Phase phase, Source source)
+{
+    Counts counts = {allocations[phase][source].load(),
+                        bytes[phase][source].load()};
+    return counts;
+}
+
+
+/********************************************************************
+** Function: Getters: Return stray allocations, days ended, and
+ *           days with a stray allocation.
+** Params:   None
+** Returns:  int64_t: the count.
+*********************************************************************/
+int64_t AllocationTracker::getStrayAllocations()
+{
+    return stray_allocations.load();
+}
+
+int64_t AllocationTracker::getDays()
+{
+    return days.load();
+}
+
+int64_t AllocationTracker::getAllocatingDays()
+{
+    return allocating_days.load();
+}
+
+
+/********************************************************************
+** Function: reset: Sets every count back to 0.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void AllocationTracker::reset()
+{
+    for (int phase=0; phase<PHASE_SLOTS; phase++)
+    {
+        for (int source=0; source<NUM_SOURCES; source++)
+        {
+            allocations[phase][source].store(0);
+            bytes[phase][source].store(0);
+        }
+    }
+    stray_allocations.store(0);
+    days.store(0);
+    allocating_days.store(0);
+    strays_today = 0;
+}
+
+
+/********************************************************************
+** Function: print: Prints allocations and bytes of every phase and
+ *           source that allocated, then the strays.
+** Params:   std::ostream &out: stream to print to.
+** Returns:  None
+*********************************************************************/
+void AllocationTracker::print(std::ostream &out)
+{
+    const int NAME_WIDTH = 18;
+    const int NUMBER_WIDTH = 14;
+    const char *NO_PHASE = "none";
+
+    out << "Allocations:" << std::endl;
+    out << std::left << std::setw(NAME_WIDTH) << "phase"
+            << std::setw(NAME_WIDTH) << "source" << std::right
+            << std::setw(NUMBER_WIDTH) << "count"
+            << std::setw(NUMBER_WIDTH) << "bytes" << std::endl;
+
+    for (int phase=0; phase<PHASE_SLOTS; phase++)
+    {
+        for (int source=0; source<NUM_SOURCES; source++)
+        {
+            int64_t count = allocations[phase][source].load();
+            if (count == 0)
+            {
+                continue;
+            }
+
+            out << std::left << std::setw(NAME_WIDTH)
+                    << (phase < PhaseTimer::NUM_PHASES
+                        ? PhaseTimer::PHASE_NAMES[phase] : NO_PHASE)
+                    << std::setw(NAME_WIDTH) << SOURCE_NAMES[source]
+                    << std::right << std::setw(NUMBER_WIDTH) << count
+                    << std::setw(NUMBER_WIDTH)
+                    << bytes[phase][source].load() << std::endl;
+        }
+    }
+
+    out << "Stray allocations: " << stray_allocations.load() << " on "
+            << allocating_days.load() << " of " << days.load() << " days"
+            << std::endl;
+}
+
+
+/********************************************************************
+** Function: isStray: Returns true if an allocation should not
+ *           happen on a day the zoo did not grow: made in one of
+ *           the day's own phases, and not by exhibit growth.
+** Params:   int phase: phase it was made in, NUM_PHASES for none.
+ *           Source source: code that made it.
+** Returns:  bool: true if it is a stray.
+*********************************************************************/
+bool AllocationTracker::isStray(int phase, Source source)
+{
+    //printing the day number and autosaving are not part of the day
+    return phase != PhaseTimer::NUM_PHASES
+            && phase != PhaseTimer::DAY_HEADER
+            && phase != PhaseTimer::AUTOSAVE
+            && source != INCREASE_EXHIBIT;
+}
+
+
+/********************************************************************
+** Function: operator new, operator new[]: Count the allocation,
+ *           then allocate it with malloc.
+** Params:   std::size_t size: bytes to allocate.
+** Returns:  void *: the memory. Throws std::bad_alloc if there is
+ *              none, after trying the new handler like the standard
+ *              operator new.
+*********************************************************************/
+void *operator new(std::size_t size)
+{
+    AllocationTracker::countAllocation(size);
+
+    //malloc(0) may return nullptr, new must not
+    void *memory = std::malloc(size ? size : 1);
+    while (!memory)
+    {
+        std::new_handler handler = std::get_new_handler();
+        if (!handler)
+        {
+            throw std::bad_alloc();
+        }
+        handler();
+        memory = std::malloc(size ? size : 1);
+    }
+    return memory;
+}
+
+void *operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+
+/********************************************************************
+** Function: operator delete, operator delete[]: Free memory from
+ *           operator new.
+** Params:   void *memory: memory to free, may be nullptr.
+** Returns:  None
+*********************************************************************/
+void operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void *memory) noexcept
+{
+    std::free(memory);
+}
@@ -0,0 +1,170 @@
+/*********************************************************************
+** Program name: AllocationTracker.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 6:00 AM
+** Description: Class specification file for AllocationTracker class.
+ *              AllocationTracker counts every heap allocation made
+ *              through operator new, and its bytes, by the day phase
+ *              it was made in (see PhaseTimer) and by its source, set
+ *              with a Scope around the code that allocates. It stays
+ *              off unless enabled. A day's own phases should never
+ *              allocate once a zoo has stopped growing, so any
+ *              allocation in them that is not exhibit growth is
+ *              counted as a stray, and the days with strays are
+ *              counted too, for a test mode that fails on them.
+*********************************************************************/
+
+
+#ifndef ALLOCATION_TRACKER_HPP
+#define ALLOCATION_TRACKER_HPP
+
+#include "PhaseTimer.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+class AllocationTracker
+{
+public:
+    //Code that allocates, OTHER for anything not in a Scope
+    enum Source {OTHER, MAKE_ANIMAL, INCREASE_EXHIBIT, WRITE_READ,
+                    PRINT_ANIMAL_ADDED, VALIDATE_INPUT, NUM_SOURCES};
+
+    //Name of each source, in the order of Source
+    static const char *const SOURCE_NAMES[];
+
+    //Allocations made, and the bytes asked for
+    struct Counts
+    {
+        int64_t allocations;
+        int64_t bytes;
+    };
+
+    //Attributes allocations to its source until the end of its block
+    class Scope
+    {
+    private:
+        AllocationTracker::Source outer_source;
+
+    public:
+
+        /****************************************************************
+        ** Function: Constructor: Makes source this thread's current
+         *           source.
+        ** Params:   Source source: code about to allocate.
+        ** Returns:  None
+        *****************************************************************/
+        explicit Scope(Source source);
+
+
+        /****************************************************************
+        ** Function: Destructor: Restores the source it was started in.
+        ** Params:   None
+        ** Returns:  None
+        *****************************************************************/
+        ~Scope();
+    };
+
+private:
+    //Phases, plus one for allocations outside any phase
+    static const int PHASE_SLOTS = PhaseTimer::NUM_PHASES + 1;
+
+    static bool enabled;
+    static std::atomic<int64_t> allocations[PHASE_SLOTS][NUM_SOURCES];
+    static std::atomic<int64_t> bytes[PHASE_SLOTS][NUM_SOURCES];
+    static std::atomic<int64_t> stray_allocations;
+    static std::atomic<int64_t> days;
+    static std::atomic<int64_t> allocating_days;
+    static thread_local Source current_source;
+    static thread_local int64_t strays_today;
+
+public:
+
+    /********************************************************************
+    ** Function: enable: Turns counting on or off. Call it before
+     *           starting threads.
+    ** Params:   bool on: true to count allocations.
+    ** Returns:  None
+    *********************************************************************/
+    static void enable(bool on = true);
+
+
+    /********************************************************************
+    ** Function: isEnabled: Returns true if allocations are counted.
+    ** Params:   None
+    ** Returns:  bool: true if counting.
+    *********************************************************************/
+    static bool isEnabled();
+
+
+    /********************************************************************
+    ** Function: countAllocation: Counts one allocation, if counting is
+     *           on. Called by operator new, so it never allocates.
+    ** Params:   size_t size: bytes asked for.
+    ** Returns:  None
+    *********************************************************************/
+    static void countAllocation(size_t size);
+
+
+    /********************************************************************
+    ** Function: dayEnded: Counts the day, and counts it as allocating
+     *           if this thread made a stray allocation since the last
+     *           call. The Zoo calls it at the end of every day.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    static void dayEnded();
+
+
+    /********************************************************************
+    ** Function: getCounts: Returns the allocations made in one phase
+     *           by one source.
+    ** Params:   PhaseTimer::Phase phase: phase, NUM_PHASES for none.
+     *           Source source: code that allocated.
+    ** Returns:  Counts: allocations and bytes.
+    *********************************************************************/
+    static Counts getCounts(PhaseTimer::Phase phase, Source source);
+
+
+    /********************************************************************
+    ** Function: Getters: Return stray allocations, days ended, and
+     *           days with a stray allocation.
+    ** Params:   None
+    ** Returns:  int64_t: the count.
+    *********************************************************************/
+    static int64_t getStrayAllocations();
+    static int64_t getDays();
+    static int64_t getAllocatingDays();
+
+
+    /********************************************************************
+    ** Function: reset: Sets every count back to 0.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    static void reset();
+
+
+    /********************************************************************
+    ** Function: print: Prints allocations and bytes of every phase and
+     *           source that allocated, then the strays.
+    ** Params:   std::ostream &out: stream to print to.
+    ** Returns:  None
+    *********************************************************************/
+    static void print(std::ostream &out = std::cout);
+
+private:
+
+    /********************************************************************
+    ** Function: isStray: Returns true if an allocation should not
+     *           happen on a day the zoo did not grow: made in one of
+     *           the day's own phases, and not by exhibit growth.
+    ** Params:   int phase: phase it was made in, NUM_PHASES for none.
+     *           Source source: code that made it.
+    ** Returns:  bool: true if it is a stray.
+    *********************************************************************/
+    static bool isStray(int phase, Source source);
+};
+
+#endif
@@ -12,26 +12,35 @@
  *              getting its age, cost, number of babies, base food
  *              cost, payoff, incrementing its age, and determine if
  *              they are an adult. This is an abstract base class.
+ *              An Animal is a thin wrapper for callers of this class
+ *              API: it holds the AnimalRecord a Zoo keeps in its
+ *              exhibits, and reads the rest of its traits from its
+ *              species' entry in the species registry. Both can be
+ *              read back, so an Animal can be built from, and turned
+ *              into, what the Zoo stores.
 *********************************************************************/
 
 
 #include "Animal.hpp"
 
-//Initialize base_food_cost constant to 10
-const int Animal::base_food_cost = 10;
+/********************************************************************
+** Function: Constructor: Initializes species and age.
+** Params:   SpeciesId species: registry ID of the animal's traits.
+ *           int age: age of animal
+ *           default = 0;
+** Returns:  None
+*********************************************************************/
+Animal::Animal(SpeciesId species, int age)
+    : record(species, age)
+{}
+
 
 /********************************************************************
-** Function: Constructor/default: Initializes age, cost, num_babies,
- *          and payoff to 0, if they are not passed as arguments.
-** Params:   int age: age of animal
- *           int cost: purchase cost of animal
- *           int num_babies: number of babies this animal produces.
- *           double payoff: profit this animal generates.
- *           defaults for all = 0;
+** Function: Constructor: Wraps a record a Zoo keeps in its exhibits.
+** Params:   const AnimalRecord &record: species ID and age.
 ** Returns:  None
 *********************************************************************/
-Animal::Animal(int age, int cost, int num_babies, double payoff)
-    : age(age), cost(cost), num_babies(num_babies), payoff(payoff)
+Animal::Animal(const AnimalRecord &record) : record(record)
 {}
 
 
@@ -52,7 +61,7 @@ Animal::~Animal()
 *********************************************************************/
 void Animal::incrementAge()
 {
-    age++;
+    record.incrementAge();
 }
 
 
@@ -64,7 +73,7 @@ void Animal::incrementAge()
 *********************************************************************/
 bool Animal::isAdult() const
 {
-    return age > 2;
+    return record.isAdult();
 }
 
 
@@ -75,7 +84,42 @@ bool Animal::isAdult() const
 *********************************************************************/
 int Animal::getAge() const
 {
-    return age;
+    return record.getAge();
+}
+
+
+/********************************************************************
+** Function: getSpecies: Returns registry ID of animal's traits.
+** Params:   None
+** Returns:  SpeciesId species.
+*********************************************************************/
+SpeciesId Animal::getSpecies() const
+{
+    return record.getSpecies();
+}
+
+
+/********************************************************************
+** Function: getRecord: Returns the record a Zoo would store for
+ *              this animal.
+** Params:   None
+** Returns:  const AnimalRecord &record.
+*********************************************************************/
+const AnimalRecord &Animal::getRecord() const
+{
+    return record;
+}
+
+
+/********************************************************************
+** Function: getTraits: Returns the traits the animal shares with
+ *              its species, from the species registry.
+** Params:   None
+** Returns:  const SpeciesRegistry::Species &: registry entry.
+*********************************************************************/
+const SpeciesRegistry::Species &Animal::getTraits() const
+{
+    return SpeciesRegistry::get(record.getSpecies());
 }
 
 
@@ -86,7 +130,7 @@ int Animal::getAge() const
 *********************************************************************/
 int Animal::getCost() const
 {
-    return cost;
+    return getTraits().cost;
 }
 
 
@@ -97,7 +141,7 @@ int Animal::getCost() const
 *********************************************************************/
 int Animal::getNumBabies() const
 {
-    return num_babies;
+    return getTraits().num_babies;
 }
 
 
@@ -106,9 +150,9 @@ int Animal::getNumBabies() const
 ** Params:   None
 ** Returns:  int base_food_cost.
 *********************************************************************/
-int Animal::getBaseFoodCost() const
+int Animal::getBaseFoodCost()
 {
-    return base_food_cost;
+    return AnimalConstants::BASE_FOOD_COST;
 }
 
 
@@ -119,5 +163,5 @@ int Animal::getBaseFoodCost() const
 *********************************************************************/
 double Animal::getPayoff() const
 {
-    return payoff;
+    return getTraits().payoff;
 }
@@ -12,6 +12,12 @@
  *              getting its age, cost, number of babies, base food
  *              cost, payoff, incrementing its age, and determine if
  *              they are an adult. This is an abstract base class.
+ *              An Animal is a thin wrapper for callers of this class
+ *              API: it holds the AnimalRecord a Zoo keeps in its
+ *              exhibits, and reads the rest of its traits from its
+ *              species' entry in the species registry. Both can be
+ *              read back, so an Animal can be built from, and turned
+ *              into, what the Zoo stores.
 *********************************************************************/
 
 
@@ -19,31 +25,33 @@
 #define ANIMAL_HPP
 
 #include "AnimalConstants.hpp"
+#include "AnimalRecord.hpp"
+#include "SpeciesRegistry.hpp"
 #include <string>
 
 class Animal
 {
 protected:
-    int age;
-    int cost;
-    int num_babies;
-    double payoff;
-    static const int base_food_cost;
+    AnimalRecord record;
 
 public:
 
     /********************************************************************
-    ** Function: Constructor/default: Initializes age, cost, num_babies,
-     *          and payoff to 0, if they are not passed as arguments.
-    ** Params:   int age: age of animal
-     *           int cost: purchase cost of animal
-     *           int num_babies: number of babies this animal produces.
-     *           double payoff: profit this animal generates.
-     *           defaults for all = 0;
+    ** Function: Constructor: Initializes species and age.
+    ** Params:   SpeciesId species: registry ID of the animal's traits.
+     *           int age: age of animal
+     *           default = 0;
     ** Returns:  None
     *********************************************************************/
-    Animal(int age = ZERO, int cost = ZERO,
-            int num_babies = ZERO, double payoff = ZERO);
+    Animal(SpeciesId species, int age = ZERO);
+
+
+    /********************************************************************
+    ** Function: Constructor: Wraps a record a Zoo keeps in its exhibits.
+    ** Params:   const AnimalRecord &record: species ID and age.
+    ** Returns:  None
+    *********************************************************************/
+    explicit Animal(const AnimalRecord &record);
 
 
     /********************************************************************
@@ -80,6 +88,32 @@ public:
     int getAge() const;
 
 
+    /********************************************************************
+    ** Function: getSpecies: Returns registry ID of animal's traits.
+    ** Params:   None
+    ** Returns:  SpeciesId species.
+    *********************************************************************/
+    SpeciesId getSpecies() const;
+
+
+    /********************************************************************
+    ** Function: getRecord: Returns the record a Zoo would store for
+     *              this animal.
+    ** Params:   None
+    ** Returns:  const AnimalRecord &record.
+    *********************************************************************/
+    const AnimalRecord &getRecord() const;
+
+
+    /********************************************************************
+    ** Function: getTraits: Returns the traits the animal shares with
+     *              its species, from the species registry.
+    ** Params:   None
+    ** Returns:  const SpeciesRegistry::Species &: registry entry.
+    *********************************************************************/
+    const SpeciesRegistry::Species &getTraits() const;
+
+
     /********************************************************************
     ** Function: getCost: Returns cost of animal.
     ** Params:   None
@@ -101,7 +135,7 @@ public:
     ** Params:   None
     ** Returns:  int base_food_cost.
     *********************************************************************/
-    int getBaseFoodCost() const;
+    static int getBaseFoodCost();
 
 
     /********************************************************************
@@ -115,9 +149,10 @@ public:
     /********************************************************************
     ** Function: getName: Returns name of animal. Pure virtual function.
     ** Params:   None
-    ** Returns:  string name: name of animal.
+    ** Returns:  const string &name: name of animal, shared by its
+     *              species.
     *********************************************************************/
-    virtual std::string getName() const = 0;
+    virtual const std::string &getName() const = 0;
 
 
     /********************************************************************
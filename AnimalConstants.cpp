@@ -6,8 +6,9 @@
 ** Description: Class implementation file for AnimalConstants class.
  *              This helper class was designed to create a
  *              lookup table of constant default values and
- *              configurations for Animal class and its derived
- *              classes. It also holds an enum for AnimalTypes, and
+ *              configurations for each species of animal, and the
+ *              base food cost every feeding cost is a multiple of.
+ *              It also holds an enum for AnimalTypes, and
  *              a constant for the value zero (0). This header file
  *              defines typedefs to alias the access of these values
  *              more easily.
@@ -19,6 +20,8 @@
 //Initialize static constants
 const int AnimalConstants::ZERO = 0;
 const int AnimalConstants::DEFAULTS_SIZE = 4;
+//Daily feeding cost of an animal with food cost multiplier 1
+const int AnimalConstants::BASE_FOOD_COST = 10;
 
 //Initialize alias to defaults array
 const AnimalConstants::Animal *DEFAULTS = AnimalConstants::defaults;
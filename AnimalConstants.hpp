@@ -6,8 +6,9 @@
 ** Description: Class specification file for AnimalConstants class.
  *              This helper class was designed to create a
  *              lookup table of constant default values and
- *              configurations for Animal class and its derived
- *              classes. It also holds an enum for AnimalTypes, and
+ *              configurations for each species of animal, and the
+ *              base food cost every feeding cost is a multiple of.
+ *              It also holds an enum for AnimalTypes, and
  *              a constant for the value zero (0). This header file
  *              defines typedefs to alias the access of these values
  *              more easily.
@@ -24,6 +25,7 @@ class AnimalConstants
 public:
     static const int ZERO;
     static const int DEFAULTS_SIZE;
+    static const int BASE_FOOD_COST;
 
     enum AnimalType
     {
@@ -52,6 +54,9 @@ public:
 //Typedef for easy aliasing in other modules
 typedef AnimalConstants::AnimalType AnimalType;
 
+//Dense index of a species in the species registry
+typedef int SpeciesId;
+
 //Alias to constant numbers
 const int ZERO = AnimalConstants::ZERO;
 const int EXHIBITS_SIZE = AnimalConstants::DEFAULTS_SIZE;
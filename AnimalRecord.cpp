@@ -0,0 +1,145 @@
+/*********************************************************************
+** Program name: AnimalRecord.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 12:30 AM
+** Description: Class implementation file for AnimalRecord class.
+ *              AnimalRecord is the compact form of an animal that a
+ *              Zoo keeps in its exhibits: a species ID and an age,
+ *              16 bits each and 4 bytes in all, with no virtual table
+ *              and no heap allocation of its own. Ages stop at
+ *              MAX_AGE, 179 years, and an exhibit too big to scan is
+ *              kept as age cohorts with exact ages instead. Records are stored inline in
+ *              exhibit arrays. Everything else about the animal is
+ *              read from the species registry. It offers the same
+ *              functions as Animal, without being one, and an Animal
+ *              wraps one for callers of the Animal class API.
+*********************************************************************/
+
+
+#include "AnimalRecord.hpp"
+#include "SpeciesRegistry.hpp"
+#include <algorithm>
+
+//Records are packed into exhibit arrays, keep them small
+static_assert(sizeof(AnimalRecord) == 4, "AnimalRecord must be 4 bytes");
+
+//Initialize constants
+const int AnimalRecord::MAX_AGE = UINT16_MAX;
+
+/********************************************************************
+** Function: Constructor/default: Initializes species and age, an
+ *           age past MAX_AGE is held at MAX_AGE.
+** Params:   SpeciesId species: registry ID of the animal's traits.
+ *              default = 0;
+ *           int age: age of animal.
+ *              default = 0;
+** Returns:  None
+*********************************************************************/
+AnimalRecord::AnimalRecord(SpeciesId species, int age)
+    : species(static_cast<uint16_t>(species)),
+        age(static_cast<uint16_t>(std::min(age, MAX_AGE)))
+{}
+
+
+/********************************************************************
+** Function: incrementAge: Increases age of animal by 1, unless it
+ *           is already MAX_AGE.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void AnimalRecord::incrementAge()
+{
+    if (age < MAX_AGE)
+    {
+        age++;
+    }
+}
+
+
+/********************************************************************
+** Function: isAdult: Returns true if age is 3 or more,
+ *          false otherwise.
+** Params:   None
+** Returns:  Boolean: True if age is 3 or greater, false otherwise.
+*********************************************************************/
+bool AnimalRecord::isAdult() const
+{
+    return age > 2;
+}
+
+
+/********************************************************************
+** Function: getAge: Returns age of animal.
+** Params:   None
+** Returns:  int age.
+*********************************************************************/
+int AnimalRecord::getAge() const
+{
+    return age;
+}
+
+
+/********************************************************************
+** Function: getSpecies: Returns registry ID of animal's traits.
+** Params:   None
+** Returns:  SpeciesId species.
+*********************************************************************/
+SpeciesId AnimalRecord::getSpecies() const
+{
+    return species;
+}
+
+
+/********************************************************************
+** Function: getName: Returns name of animal's species.
+** Params:   None
+** Returns:  const string &name.
+*********************************************************************/
+const std::string &AnimalRecord::getName() const
+{
+    return SpeciesRegistry::get(species).name;
+}
+
+
+/********************************************************************
+** Function: getCost: Returns cost of animal.
+** Params:   None
+** Returns:  int cost.
+*********************************************************************/
+int AnimalRecord::getCost() const
+{
+    return SpeciesRegistry::get(species).cost;
+}
+
+
+/********************************************************************
+** Function: getNumBabies: Returns num_babies of animal.
+** Params:   None
+** Returns:  int num_babies.
+*********************************************************************/
+int AnimalRecord::getNumBabies() const
+{
+    return SpeciesRegistry::get(species).num_babies;
+}
+
+
+/********************************************************************
+** Function: getFeedingCost: Returns feeding cost of animal.
+** Params:   None
+** Returns:  double feeding_cost.
+*********************************************************************/
+double AnimalRecord::getFeedingCost() const
+{
+    return SpeciesRegistry::get(species).feeding_cost;
+}
+
+
+/********************************************************************
+** Function: getPayoff: Returns payoff of animal.
+** Params:   None
+** Returns:  double payoff.
+*********************************************************************/
+double AnimalRecord::getPayoff() const
+{
+    return SpeciesRegistry::get(species).payoff;
+}
@@ -0,0 +1,124 @@
+/*********************************************************************
+** Program name: AnimalRecord.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 12:30 AM
+** Description: Class specification file for AnimalRecord class.
+ *              AnimalRecord is the compact form of an animal that a
+ *              Zoo keeps in its exhibits: a species ID and an age,
+ *              16 bits each and 4 bytes in all, with no virtual table
+ *              and no heap allocation of its own. Ages stop at
+ *              MAX_AGE, 179 years, and an exhibit too big to scan is
+ *              kept as age cohorts with exact ages instead. Records are stored inline in
+ *              exhibit arrays. Everything else about the animal is
+ *              read from the species registry. It offers the same
+ *              functions as Animal, without being one, and an Animal
+ *              wraps one for callers of the Animal class API.
+*********************************************************************/
+
+
+#ifndef ANIMAL_RECORD_HPP
+#define ANIMAL_RECORD_HPP
+
+#include "AnimalConstants.hpp"
+#include <cstdint>
+#include <string>
+
+class AnimalRecord
+{
+public:
+    //Oldest age a record holds, older animals stay this age
+    static const int MAX_AGE;
+
+private:
+    uint16_t species;   //registry ID, below SpeciesRegistry::MAX_IDS
+    uint16_t age;       //age in days, up to MAX_AGE
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor/default: Initializes species and age, an
+     *           age past MAX_AGE is held at MAX_AGE.
+    ** Params:   SpeciesId species: registry ID of the animal's traits.
+     *              default = 0;
+     *           int age: age of animal.
+     *              default = 0;
+    ** Returns:  None
+    *********************************************************************/
+    AnimalRecord(SpeciesId species = ZERO, int age = ZERO);
+
+
+    /********************************************************************
+    ** Function: incrementAge: Increases age of animal by 1, unless it
+     *           is already MAX_AGE.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void incrementAge();
+
+
+    /********************************************************************
+    ** Function: isAdult: Returns true if age is 3 or more,
+     *          false otherwise.
+    ** Params:   None
+    ** Returns:  Boolean: True if age is 3 or greater, false otherwise.
+    *********************************************************************/
+    bool isAdult() const;
+
+
+    /********************************************************************
+    ** Function: getAge: Returns age of animal.
+    ** Params:   None
+    ** Returns:  int age.
+    *********************************************************************/
+    int getAge() const;
+
+
+    /********************************************************************
+    ** Function: getSpecies: Returns registry ID of animal's traits.
+    ** Params:   None
+    ** Returns:  SpeciesId species.
+    *********************************************************************/
+    SpeciesId getSpecies() const;
+
+
+    /********************************************************************
+    ** Function: getName: Returns name of animal's species.
+    ** Params:   None
+    ** Returns:  const string &name.
+    *********************************************************************/
+    const std::string &getName() const;
+
+
+    /********************************************************************
+    ** Function: getCost: Returns cost of animal.
+    ** Params:   None
+    ** Returns:  int cost.
+    *********************************************************************/
+    int getCost() const;
+
+
+    /********************************************************************
+    ** Function: getNumBabies: Returns num_babies of animal.
+    ** Params:   None
+    ** Returns:  int num_babies.
+    *********************************************************************/
+    int getNumBabies() const;
+
+
+    /********************************************************************
+    ** Function: getFeedingCost: Returns feeding cost of animal.
+    ** Params:   None
+    ** Returns:  double feeding_cost.
+    *********************************************************************/
+    double getFeedingCost() const;
+
+
+    /********************************************************************
+    ** Function: getPayoff: Returns payoff of animal.
+    ** Params:   None
+    ** Returns:  double payoff.
+    *********************************************************************/
+    double getPayoff() const;
+};
+
+#endif
@@ -0,0 +1,265 @@
+/*********************************************************************
+** Program name: Autosaver.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 18, 2026 at 10:20 PM
+** Description: Class implementation file for Autosaver class.
+ *              Autosaver saves a snapshot of a Zoo every few days
+ *              without making the game wait for the disk. It
+ *              fork()s the process, and the child writes the snapshot
+ *              from its copy-on-write copy of the zoo while the
+ *              parent keeps playing, so the game only pauses for the
+ *              fork. Other threads may hold locks, such as malloc's,
+ *              when the process forks, so the child formats the
+ *              snapshot with a SnapshotWriter whose buffer was
+ *              allocated beforehand, only makes system calls, and
+ *              never allocates. Autosaver keeps stats on how long
+ *              the game was paused and how fast the snapshots were
+ *              written.
+*********************************************************************/
+
+
+#include "Autosaver.hpp"
+#include "Zoo.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+using std::cout;
+using std::endl;
+using std::string;
+
+typedef std::chrono::steady_clock Clock;
+
+//Initialize constants
+const int Autosaver::EVERY_DAYS_DEFAULT = 10;
+
+//Permissions of a new snapshot file, before the umask
+static const mode_t SNAPSHOT_MODE = 0644;
+
+/********************************************************************
+** Function: Constructor: Sets up autosaves to file every
+ *           every_days days.
+** Params:   const string &file: snapshot file, replaced each save.
+ *           int every_days: days between saves.
+** Returns:  None
+*********************************************************************/
+Autosaver::Autosaver(const string &file, int every_days)
+    : file(file), temp_file(file + ".tmp"), every_days(every_days),
+        child(-1), child_pipe(-1)
+{
+    stats.saves = 0;
+    stats.failed = 0;
+    stats.skipped = 0;
+    stats.total_pause_ns = 0;
+    stats.max_pause_ns = 0;
+    stats.total_bytes = 0;
+    stats.total_write_ns = 0;
+}
+
+
+/********************************************************************
+** Function: Destructor: Waits for a save still being written.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+Autosaver::~Autosaver()
+{
+    finish();
+}
+
+
+/********************************************************************
+** Function: dayEnded: Called at the end of every day. Collects any
+ *           finished save, and starts a new one if it is time and
+ *           the last one is done.
+** Params:   const Zoo &zoo: zoo to save.
+ *           int day: day that just ended.
+** Returns:  bool: true if a new save was started.
+*********************************************************************/
+bool Autosaver::dayEnded(const Zoo &zoo, int day)
+{
+    collect(false);
+
+    if (every_days < 1 || day % every_days != 0)
+    {
+        return false;
+    }
+
+    //never let saves pile up behind a slow disk
+    if (child != -1)
+    {
+        stats.skipped++;
+        return false;
+    }
+
+    return startSave(zoo);
+}
+
+
+/********************************************************************
+** Function: finish: Waits for a save still being written and
+ *           collects its report.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void Autosaver::finish()
+{
+    collect(true);
+}
+
+
+/********************************************************************
+** Function: getStats: Returns totals over every autosave so far.
+** Params:   None
+** Returns:  const Stats &: the totals.
+*********************************************************************/
+const Autosaver::Stats &Autosaver::getStats() const
+{
+    return stats;
+}
+
+
+/********************************************************************
+** Function: printStats: Prints number of saves, mean and max pause,
+ *           and snapshot throughput.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void Autosaver::printStats() const
+{
+    const double NS_PER_US = 1000.0;
+    const double NS_PER_S = 1e9;
+    const double BYTES_PER_MB = 1024.0 * 1024.0;
+    int started = stats.saves + stats.failed;
+
+    cout << "Autosaves: " << stats.saves << " written, " << stats.failed
+            << " failed, " << stats.skipped << " skipped" << endl;
+    if (started == 0)
+    {
+        return;
+    }
+
+    cout << std::fixed << std::setprecision(2);
+    cout << "Autosave pause: mean "
+            << stats.total_pause_ns / NS_PER_US / started << " us, max "
+            << stats.max_pause_ns / NS_PER_US << " us" << endl;
+
+    if (stats.total_write_ns > 0)
+    {
+        cout << "Autosave throughput: "
+                << stats.total_bytes / BYTES_PER_MB
+                    / (stats.total_write_ns / NS_PER_S)
+                << " MB/s (" << stats.total_bytes << " bytes)" << endl;
+    }
+}
+
+
+/********************************************************************
+** Function: startSave: Forks a child that writes the snapshot
+ *           of its copy of the zoo to a temporary file, renames it
+ *           over file, reports bytes and time through a pipe, then
+ *           exits.
+** Params:   const Zoo &zoo: zoo to save.
+** Returns:  bool: true if the child was started.
+*********************************************************************/
+bool Autosaver::startSave(const Zoo &zoo)
+{
+    int fds[2];
+    if (pipe(fds) != 0)
+    {
+        stats.failed++;
+        return false;
+    }
+
+    //the pause is only as long as fork() takes to return, the child
+    // formats the snapshot and the disk is left to it
+    Clock::time_point pause_start = Clock::now();
+    pid_t pid = fork();
+    long long pause_ns = std::chrono::duration_cast<std::chrono::nanoseconds>
+            (Clock::now() - pause_start).count();
+
+    if (pid == 0)
+    {
+        //child: write the zoo as it was at the fork, report, and leave
+        // without running destructors or flushing the parent's buffers.
+        // Only system calls and the writer's buffer from here, another
+        // thread may have held malloc's lock
+        close(fds[0]);
+
+        Clock::time_point write_start = Clock::now();
+        ChildReport report;
+        int fd = open(temp_file.c_str(), O_WRONLY | O_CREAT | O_TRUNC,
+                        SNAPSHOT_MODE);
+        writer.start(fd);
+        zoo.writeSnapshot(writer);
+        report.bytes = writer.finish();
+
+        if (fd < 0 || close(fd) != 0 || report.bytes < 0
+                || rename(temp_file.c_str(), file.c_str()) != 0)
+        {
+            report.bytes = -1;
+        }
+        report.write_ns = std::chrono::duration_cast<std::chrono::nanoseconds>
+                (Clock::now() - write_start).count();
+
+        ssize_t written = write(fds[1], &report, sizeof(report));
+        close(fds[1]);
+        _exit(report.bytes >= 0 && written == sizeof(report) ? 0 : 1);
+    }
+
+    close(fds[1]);
+    if (pid < 0)
+    {
+        close(fds[0]);
+        stats.failed++;
+        return false;
+    }
+
+    child = pid;
+    child_pipe = fds[0];
+
+    stats.total_pause_ns += pause_ns;
+    stats.max_pause_ns = std::max(stats.max_pause_ns, pause_ns);
+    return true;
+}
+
+
+/********************************************************************
+** Function: collect: Reaps the child if it has exited and adds its
+ *           report to stats.
+** Params:   bool wait: if true, blocks until the child exits.
+** Returns:  None
+*********************************************************************/
+void Autosaver::collect(bool wait)
+{
+    if (child == -1)
+    {
+        return;
+    }
+
+    int status;
+    if (waitpid(child, &status, wait ? 0 : WNOHANG) != child)
+    {
+        return;     //still writing
+    }
+
+    ChildReport report;
+    if (read(child_pipe, &report, sizeof(report)) == sizeof(report)
+            && report.bytes >= 0)
+    {
+        stats.saves++;
+        stats.total_bytes += report.bytes;
+        stats.total_write_ns += report.write_ns;
+    }
+    else
+    {
+        stats.failed++;
+    }
+
+    close(child_pipe);
+    child_pipe = -1;
+    child = -1;
+}
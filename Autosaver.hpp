@@ -0,0 +1,147 @@
+/*********************************************************************
+** Program name: Autosaver.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 18, 2026 at 10:20 PM
+** Description: Class specification file for Autosaver class.
+ *              Autosaver saves a snapshot of a Zoo every few days
+ *              without making the game wait for the disk. It
+ *              fork()s the process, and the child writes the snapshot
+ *              from its copy-on-write copy of the zoo while the
+ *              parent keeps playing, so the game only pauses for the
+ *              fork. Other threads may hold locks, such as malloc's,
+ *              when the process forks, so the child formats the
+ *              snapshot with a SnapshotWriter whose buffer was
+ *              allocated beforehand, only makes system calls, and
+ *              never allocates. Autosaver keeps stats on how long
+ *              the game was paused and how fast the snapshots were
+ *              written.
+*********************************************************************/
+
+
+#ifndef AUTOSAVER_HPP
+#define AUTOSAVER_HPP
+
+#include "SnapshotWriter.hpp"
+#include <string>
+#include <sys/types.h>
+
+class Zoo;
+
+class Autosaver
+{
+public:
+    //Totals over every autosave so far
+    struct Stats
+    {
+        int saves;                  //snapshots written
+        int failed;                 //snapshots that could not be written
+        int skipped;                //saves skipped, last one still running
+        long long total_pause_ns;   //time the game waited on fork()
+        long long max_pause_ns;
+        long long total_bytes;      //bytes written by all snapshots
+        long long total_write_ns;   //time the children spent writing
+    };
+
+    //Default days between saves
+    static const int EVERY_DAYS_DEFAULT;
+
+private:
+    //What a finished child reports back through its pipe
+    struct ChildReport
+    {
+        long long bytes;
+        long long write_ns;
+    };
+
+    std::string file;
+    std::string temp_file;      //written first, then renamed over file
+    int every_days;
+
+    //Formats snapshots in the child, its buffer allocated up front
+    SnapshotWriter writer;
+
+    //Save still being written, -1 if none
+    pid_t child;
+    int child_pipe;
+
+    Stats stats;
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor: Sets up autosaves to file every
+     *           every_days days.
+    ** Params:   const string &file: snapshot file, replaced each save.
+     *           int every_days: days between saves.
+    ** Returns:  None
+    *********************************************************************/
+    Autosaver(const std::string &file, int every_days);
+
+
+    /********************************************************************
+    ** Function: Destructor: Waits for a save still being written.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    ~Autosaver();
+
+
+    /********************************************************************
+    ** Function: dayEnded: Called at the end of every day. Collects any
+     *           finished save, and starts a new one if it is time and
+     *           the last one is done.
+    ** Params:   const Zoo &zoo: zoo to save.
+     *           int day: day that just ended.
+    ** Returns:  bool: true if a new save was started.
+    *********************************************************************/
+    bool dayEnded(const Zoo &zoo, int day);
+
+
+    /********************************************************************
+    ** Function: finish: Waits for a save still being written and
+     *           collects its report.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void finish();
+
+
+    /********************************************************************
+    ** Function: getStats: Returns totals over every autosave so far.
+    ** Params:   None
+    ** Returns:  const Stats &: the totals.
+    *********************************************************************/
+    const Stats &getStats() const;
+
+
+    /********************************************************************
+    ** Function: printStats: Prints number of saves, mean and max pause,
+     *           and snapshot throughput.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void printStats() const;
+
+private:
+
+    /********************************************************************
+    ** Function: startSave: Forks a child that writes the snapshot
+     *           of its copy of the zoo to a temporary file, renames it
+     *           over file, reports bytes and time through a pipe, then
+     *           exits.
+    ** Params:   const Zoo &zoo: zoo to save.
+    ** Returns:  bool: true if the child was started.
+    *********************************************************************/
+    bool startSave(const Zoo &zoo);
+
+
+    /********************************************************************
+    ** Function: collect: Reaps the child if it has exited and adds its
+     *           report to stats.
+    ** Params:   bool wait: if true, blocks until the child exits.
+    ** Returns:  None
+    *********************************************************************/
+    void collect(bool wait);
+};
+
+#endif
@@ -0,0 +1,898 @@
+/*********************************************************************
+** Program name: Benchmark.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 4:00 AM
+** Description: Class implementation file for Benchmark class. A
+ *              Benchmark times the Zoo's hot paths on headless zoos
+ *              of 10, 100, ... animals, up to a maximum population:
+ *              adding animals (addToExhibit and increaseExhibit),
+ *              removeAnimal, increaseAnimalsAge, feedAllAnimals,
+ *              calculateAnimalProfits, writeRead, and
+ *              MyRandom::randomInteger, plus whole days of the day
+ *              loop and of the daily passes on exhibits of
+ *              GIANT_EXHIBIT_SIZE animals. The suite can be repeated, keeping each
+ *              repetition's time per operation as a sample. Each
+ *              result is reported as nanoseconds per operation and
+ *              animals per second, in a table and as JSON, with
+ *              hardware counts per operation when PerfCounters can be
+ *              opened. An operation of a daily pass is a record it
+ *              visits, an age cohort or exhibit, not an animal. The
+ *              population, ages and bank account the ops leave are
+ *              checked, and wrong totals counted. The JSON can be
+ *              read back as a baseline, see RegressionGate.
+*********************************************************************/
+
+
+#include "Benchmark.hpp"
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <fstream>
+#include <algorithm>
+#include <chrono>
+
+using std::cout;
+using std::endl;
+using std::string;
+using std::vector;
+
+//Initialize constants
+const int64_t Benchmark::MAX_POPULATION_DEFAULT = 100000000;
+const double Benchmark::MIN_SECONDS = 0.2;
+const int Benchmark::DAY_LOOP_DAYS = 365;
+const int64_t Benchmark::GIANT_EXHIBIT_SIZE = 1000000000;
+
+//Seed of every benchmarked zoo, so runs time the same work
+static const unsigned int BENCH_SEED = 1;
+//Operations between two clock reads, so reading the clock is noise
+static const int64_t OPS_PER_BATCH = 100000;
+//Exhibits the animals are spread over
+static const SpeciesId BENCH_TYPES[] = {TIGER, PENGUIN, TURTLE};
+static const int BENCH_TYPES_SIZE = 3;
+
+/********************************************************************
+** Function: secondsSince: Returns seconds elapsed since start.
+** Params:   std::chrono::steady_clock::time_point start: start time.
+** Returns:  double: elapsed seconds.
+*********************************************************************/
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+
+/********************************************************************
+** Function: Constructor: Sets up a benchmark of populations 10,
+ *           100, ... up to max_population.
+** Params:   int64_t max_population: largest population to time.
+ *           int repetitions: times to run the whole suite.
+** Returns:  None
+*********************************************************************/
+Benchmark::Benchmark(int64_t max_population, int repetitions)
+    : max_population(max_population), repetitions(repetitions),
+        mismatches(ZERO)
+{
+    std::fill(counted, counted + PerfCounters::NUM_COUNTERS, false);
+}
+
+
+/********************************************************************
+** Function: run: Times every hot path at every population,
+ *           counting hardware events too if it can, as many times
+ *           as there are repetitions.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void Benchmark::run()
+{
+    const int64_t POPULATION_STEP = 10;
+
+    //without counters the results just leave them out
+    PerfCounters::open();
+    PerfCounters::printStatus();
+    for (int i=0; i<PerfCounters::NUM_COUNTERS; i++)
+    {
+        counted[i] = PerfCounters::isAvailable(
+                        static_cast<PerfCounters::Counter>(i));
+    }
+    mismatches = ZERO;
+
+    //whole suites are repeated, so drift spreads over every result
+    for (int repetition=0; repetition<repetitions; repetition++)
+    {
+        for (int64_t population=POPULATION_STEP;
+                population<=max_population; population*=POPULATION_STEP)
+        {
+            Zoo *zoo = nullptr;
+            timeAddAnimal(zoo, population);
+            timeRemoveAnimal(*zoo, population);
+            timeDailyPasses(*zoo, population);
+            timeRandomInteger(population);
+
+            delete zoo;
+            zoo = nullptr;
+        }
+
+        //event messages and whole days do not depend on the population
+        timeWriteRead();
+        timeDayLoop();
+        timeGiantExhibits();
+    }
+
+    PerfCounters::close();
+}
+
+
+/********************************************************************
+** Function: getResults: Returns the results so far, in the order
+ *           they were timed.
+** Params:   None
+** Returns:  const vector<Result> &: the results.
+*********************************************************************/
+const vector<Benchmark::Result> &Benchmark::getResults() const
+{
+    return results;
+}
+
+
+/********************************************************************
+** Function: printResults: Prints a table of the results, with a
+ *           column per op for each hardware counter counted.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void Benchmark::printResults() const
+{
+    const int NAME_WIDTH = 24;
+    const int NUMBER_WIDTH = 20;
+    const double NANOSECONDS = 1e9;
+
+    cout << std::left << std::setw(NAME_WIDTH) << "Function"
+            << std::right << std::setw(NUMBER_WIDTH) << "Population"
+            << std::setw(NUMBER_WIDTH) << "ns/op"
+            << std::setw(NUMBER_WIDTH) << "animals/s";
+    for (int c=0; c<PerfCounters::NUM_COUNTERS; c++)
+    {
+        if (counted[c])
+        {
+            cout << std::setw(NUMBER_WIDTH)
+                    << string(PerfCounters::COUNTER_NAMES[c]) + "/op";
+        }
+    }
+    cout << endl;
+
+    cout << std::fixed;
+    for (size_t i=0; i<results.size(); i++)
+    {
+        const Result &result = results[i];
+        cout << std::left << std::setw(NAME_WIDTH) << result.name
+                << std::right << std::setw(NUMBER_WIDTH) << result.population
+                << std::setw(NUMBER_WIDTH) << std::setprecision(3)
+                << result.seconds * NANOSECONDS / result.ops
+                << std::setw(NUMBER_WIDTH) << std::setprecision(0)
+                << result.animals / result.seconds;
+        for (int c=0; c<PerfCounters::NUM_COUNTERS; c++)
+        {
+            if (counted[c])
+            {
+                cout << std::setw(NUMBER_WIDTH) << std::setprecision(3)
+                        << static_cast<double>(result.counters.values[c])
+                            / result.ops;
+            }
+        }
+        cout << endl;
+    }
+}
+
+
+/********************************************************************
+** Function: writeJson: Writes the results to a JSON file, one
+ *           object per result with its ns/op, animals/s, samples,
+ *           and hardware counts per op of the counters counted.
+** Params:   const string &path: file to write.
+** Returns:  bool: true if the file was written.
+*********************************************************************/
+bool Benchmark::writeJson(const string &path) const
+{
+    const double NANOSECONDS = 1e9;
+    const int DIGITS = 6;
+
+    std::ofstream json(path);
+    if (!json)
+    {
+        return false;
+    }
+
+    json << std::setprecision(DIGITS);
+    json << "{" << '\n';
+    json << "  \"max_population\": " << max_population << "," << '\n';
+    json << "  \"min_seconds\": " << MIN_SECONDS << "," << '\n';
+    json << "  \"repetitions\": " << repetitions << "," << '\n';
+    json << "  \"results\": [" << '\n';
+
+    for (size_t i=0; i<results.size(); i++)
+    {
+        const Result &result = results[i];
+        json << "    {\"name\": \"" << result.name << "\""
+                << ", \"population\": " << result.population
+                << ", \"ops\": " << result.ops
+                << ", \"animals\": " << result.animals
+                << ", \"seconds\": " << result.seconds
+                << ", \"ns_per_op\": "
+                << result.seconds * NANOSECONDS / result.ops
+                << ", \"animals_per_second\": "
+                << result.animals / result.seconds
+                << ", \"ns_per_op_samples\": [";
+        for (size_t s=0; s<result.samples.size(); s++)
+        {
+            json << (s > 0 ? ", " : "") << result.samples[s];
+        }
+        json << "]";
+        for (int c=0; c<PerfCounters::NUM_COUNTERS; c++)
+        {
+            if (counted[c])
+            {
+                //cache-misses becomes "cache_misses_per_op"
+                string key = PerfCounters::COUNTER_NAMES[c];
+                std::replace(key.begin(), key.end(), '-', '_');
+                json << ", \"" << key << "_per_op\": "
+                        << static_cast<double>(result.counters.values[c])
+                            / result.ops;
+            }
+        }
+        json << "}" << (i+1 < results.size() ? "," : "") << '\n';
+    }
+
+    json << "  ]" << '\n';
+    json << "}" << '\n';
+    json.close();
+
+    return static_cast<bool>(json);
+}
+
+
+/********************************************************************
+** Function: findField: Finds a field of a result object written by
+ *           writeJson.
+** Params:   const string &line: line holding one result object.
+ *           const string &key: name of the field.
+** Returns:  size_t: position of the field's value, string::npos if
+ *              the line has no such field.
+*********************************************************************/
+static size_t findField(const string &line, const string &key)
+{
+    string field = "\"" + key + "\": ";
+    size_t start = line.find(field);
+    return start == string::npos ? start : start + field.size();
+}
+
+
+/********************************************************************
+** Function: readNumber: Reads a number field of a result object
+ *           written by writeJson.
+** Params:   const string &line: line holding one result object.
+ *           const string &key: name of the field.
+ *           double &value: set to the field's value.
+** Returns:  bool: true if the line has the field as a number.
+*********************************************************************/
+static bool readNumber(const string &line, const string &key,
+                        double &value)
+{
+    size_t start = findField(line, key);
+    if (start == string::npos)
+    {
+        return false;
+    }
+
+    std::istringstream field(line.substr(start));
+    return static_cast<bool>(field >> value);
+}
+
+
+/********************************************************************
+** Function: readJson: Reads results back from a file written by
+ *           writeJson. A result without samples gets its ns/op as
+ *           its only sample, one without animals its ops. Hardware
+ *           counts are not read.
+** Params:   const string &path: file to read.
+ *           vector<Result> &results: set to the results read.
+** Returns:  bool: true if the file was read and had results.
+*********************************************************************/
+bool Benchmark::readJson(const string &path, vector<Result> &results)
+{
+    const char SEPARATOR = ',';
+
+    results.clear();
+
+    std::ifstream json(path);
+    if (!json)
+    {
+        std::cerr << "Could not open benchmark results " << path << endl;
+        return false;
+    }
+
+    //writeJson puts every result object on a line of its own
+    string line;
+    while (getline(json, line))
+    {
+        size_t name_start = findField(line, "name");
+        if (name_start == string::npos || line[name_start] != '"')
+        {
+            continue;
+        }
+
+        Result result;
+        name_start++;
+        result.name = line.substr(name_start,
+                                    line.find('"', name_start) - name_start);
+        result.counters = PerfCounters::ZERO_SAMPLE;
+
+        double population;
+        double ops;
+        double ns_per_op;
+        if (!readNumber(line, "population", population)
+                || !readNumber(line, "ops", ops)
+                || !readNumber(line, "seconds", result.seconds)
+                || !readNumber(line, "ns_per_op", ns_per_op))
+        {
+            std::cerr << "Benchmark results " << path
+                    << " have a result missing fields: " << result.name
+                    << endl;
+            results.clear();
+            return false;
+        }
+        result.population = static_cast<int64_t>(population);
+        result.ops = static_cast<int64_t>(ops);
+
+        //results written before ops were records stood for animals
+        double animals;
+        result.animals = readNumber(line, "animals", animals)
+                            ? static_cast<int64_t>(animals) : result.ops;
+
+        size_t samples_start = findField(line, "ns_per_op_samples");
+        if (samples_start != string::npos)
+        {
+            //skip the '[', then read numbers up to the ']'
+            std::istringstream samples(line.substr(samples_start + 1));
+            double sample;
+            while (samples >> sample)
+            {
+                result.samples.push_back(sample);
+                char next;
+                if (!(samples >> next) || next != SEPARATOR)
+                {
+                    break;
+                }
+            }
+        }
+        if (result.samples.empty())
+        {
+            result.samples.push_back(ns_per_op);
+        }
+
+        results.push_back(result);
+    }
+
+    if (results.empty())
+    {
+        std::cerr << "Benchmark results " << path << " have no results"
+                << endl;
+        return false;
+    }
+
+    return true;
+}
+
+
+/********************************************************************
+** Function: getMismatchCount: Returns how many totals checked by
+ *           the last run were wrong.
+** Params:   None
+** Returns:  int: wrong totals, 0 if every op did what it should.
+*********************************************************************/
+int Benchmark::getMismatchCount() const
+{
+    return mismatches;
+}
+
+
+/********************************************************************
+** Function: timeAddAnimal: Times filling empty zoos with newborns,
+ *           spread evenly over the starting species' exhibits.
+ *           Leaves zoo full, for the other hot paths.
+** Params:   Zoo *&zoo: set to the last zoo filled, caller deletes
+ *              it.
+ *           int64_t population: animals to add to each zoo.
+** Returns:  None
+*********************************************************************/
+void Benchmark::timeAddAnimal(Zoo *&zoo, int64_t population)
+{
+    int64_t ops = 0;
+    double seconds = 0;
+    PerfCounters::Sample counters = PerfCounters::ZERO_SAMPLE;
+
+    //small zoos fill too fast to time once, so fill new ones
+    while (seconds < MIN_SECONDS)
+    {
+        delete zoo;
+        zoo = new Zoo(Zoo::DEFAULT_POLICY, BENCH_SEED);
+
+        startBatch();
+        for (int64_t i=0; i<population; i++)
+        {
+            zoo->addAnimal(BENCH_TYPES[i % BENCH_TYPES_SIZE], ZERO, true);
+        }
+        stopBatch(seconds, counters);
+        ops += population;
+    }
+
+    checkTotal("addAnimal", population, "population", population,
+                zoo->getPopulation());
+    addResult("addAnimal", population, ops, ops, seconds, counters);
+}
+
+
+/********************************************************************
+** Function: timeRemoveAnimal: Times removing a batch of random
+ *           animals, adding them back as newborns between batches
+ *           so the population stays the same.
+** Params:   Zoo &zoo: full zoo.
+ *           int64_t population: animals in zoo.
+** Returns:  None
+*********************************************************************/
+void Benchmark::timeRemoveAnimal(Zoo &zoo, int64_t population)
+{
+    const int64_t MAX_BATCH = 10000;
+
+    int64_t batch = std::min(std::max(population / 2, int64_t(1)),
+                                MAX_BATCH);
+    int64_t ops = 0;
+    double seconds = 0;
+    PerfCounters::Sample counters = PerfCounters::ZERO_SAMPLE;
+
+    while (seconds < MIN_SECONDS)
+    {
+        startBatch();
+        for (int64_t i=0; i<batch; i++)
+        {
+            zoo.removeAnimal(BENCH_TYPES[i % BENCH_TYPES_SIZE]);
+        }
+        stopBatch(seconds, counters);
+        ops += batch;
+
+        for (int64_t i=0; i<batch; i++)
+        {
+            zoo.addAnimal(BENCH_TYPES[i % BENCH_TYPES_SIZE], ZERO, true);
+        }
+    }
+
+    checkTotal("removeAnimal", population, "population", population,
+                zoo.getPopulation());
+    addResult("removeAnimal", population, ops, ops, seconds, counters);
+}
+
+
+/********************************************************************
+** Function: timeDailyPasses: Times increaseAnimalsAge,
+ *           feedAllAnimals, and calculateAnimalProfits, each over
+ *           the whole zoo, per record the pass visits. Checks the
+ *           ages and bank account they leave.
+** Params:   Zoo &zoo: full zoo, with its animals spread like
+ *              timeAddAnimal spreads them.
+ *           int64_t population: animals in zoo.
+** Returns:  None
+*********************************************************************/
+void Benchmark::timeDailyPasses(Zoo &zoo, int64_t population)
+{
+    const int NUM_PASSES = 3;
+    const char *PASS_NAMES[NUM_PASSES] =
+            {"increaseAnimalsAge", "feedAllAnimals", "calculateAnimalProfits"};
+
+    //what one call of each pass should add to the ages and bank,
+    // worked out animal by animal from the species' traits
+    int64_t feed_cents = ZERO;
+    int64_t profit_cents = zoo.tiger_bonus.getCents();
+    for (int t=0; t<BENCH_TYPES_SIZE; t++)
+    {
+        const SpeciesRegistry::Species &species =
+                SpeciesRegistry::get(BENCH_TYPES[t]);
+        int64_t count = population / BENCH_TYPES_SIZE
+                            + (t < population % BENCH_TYPES_SIZE ? 1 : 0);
+
+        feed_cents += Money::fromDollars(zoo.food_cost_multiplier
+                                            * species.feeding_cost)
+                            .getCents() * count;
+        profit_cents += Money::fromDollars(species.payoff).getCents()
+                            * count;
+    }
+    const int64_t CHANGE_PER_CALL[NUM_PASSES] =
+            {population, -feed_cents, profit_cents};
+
+    for (int pass=0; pass<NUM_PASSES; pass++)
+    {
+        int64_t records = countRecordsVisited(zoo, pass == 0);
+        int64_t calls_per_batch = std::max(OPS_PER_BATCH / records,
+                                            int64_t(1));
+        int64_t calls = 0;
+        double seconds = 0;
+        PerfCounters::Sample counters = PerfCounters::ZERO_SAMPLE;
+        int64_t before = pass == 0 ? sumAges(zoo)
+                                    : zoo.bank_account.getCents();
+
+        while (seconds < MIN_SECONDS)
+        {
+            startBatch();
+            for (int64_t i=0; i<calls_per_batch; i++)
+            {
+                if (pass == 0)
+                {
+                    zoo.increaseAnimalsAge();
+                }
+                else if (pass == 1)
+                {
+                    zoo.feedAllAnimals();
+                }
+                else
+                {
+                    zoo.calculateAnimalProfits();
+                }
+            }
+            stopBatch(seconds, counters);
+            calls += calls_per_batch;
+        }
+
+        int64_t after = pass == 0 ? sumAges(zoo)
+                                    : zoo.bank_account.getCents();
+        checkTotal(PASS_NAMES[pass], population,
+                    pass == 0 ? "total age" : "bank account cents",
+                    before + CHANGE_PER_CALL[pass] * calls, after);
+        addResult(PASS_NAMES[pass], population, calls * records,
+                    calls * population, seconds, counters);
+    }
+}
+
+
+/********************************************************************
+** Function: countRecordsVisited: Returns the records one daily
+ *           pass visits: an age cohort or single animal for
+ *           increaseAnimalsAge, an exhibit or new animals group
+ *           for feedAllAnimals and calculateAnimalProfits.
+** Params:   const Zoo &zoo: zoo the pass runs on.
+ *           bool by_animal: true for increaseAnimalsAge.
+** Returns:  int64_t: records visited, at least 1.
+*********************************************************************/
+int64_t Benchmark::countRecordsVisited(const Zoo &zoo, bool by_animal)
+{
+    int64_t records = ZERO;
+
+    for (int i=ZERO; i<zoo.num_exhibits; i++)
+    {
+        if (by_animal)
+        {
+            records += zoo.age_cohorts[i].size();
+            records += zoo.exhibit_count[i].cohorts
+                            ? ZERO : zoo.exhibit_count[i].count;
+        }
+        else
+        {
+            records += SpeciesRegistry::get(i).custom
+                            ? zoo.custom_groups.size() : 1;
+        }
+    }
+
+    return std::max(records, int64_t(1));
+}
+
+
+/********************************************************************
+** Function: sumAges: Returns the ages of every animal in a zoo
+ *           added up.
+** Params:   const Zoo &zoo: zoo to add up.
+** Returns:  int64_t: total age in days.
+*********************************************************************/
+int64_t Benchmark::sumAges(const Zoo &zoo)
+{
+    int64_t total = ZERO;
+
+    for (int i=ZERO; i<zoo.num_exhibits; i++)
+    {
+        for (size_t c=ZERO; c<zoo.age_cohorts[i].size(); c++)
+        {
+            total += zoo.age_cohorts[i][c].age
+                        * zoo.age_cohorts[i][c].count;
+        }
+
+        for (int64_t j=ZERO, p=zoo.exhibit_count[i].count;
+                !zoo.exhibit_count[i].cohorts && j<p; j++)
+        {
+            total += zoo.animal_exhibits[i][j].getAge();
+        }
+    }
+
+    return total;
+}
+
+
+/********************************************************************
+** Function: checkTotal: Counts and prints a total that is not what
+ *           the ops should have left.
+** Params:   const string &name: function timed.
+ *           int64_t population: animals in the zoo.
+ *           const string &total: what was totalled.
+ *           int64_t expected: total the ops should leave.
+ *           int64_t actual: total they left.
+** Returns:  None
+*********************************************************************/
+void Benchmark::checkTotal(const string &name, int64_t population,
+                            const string &total, int64_t expected,
+                            int64_t actual)
+{
+    if (expected != actual)
+    {
+        std::cerr << name << " at population " << population << " left "
+                << total << " " << actual << ", expected " << expected
+                << endl;
+        mismatches++;
+    }
+}
+
+
+/********************************************************************
+** Function: timeWriteRead: Times writing an event message to the
+ *           event file and reading it back, with the printed
+ *           message thrown away.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void Benchmark::timeWriteRead()
+{
+    const int64_t CALLS_PER_BATCH = 100;
+
+    //only an interactive zoo writes event messages
+    Zoo zoo;
+    AnimalRecord animal(TIGER, ZERO);
+    std::ostringstream discard;
+    std::streambuf *screen = cout.rdbuf(discard.rdbuf());
+
+    int64_t ops = 0;
+    double seconds = 0;
+    PerfCounters::Sample counters = PerfCounters::ZERO_SAMPLE;
+
+    while (seconds < MIN_SECONDS)
+    {
+        startBatch();
+        for (int64_t i=0; i<CALLS_PER_BATCH; i++)
+        {
+            zoo.writeRead(Zoo::SICKNESS, &animal);
+        }
+        stopBatch(seconds, counters);
+        ops += CALLS_PER_BATCH;
+        discard.str("");
+    }
+
+    cout.rdbuf(screen);
+    addResult("writeRead", ZERO, ops, ops, seconds, counters);
+}
+
+
+/********************************************************************
+** Function: timeRandomInteger: Times picking random animals out
+ *           of population.
+** Params:   int64_t population: range of the random numbers.
+** Returns:  None
+*********************************************************************/
+void Benchmark::timeRandomInteger(int64_t population)
+{
+    int range_end = static_cast<int>(population - 1);
+    int64_t ops = 0;
+    double seconds = 0;
+    PerfCounters::Sample counters = PerfCounters::ZERO_SAMPLE;
+    volatile int picked;    //kept, so the calls are not optimized away
+
+    MyRandom::seed(BENCH_SEED);
+    while (seconds < MIN_SECONDS)
+    {
+        startBatch();
+        for (int64_t i=0; i<OPS_PER_BATCH; i++)
+        {
+            picked = MyRandom::randomInteger(ZERO, range_end);
+        }
+        stopBatch(seconds, counters);
+        ops += OPS_PER_BATCH;
+    }
+
+    static_cast<void>(picked);
+    addResult("randomInteger", population, ops, ops, seconds, counters);
+}
+
+
+/********************************************************************
+** Function: timeDayLoop: Times headless zoos with the default
+ *           policy running DAY_LOOP_DAYS days each, per day.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void Benchmark::timeDayLoop()
+{
+    int64_t ops = 0;
+    double seconds = 0;
+    PerfCounters::Sample counters = PerfCounters::ZERO_SAMPLE;
+
+    while (seconds < MIN_SECONDS)
+    {
+        Zoo zoo(Zoo::DEFAULT_POLICY, BENCH_SEED);
+
+        startBatch();
+        Zoo::Outcome outcome = zoo.simulate(DAY_LOOP_DAYS);
+        stopBatch(seconds, counters);
+        ops += outcome.days;
+    }
+
+    addResult("dayLoop", ZERO, ops, ops, seconds, counters);
+}
+
+
+/********************************************************************
+** Function: timeGiantExhibits: Times days of the daily passes on
+ *           zoos with GIANT_EXHIBIT_SIZE animals in each exhibit,
+ *           kept as age cohorts, per record visited. Checks the
+ *           population, feeding cost, profits, ages, and bank
+ *           account come out exact, with nothing clamped.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void Benchmark::timeGiantExhibits()
+{
+    const string NAME = "giantExhibits";
+    const int GIANT_AGES = 10;
+    const int64_t COHORT_SIZE = GIANT_EXHIBIT_SIZE / GIANT_AGES;
+    const int64_t POPULATION = COHORT_SIZE * GIANT_AGES * BENCH_TYPES_SIZE;
+
+    int64_t ops = 0;
+    int64_t animals = 0;
+    double seconds = 0;
+    PerfCounters::Sample counters = PerfCounters::ZERO_SAMPLE;
+
+    while (seconds < MIN_SECONDS)
+    {
+        Zoo zoo(Zoo::DEFAULT_POLICY, BENCH_SEED);
+        int64_t feed_cents = ZERO;
+        int64_t profit_cents = zoo.tiger_bonus.getCents();
+        int64_t total_age = ZERO;
+
+        //a whole cohort at a time, adding animals one by one would
+        // take minutes
+        for (int t=0; t<BENCH_TYPES_SIZE; t++)
+        {
+            const SpeciesRegistry::Species &species =
+                    SpeciesRegistry::get(BENCH_TYPES[t]);
+
+            zoo.switchToCohorts(species.exhibit);
+            for (int age=ZERO; age<GIANT_AGES; age++)
+            {
+                zoo.addToCohorts(species.exhibit, age, COHORT_SIZE);
+                total_age += age * COHORT_SIZE;
+            }
+
+            feed_cents += Money::fromDollars(zoo.food_cost_multiplier
+                                                * species.feeding_cost)
+                                .getCents() * COHORT_SIZE * GIANT_AGES;
+            profit_cents += Money::fromDollars(species.payoff).getCents()
+                                * COHORT_SIZE * GIANT_AGES;
+        }
+        checkTotal(NAME, POPULATION, "population", POPULATION,
+                    zoo.getPopulation());
+
+        //the first day is not timed, so feeding and profits are
+        // checked apart
+        int64_t bank = zoo.bank_account.getCents();
+        zoo.increaseAnimalsAge();
+        zoo.feedAllAnimals();
+        checkTotal(NAME, POPULATION, "feeding cost cents", feed_cents,
+                    bank - zoo.bank_account.getCents());
+        bank = zoo.bank_account.getCents();
+        zoo.calculateAnimalProfits();
+        checkTotal(NAME, POPULATION, "profit cents", profit_cents,
+                    zoo.bank_account.getCents() - bank);
+        bank = zoo.bank_account.getCents();
+
+        int64_t records = countRecordsVisited(zoo, true)
+                            + 2 * countRecordsVisited(zoo, false);
+
+        startBatch();
+        for (int day=0; day<DAY_LOOP_DAYS; day++)
+        {
+            zoo.increaseAnimalsAge();
+            zoo.feedAllAnimals();
+            zoo.calculateAnimalProfits();
+        }
+        stopBatch(seconds, counters);
+        ops += DAY_LOOP_DAYS * records;
+        animals += DAY_LOOP_DAYS * POPULATION;
+
+        checkTotal(NAME, POPULATION, "total age",
+                    total_age + (DAY_LOOP_DAYS + 1) * POPULATION,
+                    sumAges(zoo));
+        checkTotal(NAME, POPULATION, "bank account cents",
+                    bank + DAY_LOOP_DAYS * (profit_cents - feed_cents),
+                    zoo.bank_account.getCents());
+        checkTotal(NAME, POPULATION, "overflows", ZERO,
+                    zoo.hasOverflowed());
+    }
+
+    addResult(NAME, POPULATION, ops, animals, seconds, counters);
+}
+
+
+/********************************************************************
+** Function: startBatch: Starts timing and counting a batch of ops.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void Benchmark::startBatch()
+{
+    PerfCounters::read(batch_counters);
+    batch_start = std::chrono::steady_clock::now();
+}
+
+
+/********************************************************************
+** Function: stopBatch: Adds the time and hardware counts since
+ *           startBatch to a result's totals.
+** Params:   double &seconds: total time to add to.
+ *           PerfCounters::Sample &counters: total counts to add to.
+** Returns:  None
+*********************************************************************/
+void Benchmark::stopBatch(double &seconds, PerfCounters::Sample &counters)
+{
+    seconds += secondsSince(batch_start);
+
+    PerfCounters::Sample end_counters;
+    if (PerfCounters::read(end_counters))
+    {
+        PerfCounters::addDifference(batch_counters, end_counters, counters);
+    }
+}
+
+
+/********************************************************************
+** Function: addResult: Records one result, or adds a repetition
+ *           to the result of the same function and population.
+** Params:   const string &name: function timed.
+ *           int64_t population: animals in the zoo.
+ *           int64_t ops: records visited, or calls made.
+ *           int64_t animals: animals the ops stood for.
+ *           double seconds: total time of all ops.
+ *           const PerfCounters::Sample &counters: hardware counts
+ *              of all ops.
+** Returns:  None
+*********************************************************************/
+void Benchmark::addResult(const string &name, int64_t population,
+                            int64_t ops, int64_t animals, double seconds,
+                            const PerfCounters::Sample &counters)
+{
+    const double NANOSECONDS = 1e9;
+
+    double sample = seconds * NANOSECONDS / ops;
+
+    for (size_t i=0; i<results.size(); i++)
+    {
+        Result &result = results[i];
+        if (result.name == name && result.population == population)
+        {
+            result.ops += ops;
+            result.animals += animals;
+            result.seconds += seconds;
+            PerfCounters::addDifference(PerfCounters::ZERO_SAMPLE, counters,
+                                        result.counters);
+            result.samples.push_back(sample);
+            return;
+        }
+    }
+
+    Result result = {name, population, ops, animals, seconds, counters,
+                        vector<double>(1, sample)};
+    results.push_back(result);
+}
@@ -0,0 +1,291 @@
+/*********************************************************************
+** Program name: Benchmark.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 4:00 AM
+** Description: Class specification file for Benchmark class. A
+ *              Benchmark times the Zoo's hot paths on headless zoos
+ *              of 10, 100, ... animals, up to a maximum population:
+ *              adding animals (addToExhibit and increaseExhibit),
+ *              removeAnimal, increaseAnimalsAge, feedAllAnimals,
+ *              calculateAnimalProfits, writeRead, and
+ *              MyRandom::randomInteger, plus whole days of the day
+ *              loop and of the daily passes on exhibits of
+ *              GIANT_EXHIBIT_SIZE animals. The suite can be repeated, keeping each
+ *              repetition's time per operation as a sample. Each
+ *              result is reported as nanoseconds per operation and
+ *              animals per second, in a table and as JSON, with
+ *              hardware counts per operation when PerfCounters can be
+ *              opened. An operation of a daily pass is a record it
+ *              visits, an age cohort or exhibit, not an animal. The
+ *              population, ages and bank account the ops leave are
+ *              checked, and wrong totals counted. The JSON can be
+ *              read back as a baseline, see RegressionGate.
+*********************************************************************/
+
+
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include "Zoo.hpp"
+#include "PerfCounters.hpp"
+#include <chrono>
+#include <string>
+#include <vector>
+
+class Benchmark
+{
+public:
+    //Timing of one hot path at one population
+    struct Result
+    {
+        std::string name;       //function timed
+        int64_t population;     //animals in the zoo, 0 if it does not apply
+        int64_t ops;            //records visited, or calls made
+        int64_t animals;        //animals the ops stood for
+        double seconds;         //total time of all ops
+        PerfCounters::Sample counters;  //hardware counts of all ops
+        std::vector<double> samples;    //ns per op of each repetition
+    };
+
+    //Largest population timed unless told otherwise
+    static const int64_t MAX_POPULATION_DEFAULT;
+    //Each result repeats its op until at least this many seconds
+    static const double MIN_SECONDS;
+    //Days of each timed run of the day loop
+    static const int DAY_LOOP_DAYS;
+    //Animals in each exhibit of the giant exhibits zoo
+    static const int64_t GIANT_EXHIBIT_SIZE;
+
+private:
+    int64_t max_population;
+    int repetitions;            //times the whole suite is run
+    std::vector<Result> results;
+    //Hardware counters the last run counted
+    bool counted[PerfCounters::NUM_COUNTERS];
+    //Start of the batch being timed
+    std::chrono::steady_clock::time_point batch_start;
+    PerfCounters::Sample batch_counters;
+    //Totals that came out different from what the ops should give
+    int mismatches;
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor: Sets up a benchmark of populations 10,
+     *           100, ... up to max_population.
+    ** Params:   int64_t max_population: largest population to time.
+     *           int repetitions: times to run the whole suite.
+    ** Returns:  None
+    *********************************************************************/
+    Benchmark(int64_t max_population = MAX_POPULATION_DEFAULT,
+                int repetitions = 1);
+
+
+    /********************************************************************
+    ** Function: run: Times every hot path at every population,
+     *           counting hardware events too if it can, as many times
+     *           as there are repetitions.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void run();
+
+
+    /********************************************************************
+    ** Function: getResults: Returns the results so far, in the order
+     *           they were timed.
+    ** Params:   None
+    ** Returns:  const vector<Result> &: the results.
+    *********************************************************************/
+    const std::vector<Result> &getResults() const;
+
+
+    /********************************************************************
+    ** Function: printResults: Prints a table of the results, with a
+     *           column per op for each hardware counter counted.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void printResults() const;
+
+
+    /********************************************************************
+    ** Function: writeJson: Writes the results to a JSON file, one
+     *           object per result with its ns/op, animals/s, samples,
+     *           and hardware counts per op of the counters counted.
+    ** Params:   const string &path: file to write.
+    ** Returns:  bool: true if the file was written.
+    *********************************************************************/
+    bool writeJson(const std::string &path) const;
+
+
+    /********************************************************************
+    ** Function: readJson: Reads results back from a file written by
+     *           writeJson. A result without samples gets its ns/op as
+     *           its only sample. Hardware counts are not read.
+    ** Params:   const string &path: file to read.
+     *           vector<Result> &results: set to the results read.
+    ** Returns:  bool: true if the file was read and had results.
+    *********************************************************************/
+    static bool readJson(const std::string &path,
+                            std::vector<Result> &results);
+
+
+    /********************************************************************
+    ** Function: getMismatchCount: Returns how many totals checked by
+     *           the last run were wrong.
+    ** Params:   None
+    ** Returns:  int: wrong totals, 0 if every op did what it should.
+    *********************************************************************/
+    int getMismatchCount() const;
+
+private:
+
+    /********************************************************************
+    ** Function: timeAddAnimal: Times filling empty zoos with newborns,
+     *           spread evenly over the starting species' exhibits.
+     *           Leaves zoo full, for the other hot paths.
+    ** Params:   Zoo *&zoo: set to the last zoo filled, caller deletes
+     *              it.
+     *           int64_t population: animals to add to each zoo.
+    ** Returns:  None
+    *********************************************************************/
+    void timeAddAnimal(Zoo *&zoo, int64_t population);
+
+
+    /********************************************************************
+    ** Function: timeRemoveAnimal: Times removing a batch of random
+     *           animals, adding them back as newborns between batches
+     *           so the population stays the same.
+    ** Params:   Zoo &zoo: full zoo.
+     *           int64_t population: animals in zoo.
+    ** Returns:  None
+    *********************************************************************/
+    void timeRemoveAnimal(Zoo &zoo, int64_t population);
+
+
+    /********************************************************************
+    ** Function: timeDailyPasses: Times increaseAnimalsAge,
+     *           feedAllAnimals, and calculateAnimalProfits, each over
+     *           the whole zoo, per record the pass visits. Checks the
+     *           ages and bank account they leave.
+    ** Params:   Zoo &zoo: full zoo, with its animals spread like
+     *              timeAddAnimal spreads them.
+     *           int64_t population: animals in zoo.
+    ** Returns:  None
+    *********************************************************************/
+    void timeDailyPasses(Zoo &zoo, int64_t population);
+
+
+    /********************************************************************
+    ** Function: countRecordsVisited: Returns the records one daily
+     *           pass visits: an age cohort or single animal for
+     *           increaseAnimalsAge, an exhibit or new animals group
+     *           for feedAllAnimals and calculateAnimalProfits.
+    ** Params:   const Zoo &zoo: zoo the pass runs on.
+     *           bool by_animal: true for increaseAnimalsAge.
+    ** Returns:  int64_t: records visited, at least 1.
+    *********************************************************************/
+    static int64_t countRecordsVisited(const Zoo &zoo, bool by_animal);
+
+
+    /********************************************************************
+    ** Function: sumAges: Returns the ages of every animal in a zoo
+     *           added up.
+    ** Params:   const Zoo &zoo: zoo to add up.
+    ** Returns:  int64_t: total age in days.
+    *********************************************************************/
+    static int64_t sumAges(const Zoo &zoo);
+
+
+    /********************************************************************
+    ** Function: checkTotal: Counts and prints a total that is not what
+     *           the ops should have left.
+    ** Params:   const string &name: function timed.
+     *           int64_t population: animals in the zoo.
+     *           const string &total: what was totalled.
+     *           int64_t expected: total the ops should leave.
+     *           int64_t actual: total they left.
+    ** Returns:  None
+    *********************************************************************/
+    void checkTotal(const std::string &name, int64_t population,
+                    const std::string &total, int64_t expected,
+                    int64_t actual);
+
+
+    /********************************************************************
+    ** Function: timeWriteRead: Times writing an event message to the
+     *           event file and reading it back, with the printed
+     *           message thrown away.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void timeWriteRead();
+
+
+    /********************************************************************
+    ** Function: timeRandomInteger: Times picking random animals out
+     *           of population.
+    ** Params:   int64_t population: range of the random numbers.
+    ** Returns:  None
+    *********************************************************************/
+    void timeRandomInteger(int64_t population);
+
+
+    /********************************************************************
+    ** Function: timeDayLoop: Times headless zoos with the default
+     *           policy running DAY_LOOP_DAYS days each, per day.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void timeDayLoop();
+
+
+    /********************************************************************
+    ** Function: timeGiantExhibits: Times days of the daily passes on
+     *           zoos with GIANT_EXHIBIT_SIZE animals in each exhibit,
+     *           kept as age cohorts, per record visited. Checks the
+     *           population, feeding cost, profits, ages, and bank
+     *           account come out exact, with nothing clamped.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void timeGiantExhibits();
+
+
+    /********************************************************************
+    ** Function: startBatch: Starts timing and counting a batch of ops.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void startBatch();
+
+
+    /********************************************************************
+    ** Function: stopBatch: Adds the time and hardware counts since
+     *           startBatch to a result's totals.
+    ** Params:   double &seconds: total time to add to.
+     *           PerfCounters::Sample &counters: total counts to add to.
+    ** Returns:  None
+    *********************************************************************/
+    void stopBatch(double &seconds, PerfCounters::Sample &counters);
+
+
+    /********************************************************************
+    ** Function: addResult: Records one result, or adds a repetition
+     *           to the result of the same function and population.
+    ** Params:   const string &name: function timed.
+     *           int64_t population: animals in the zoo.
+     *           int64_t ops: records visited, or calls made.
+     *           int64_t animals: animals the ops stood for.
+     *           double seconds: total time of all ops.
+     *           const PerfCounters::Sample &counters: hardware counts
+     *              of all ops.
+    ** Returns:  None
+    *********************************************************************/
+    void addResult(const std::string &name, int64_t population,
+                    int64_t ops, int64_t animals, double seconds,
+                    const PerfCounters::Sample &counters);
+};
+
+#endif
@@ -0,0 +1,123 @@
+/*********************************************************************
+** Program name: CheckedMath.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 3:10 AM
+** Description: Class implementation file for CheckedMath class.
+ *              CheckedMath is a helper class with static functions
+ *              for 64-bit arithmetic that never wraps around. A
+ *              result too big for 64 bits is clamped to the largest
+ *              or smallest value, and the function returns false so
+ *              the caller can tell. Sums of squares are kept in 128
+ *              bits, as a high and a low half.
+*********************************************************************/
+
+
+#include "CheckedMath.hpp"
+
+/********************************************************************
+** Function: add: Adds two numbers, clamping on overflow. This is a
+ *           static class function.
+** Params:   int64_t a, int64_t b: numbers to add.
+ *           int64_t &sum: set to the sum, or the nearest limit.
+** Returns:  bool: false if the sum overflowed.
+*********************************************************************/
+bool CheckedMath::add(int64_t a, int64_t b, int64_t &sum)
+{
+    //check against the limits before adding, signed overflow is
+    // undefined
+    if (b > 0 && a > INT64_MAX - b)
+    {
+        sum = INT64_MAX;
+        return false;
+    }
+    if (b < 0 && a < INT64_MIN - b)
+    {
+        sum = INT64_MIN;
+        return false;
+    }
+
+    sum = a + b;
+    return true;
+}
+
+
+/********************************************************************
+** Function: multiply: Multiplies two numbers, clamping on overflow.
+ *           This is a static class function.
+** Params:   int64_t a, int64_t b: numbers to multiply.
+ *           int64_t &product: set to the product, or the nearest
+ *              limit.
+** Returns:  bool: false if the product overflowed.
+*********************************************************************/
+bool CheckedMath::multiply(int64_t a, int64_t b, int64_t &product)
+{
+    //one division per sign case tells if the product fits
+    bool fits;
+    if (a > 0)
+    {
+        fits = b > 0 ? a <= INT64_MAX / b : b >= INT64_MIN / a;
+    }
+    else if (a < 0)
+    {
+        fits = b > 0 ? a >= INT64_MIN / b : b >= INT64_MAX / a;
+    }
+    else
+    {
+        fits = true;
+    }
+
+    if (!fits)
+    {
+        product = (a > 0) == (b > 0) ? INT64_MAX : INT64_MIN;
+        return false;
+    }
+
+    product = a * b;
+    return true;
+}
+
+
+/********************************************************************
+** Function: addSquare: Adds a number squared to a 128-bit sum kept
+ *           as two halves, clamping on overflow. This is a static
+ *           class function.
+** Params:   int64_t value: number to square.
+ *           uint64_t &high: upper 64 bits of the sum.
+ *           uint64_t &low: lower 64 bits of the sum.
+** Returns:  bool: false if the sum overflowed.
+*********************************************************************/
+bool CheckedMath::addSquare(int64_t value, uint64_t &high, uint64_t &low)
+{
+    const int HALF_BITS = 32;
+    const uint64_t HALF_MASK = 0xFFFFFFFFu;
+
+    //square the magnitude in 32-bit halves, so no partial product wraps
+    uint64_t magnitude = value < 0 ? 0 - static_cast<uint64_t>(value)
+                                    : static_cast<uint64_t>(value);
+    uint64_t upper = magnitude >> HALF_BITS;
+    uint64_t lower = magnitude & HALF_MASK;
+    uint64_t cross = upper * lower;
+
+    uint64_t square_low = lower * lower;
+    uint64_t square_high = upper * upper + (cross >> (HALF_BITS - 1));
+    uint64_t shifted = cross << (HALF_BITS + 1);
+    square_low += shifted;
+    if (square_low < shifted)
+    {
+        square_high++;
+    }
+
+    //add the square, carrying out of the low half
+    uint64_t sum_low = low + square_low;
+    uint64_t sum_high = high + square_high + (sum_low < low ? 1 : 0);
+    if (sum_high < high)
+    {
+        high = UINT64_MAX;
+        low = UINT64_MAX;
+        return false;
+    }
+
+    high = sum_high;
+    low = sum_low;
+    return true;
+}
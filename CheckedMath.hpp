@@ -0,0 +1,57 @@
+/*********************************************************************
+** Program name: CheckedMath.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 3:10 AM
+** Description: Class specification file for CheckedMath class.
+ *              CheckedMath is a helper class with static functions
+ *              for 64-bit arithmetic that never wraps around. A
+ *              result too big for 64 bits is clamped to the largest
+ *              or smallest value, and the function returns false so
+ *              the caller can tell. Sums of squares are kept in 128
+ *              bits, as a high and a low half.
+*********************************************************************/
+
+
+#ifndef CHECKED_MATH_HPP
+#define CHECKED_MATH_HPP
+
+#include <cstdint>
+
+class CheckedMath
+{
+public:
+
+    /********************************************************************
+    ** Function: add: Adds two numbers, clamping on overflow. This is a
+     *           static class function.
+    ** Params:   int64_t a, int64_t b: numbers to add.
+     *           int64_t &sum: set to the sum, or the nearest limit.
+    ** Returns:  bool: false if the sum overflowed.
+    *********************************************************************/
+    static bool add(int64_t a, int64_t b, int64_t &sum);
+
+
+    /********************************************************************
+    ** Function: multiply: Multiplies two numbers, clamping on overflow.
+     *           This is a static class function.
+    ** Params:   int64_t a, int64_t b: numbers to multiply.
+     *           int64_t &product: set to the product, or the nearest
+     *              limit.
+    ** Returns:  bool: false if the product overflowed.
+    *********************************************************************/
+    static bool multiply(int64_t a, int64_t b, int64_t &product);
+
+
+    /********************************************************************
+    ** Function: addSquare: Adds a number squared to a 128-bit sum kept
+     *           as two halves, clamping on overflow. This is a static
+     *           class function.
+    ** Params:   int64_t value: number to square.
+     *           uint64_t &high: upper 64 bits of the sum.
+     *           uint64_t &low: lower 64 bits of the sum.
+    ** Returns:  bool: false if the sum overflowed.
+    *********************************************************************/
+    static bool addSquare(int64_t value, uint64_t &high, uint64_t &low);
+};
+
+#endif
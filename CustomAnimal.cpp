@@ -9,17 +9,38 @@
  *              simulation. The user will determine the animal's
  *              purchase cost, number of babies, feeding costs, and
  *              payoff. They inherit all data members and functions
- *              of Animal, with the addition of a string for their
- *              name, and a function to get their name.
+ *              of Animal. Their traits are interned in the species
+ *              registry, so animals with the same traits share them.
+ *              Animals of species loaded from a file are also
+ *              CustomAnimals.
 *********************************************************************/
 
 
 #include "CustomAnimal.hpp"
+#include "SpeciesRegistry.hpp"
 
 /********************************************************************
-** Function: Constructor/default: Sets age, name, cost, number of
- *           babies, feeding cost, and payoff of animal to arguments.
+** Function: internTraits: Interns a new animal's traits, falling
+ *           back to the new animals exhibit's own traits if the
+ *           registry is full.
+** Params:   The traits passed to the constructor.
+** Returns:  SpeciesId: ID of the animal's traits.
+*********************************************************************/
+static SpeciesId internTraits(const std::string &name, int cost,
+                                int num_babies, double feeding_cost,
+                                double payoff)
+{
+    SpeciesId species = SpeciesRegistry::intern(name, cost, num_babies,
+                                                feeding_cost, payoff);
+    return species < ZERO ? CUSTOM : species;
+}
+
+
+/********************************************************************
+** Function: Constructor/default: Sets age of animal, and interns its
+ *           name, cost, number of babies, feeding cost, and payoff.
  *           Defaults to default values if no arguments passed in.
+ *           If the registry is full, it is a generic new animal.
 ** Params:  string name: name of custom animal.
  *              default = empty string "".
  *          int age: age of animal.
@@ -36,24 +57,33 @@
 *********************************************************************/
 CustomAnimal::CustomAnimal(std::string name, int age, int cost, int num_babies,
                 double feeding_cost, double payoff)
-{
-    this->name = name;
-    this->age = age;
-    this->cost = cost;
-    this->num_babies = num_babies;
-    this->feeding_cost = feeding_cost;
-    this->payoff = payoff;
-}
+    : Animal(internTraits(name, cost, num_babies, feeding_cost, payoff),
+                age)
+{}
+
+
+/********************************************************************
+** Function: Constructor: Sets species and age of animal, for babies
+ *           and animals of loaded species whose traits are already
+ *           in the species registry.
+** Params:  SpeciesId species: registry ID of the animal's traits.
+ *          int age: age of animal.
+ *              default = 0;
+** Returns: None
+*********************************************************************/
+CustomAnimal::CustomAnimal(SpeciesId species, int age)
+    : Animal(species, age)
+{}
 
 
 /********************************************************************
 ** Function: getName: Returns name of animal.
 ** Params:   None
-** Returns:  string name: Custom Animal's name
+** Returns:  const string &name: Custom Animal's name
 *********************************************************************/
-std::string CustomAnimal::getName() const
+const std::string &CustomAnimal::getName() const
 {
-    return name;
+    return getTraits().name;
 }
 
 
@@ -64,5 +94,5 @@ std::string CustomAnimal::getName() const
 *********************************************************************/
 double CustomAnimal::getFeedingCost() const
 {
-    return feeding_cost;
+    return getTraits().feeding_cost;
 }
@@ -9,8 +9,10 @@
  *              simulation. The user will determine the animal's
  *              purchase cost, number of babies, feeding costs, and
  *              payoff. They inherit all data members and functions
- *              of Animal, with the addition of a string for their
- *              name, and a function to get their name.
+ *              of Animal. Their traits are interned in the species
+ *              registry, so animals with the same traits share them.
+ *              Animals of species loaded from a file are also
+ *              CustomAnimals.
 *********************************************************************/
 
 
@@ -20,17 +22,14 @@
 #include "Animal.hpp"
 #include <string>
 
-class CustomAnimal : public Animal
+class CustomAnimal final : public Animal
 {
-protected:
-    std::string name;
-    double feeding_cost;
-
 public:
     /********************************************************************
-    ** Function: Constructor/default: Sets age, name, cost, number of
-     *           babies, feeding cost, and payoff of animal to arguments.
+    ** Function: Constructor/default: Sets age of animal, and interns its
+     *           name, cost, number of babies, feeding cost, and payoff.
      *           Defaults to default values if no arguments passed in.
+     *           If the registry is full, it is a generic new animal.
     ** Params:  string name: name of custom animal.
      *              default = empty string "".
      *          int age: age of animal.
@@ -53,12 +52,24 @@ public:
                 double payoff = DEFAULTS[CUSTOM].default_payoff_percentage);
 
 
+    /********************************************************************
+    ** Function: Constructor: Sets species and age of animal, for babies
+     *           and animals of loaded species whose traits are already
+     *           in the species registry.
+    ** Params:  SpeciesId species: registry ID of the animal's traits.
+     *          int age: age of animal.
+     *              default = 0;
+    ** Returns: None
+    *********************************************************************/
+    CustomAnimal(SpeciesId species, int age = ZERO);
+
+
     /********************************************************************
     ** Function: getName: Returns name of animal.
     ** Params:   None
-    ** Returns:  string name: Custom Animal's name
+    ** Returns:  const string &name: Custom Animal's name
     *********************************************************************/
-    virtual std::string getName() const override;
+    virtual const std::string &getName() const override final;
 
 
     /********************************************************************
@@ -66,7 +77,7 @@ public:
     ** Params:   None
     ** Returns:  double feeding_cost.
     *********************************************************************/
-    virtual double getFeedingCost() const override;
+    virtual double getFeedingCost() const override final;
 };
 
 #endif
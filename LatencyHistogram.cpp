@@ -0,0 +1,228 @@
+/*********************************************************************
+** Program name: LatencyHistogram.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 4:40 AM
+** Description: Class implementation file for LatencyHistogram class.
+ *              A LatencyHistogram counts durations in nanoseconds
+ *              into log-linear buckets: every power of two is split
+ *              into 16 buckets, so any value is known to within
+ *              1/16 of itself. Recording is a few relaxed atomic
+ *              instructions and never allocates, so any thread can
+ *              record into a shared histogram, and percentiles such
+ *              as p50 and p99 can be read at any time without keeping
+ *              the samples.
+*********************************************************************/
+
+
+#include "LatencyHistogram.hpp"
+#include "CheckedMath.hpp"
+#include <cmath>
+
+//Initialize constants
+const int LatencyHistogram::SUB_BUCKET_BITS = 4;
+
+//Bits in a value, so the highest power of two has a bucket too
+static const int VALUE_BITS = 64;
+
+/********************************************************************
+** Function: Constructor/default: Initializes an empty histogram.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+LatencyHistogram::LatencyHistogram()
+    : counts(bucketOf(UINT64_MAX) + 1), total(0), sum(0),
+        sum_saturated(false), max(0)
+{
+    reset();
+}
+
+
+/********************************************************************
+** Function: record: Counts one value. Safe to call from any
+ *           thread.
+** Params:   int64_t value: duration in nanoseconds, negative
+ *              values count as 0.
+** Returns:  None
+*********************************************************************/
+void LatencyHistogram::record(int64_t value)
+{
+    if (value < 0)
+    {
+        value = 0;
+    }
+
+    //each field is counted on its own, readers only need each to be
+    // whole, not all of them to agree
+    counts[bucketOf(static_cast<uint64_t>(value))].fetch_add(
+            1, std::memory_order_relaxed);
+    total.fetch_add(1, std::memory_order_relaxed);
+
+    int64_t old_sum = sum.load(std::memory_order_relaxed);
+    int64_t new_sum;
+    do
+    {
+        if (!CheckedMath::add(old_sum, value, new_sum))
+        {
+            sum_saturated.store(true, std::memory_order_relaxed);
+        }
+    } while (!sum.compare_exchange_weak(old_sum, new_sum,
+                                        std::memory_order_relaxed));
+
+    int64_t old_max = max.load(std::memory_order_relaxed);
+    while (value > old_max
+            && !max.compare_exchange_weak(old_max, value,
+                                            std::memory_order_relaxed))
+    {
+        //old_max was set to the larger value another thread stored
+    }
+}
+
+
+/********************************************************************
+** Function: reset: Forgets every value recorded.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void LatencyHistogram::reset()
+{
+    for (size_t bucket=0; bucket<counts.size(); bucket++)
+    {
+        counts[bucket].store(0, std::memory_order_relaxed);
+    }
+    total.store(0, std::memory_order_relaxed);
+    sum.store(0, std::memory_order_relaxed);
+    sum_saturated.store(false, std::memory_order_relaxed);
+    max.store(0, std::memory_order_relaxed);
+}
+
+
+/********************************************************************
+** Function: Getters: Return the number of values recorded, the
+ *           largest, and their mean. Once the sum of the values
+ *           overflows, the mean is worked out from the buckets, to
+ *           within 1/16.
+** Params:   None
+** Returns:  int64_t/double: the statistic, 0 if nothing was
+ *              recorded.
+*********************************************************************/
+int64_t LatencyHistogram::getCount() const
+{
+    return total.load(std::memory_order_relaxed);
+}
+
+int64_t LatencyHistogram::getMax() const
+{
+    return max.load(std::memory_order_relaxed);
+}
+
+double LatencyHistogram::getMean() const
+{
+    int64_t values = total.load(std::memory_order_relaxed);
+    if (values <= 0)
+    {
+        return 0;
+    }
+
+    if (!sum_saturated.load(std::memory_order_relaxed))
+    {
+        return static_cast<double>(sum.load(std::memory_order_relaxed))
+                / values;
+    }
+
+    //every value counted as the top of its bucket
+    double bucket_sum = 0;
+    for (size_t bucket=0; bucket<counts.size(); bucket++)
+    {
+        bucket_sum += static_cast<double>(
+                        counts[bucket].load(std::memory_order_relaxed))
+                    * bucketTop(static_cast<int>(bucket));
+    }
+    return bucket_sum / values;
+}
+
+
+/********************************************************************
+** Function: percentile: Returns the value that fraction of the
+ *           recorded values are at or below, such as 0.99 for
+ *           p99. It is the top of that value's bucket, so it is
+ *           never more than 1/16 too high, and never above the
+ *           largest value recorded.
+** Params:   double fraction: from 0 to 1.
+** Returns:  int64_t: the value, 0 if nothing was recorded.
+*********************************************************************/
+int64_t LatencyHistogram::percentile(double fraction) const
+{
+    int64_t values = total.load(std::memory_order_relaxed);
+    int64_t largest = max.load(std::memory_order_relaxed);
+    if (values == 0)
+    {
+        return 0;
+    }
+
+    //rank of the value, counting from 1
+    int64_t rank = static_cast<int64_t>(std::ceil(fraction * values));
+    if (rank < 1)
+    {
+        rank = 1;
+    }
+
+    int64_t seen = 0;
+    for (size_t bucket=0; bucket<counts.size(); bucket++)
+    {
+        seen += counts[bucket].load(std::memory_order_relaxed);
+        if (seen >= rank)
+        {
+            uint64_t top = bucketTop(static_cast<int>(bucket));
+            return top < static_cast<uint64_t>(largest)
+                    ? static_cast<int64_t>(top) : largest;
+        }
+    }
+
+    return largest;
+}
+
+
+/********************************************************************
+** Function: bucketOf: Returns the bucket a value is counted in.
+** Params:   uint64_t value: value to count.
+** Returns:  int: index into counts.
+*********************************************************************/
+int LatencyHistogram::bucketOf(uint64_t value)
+{
+    const uint64_t SUB_BUCKETS = uint64_t(1) << SUB_BUCKET_BITS;
+
+    //small values get a bucket each
+    if (value < SUB_BUCKETS)
+    {
+        return static_cast<int>(value);
+    }
+
+    //then each power of two is split evenly, by the bits after the
+    // highest one
+    int high_bit = VALUE_BITS - 1 - __builtin_clzll(value);
+    int shift = high_bit - SUB_BUCKET_BITS;
+    int sub_bucket = static_cast<int>((value >> shift) - SUB_BUCKETS);
+
+    return static_cast<int>(SUB_BUCKETS) * (shift + 1) + sub_bucket;
+}
+
+
+/********************************************************************
+** Function: bucketTop: Returns the largest value of a bucket.
+** Params:   int bucket: index into counts.
+** Returns:  uint64_t: the value.
+*********************************************************************/
+uint64_t LatencyHistogram::bucketTop(int bucket)
+{
+    const int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+
+    if (bucket < SUB_BUCKETS)
+    {
+        return static_cast<uint64_t>(bucket);
+    }
+
+    int shift = bucket / SUB_BUCKETS - 1;
+    uint64_t bottom = static_cast<uint64_t>(SUB_BUCKETS
+                                            + bucket % SUB_BUCKETS) << shift;
+    return bottom + ((uint64_t(1) << shift) - 1);
+}
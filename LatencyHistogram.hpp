@@ -0,0 +1,109 @@
+/*********************************************************************
+** Program name: LatencyHistogram.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 4:40 AM
+** Description: Class specification file for LatencyHistogram class.
+ *              A LatencyHistogram counts durations in nanoseconds
+ *              into log-linear buckets: every power of two is split
+ *              into 16 buckets, so any value is known to within
+ *              1/16 of itself. Recording is a few relaxed atomic
+ *              instructions and never allocates, so any thread can
+ *              record into a shared histogram, and percentiles such
+ *              as p50 and p99 can be read at any time without keeping
+ *              the samples.
+*********************************************************************/
+
+
+#ifndef LATENCY_HISTOGRAM_HPP
+#define LATENCY_HISTOGRAM_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+class LatencyHistogram
+{
+public:
+    //Buckets each power of two is split into, as a power of two
+    static const int SUB_BUCKET_BITS;
+
+private:
+    //values counted in each bucket
+    std::vector<std::atomic<int64_t> > counts;
+    std::atomic<int64_t> total;             //values recorded
+    std::atomic<int64_t> sum;               //sum of all values, saturated
+    std::atomic<bool> sum_saturated;        //true once sum overflowed
+    std::atomic<int64_t> max;               //largest value recorded
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor/default: Initializes an empty histogram.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    LatencyHistogram();
+
+
+    /********************************************************************
+    ** Function: record: Counts one value. Safe to call from any
+     *           thread.
+    ** Params:   int64_t value: duration in nanoseconds, negative
+     *              values count as 0.
+    ** Returns:  None
+    *********************************************************************/
+    void record(int64_t value);
+
+
+    /********************************************************************
+    ** Function: reset: Forgets every value recorded.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void reset();
+
+
+    /********************************************************************
+    ** Function: Getters: Return the number of values recorded, the
+     *           largest, and their mean. Once the sum of the values
+     *           overflows, the mean is worked out from the buckets, to
+     *           within 1/16.
+    ** Params:   None
+    ** Returns:  int64_t/double: the statistic, 0 if nothing was
+     *              recorded.
+    *********************************************************************/
+    int64_t getCount() const;
+    int64_t getMax() const;
+    double getMean() const;
+
+
+    /********************************************************************
+    ** Function: percentile: Returns the value that fraction of the
+     *           recorded values are at or below, such as 0.99 for
+     *           p99. It is the top of that value's bucket, so it is
+     *           never more than 1/16 too high, and never above the
+     *           largest value recorded.
+    ** Params:   double fraction: from 0 to 1.
+    ** Returns:  int64_t: the value, 0 if nothing was recorded.
+    *********************************************************************/
+    int64_t percentile(double fraction) const;
+
+private:
+
+    /********************************************************************
+    ** Function: bucketOf: Returns the bucket a value is counted in.
+    ** Params:   uint64_t value: value to count.
+    ** Returns:  int: index into counts.
+    *********************************************************************/
+    static int bucketOf(uint64_t value);
+
+
+    /********************************************************************
+    ** Function: bucketTop: Returns the largest value of a bucket.
+    ** Params:   int bucket: index into counts.
+    ** Returns:  uint64_t: the value.
+    *********************************************************************/
+    static uint64_t bucketTop(int bucket);
+};
+
+#endif
@@ -0,0 +1,161 @@
+/*********************************************************************
+** Program name: MappedArena.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 18, 2026 at 11:05 PM
+** Description: Class implementation file for MappedArena class.
+ *              MappedArena is one growable block of memory backed by
+ *              a memory-mapped file instead of the heap. The kernel
+ *              can write those pages back to the file and drop them
+ *              from RAM whenever it needs to, so an exhibit array
+ *              stored in an arena can grow past physical memory. The
+ *              whole address range is reserved up front, so the block
+ *              never moves. Growing it only lengthens the file
+ *              underneath, nothing is copied.
+*********************************************************************/
+
+
+#include "MappedArena.hpp"
+#include <cstdio>
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+//Initialize constants
+const size_t MappedArena::RESERVE_DEFAULT = size_t(16) << 30;
+const size_t MappedArena::GROW_SIZE = size_t(64) << 20;
+
+/********************************************************************
+** Function: Constructor: Creates (or truncates) the file at path and
+ *           maps reserve bytes of it.
+** Params:   const string &path: backing file.
+ *           size_t reserve: most bytes the arena can ever hold.
+** Returns:  None
+*********************************************************************/
+MappedArena::MappedArena(const std::string &path, size_t reserve)
+    : path(path), fd(-1), base(nullptr), reserved(reserve), file_size(0),
+    used(0)
+{
+    fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0)
+    {
+        return;
+    }
+
+    //map the whole reserve now, the file only grows as the block does.
+    // Pages past the end of the file are never touched.
+    void *mapping = mmap(nullptr, reserved, PROT_READ | PROT_WRITE,
+                            MAP_SHARED | MAP_NORESERVE, fd, 0);
+    if (mapping == MAP_FAILED)
+    {
+        close(fd);
+        fd = -1;
+        return;
+    }
+
+    base = static_cast<char *>(mapping);
+    madvise(base, reserved, MADV_SEQUENTIAL);
+}
+
+
+/********************************************************************
+** Function: Destructor: Unmaps and removes the backing file. The
+ *           block must not be used after the arena is gone.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+MappedArena::~MappedArena()
+{
+    if (base)
+    {
+        munmap(base, reserved);
+        base = nullptr;
+    }
+    if (fd >= 0)
+    {
+        close(fd);
+        fd = -1;
+        std::remove(path.c_str());
+    }
+}
+
+
+/********************************************************************
+** Function: isOpen: Returns true if the file was mapped.
+** Params:   None
+** Returns:  bool: true if the block can be used.
+*********************************************************************/
+bool MappedArena::isOpen() const
+{
+    return base != nullptr;
+}
+
+
+/********************************************************************
+** Function: getBase: Returns the start of the block, which stays
+ *           the same for the life of the arena.
+** Params:   None
+** Returns:  void *: start of the block, nullptr if not open.
+*********************************************************************/
+void *MappedArena::getBase() const
+{
+    return base;
+}
+
+
+/********************************************************************
+** Function: grow: Makes sure the first bytes of the block can be
+ *           used, lengthening the file if they are past its end.
+ *           Bytes already in the block are left where they are.
+** Params:   size_t bytes: size the block must have.
+** Returns:  bool: false if the file could not grow that far.
+*********************************************************************/
+bool MappedArena::grow(size_t bytes)
+{
+    if (!base || bytes > reserved)
+    {
+        return false;
+    }
+
+    //grow the file in big steps so ftruncate is rarely called
+    if (bytes > file_size)
+    {
+        size_t new_size = std::min(std::max(bytes, file_size + GROW_SIZE),
+                                    reserved);
+        if (ftruncate(fd, static_cast<off_t>(new_size)) != 0)
+        {
+            return false;
+        }
+        file_size = new_size;
+    }
+
+    used = std::max(used, bytes);
+    return true;
+}
+
+
+/********************************************************************
+** Function: adviseSequential: Tells the kernel the used part of the
+ *           block is about to be read front to back, so it reads
+ *           ahead aggressively and drops pages behind the scan.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void MappedArena::adviseSequential() const
+{
+    if (base && used > 0)
+    {
+        madvise(base, used, MADV_SEQUENTIAL);
+    }
+}
+
+
+/********************************************************************
+** Function: getFileSize: Returns bytes of the backing file.
+** Params:   None
+** Returns:  size_t: file size.
+*********************************************************************/
+size_t MappedArena::getFileSize() const
+{
+    return file_size;
+}
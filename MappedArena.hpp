@@ -0,0 +1,111 @@
+/*********************************************************************
+** Program name: MappedArena.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 18, 2026 at 11:05 PM
+** Description: Class specification file for MappedArena class.
+ *              MappedArena is one growable block of memory backed by
+ *              a memory-mapped file instead of the heap. The kernel
+ *              can write those pages back to the file and drop them
+ *              from RAM whenever it needs to, so an exhibit array
+ *              stored in an arena can grow past physical memory. The
+ *              whole address range is reserved up front, so the block
+ *              never moves. Growing it only lengthens the file
+ *              underneath, nothing is copied.
+*********************************************************************/
+
+
+#ifndef MAPPED_ARENA_HPP
+#define MAPPED_ARENA_HPP
+
+#include <string>
+#include <cstddef>
+
+class MappedArena
+{
+public:
+    //Default address space reserved per arena, 16 GB
+    static const size_t RESERVE_DEFAULT;
+
+private:
+    //File is grown this many bytes at a time
+    static const size_t GROW_SIZE;
+
+    std::string path;
+    int fd;
+    char *base;             //start of the mapping, nullptr if failed
+    size_t reserved;        //bytes of address space mapped
+    size_t file_size;       //bytes of the file that exist
+    size_t used;            //bytes asked for through grow
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor: Creates (or truncates) the file at path and
+     *           maps reserve bytes of it.
+    ** Params:   const string &path: backing file.
+     *           size_t reserve: most bytes the arena can ever hold.
+    ** Returns:  None
+    *********************************************************************/
+    MappedArena(const std::string &path, size_t reserve = RESERVE_DEFAULT);
+
+
+    /********************************************************************
+    ** Function: Destructor: Unmaps and removes the backing file. The
+     *           block must not be used after the arena is gone.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    ~MappedArena();
+
+
+    /********************************************************************
+    ** Function: isOpen: Returns true if the file was mapped.
+    ** Params:   None
+    ** Returns:  bool: true if the block can be used.
+    *********************************************************************/
+    bool isOpen() const;
+
+
+    /********************************************************************
+    ** Function: getBase: Returns the start of the block, which stays
+     *           the same for the life of the arena.
+    ** Params:   None
+    ** Returns:  void *: start of the block, nullptr if not open.
+    *********************************************************************/
+    void *getBase() const;
+
+
+    /********************************************************************
+    ** Function: grow: Makes sure the first bytes of the block can be
+     *           used, lengthening the file if they are past its end.
+     *           Bytes already in the block are left where they are.
+    ** Params:   size_t bytes: size the block must have.
+    ** Returns:  bool: false if the file could not grow that far.
+    *********************************************************************/
+    bool grow(size_t bytes);
+
+
+    /********************************************************************
+    ** Function: adviseSequential: Tells the kernel the used part of the
+     *           block is about to be read front to back, so it reads
+     *           ahead aggressively and drops pages behind the scan.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void adviseSequential() const;
+
+
+    /********************************************************************
+    ** Function: getFileSize: Returns bytes of the backing file.
+    ** Params:   None
+    ** Returns:  size_t: file size.
+    *********************************************************************/
+    size_t getFileSize() const;
+
+private:
+    //Arenas own a mapping, so they can not be copied
+    MappedArena(const MappedArena &);
+    MappedArena &operator=(const MappedArena &);
+};
+
+#endif
@@ -0,0 +1,144 @@
+/*********************************************************************
+** Program name: MemoryUsage.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 8:15 AM
+** Description: Class implementation file for MemoryUsage class.
+ *              MemoryUsage reads how much memory the whole process
+ *              holds from the operating system: its resident set now
+ *              and at its peak, from /proc/self/status on Linux. It
+ *              also measures the heap bytes behind a string, which
+ *              short strings kept inside the string object do not
+ *              have.
+*********************************************************************/
+
+
+#include "MemoryUsage.hpp"
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <sys/resource.h>
+
+//Process status file, sizes in it are in kB
+static const char *const STATUS_FILE = "/proc/self/status";
+static const int64_t BYTES_PER_KB = 1024;
+
+/********************************************************************
+** Function: getResidentBytes: Returns the bytes of memory the
+ *           process has resident right now.
+** Params:   None
+** Returns:  int64_t: resident bytes, -1 if unknown.
+*********************************************************************/
+int64_t MemoryUsage::getResidentBytes()
+{
+    return readStatus("VmRSS:");
+}
+
+
+/********************************************************************
+** Function: getPeakResidentBytes: Returns the most bytes of memory
+ *           the process has had resident at once.
+** Params:   None
+** Returns:  int64_t: peak resident bytes, -1 if unknown.
+*********************************************************************/
+int64_t MemoryUsage::getPeakResidentBytes()
+{
+    int64_t peak = readStatus("VmHWM:");
+    if (peak >= 0)
+    {
+        return peak;
+    }
+
+    //without /proc, Linux still reports the peak in kB here
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0 && usage.ru_maxrss > 0)
+    {
+        return static_cast<int64_t>(usage.ru_maxrss) * BYTES_PER_KB;
+    }
+    return -1;
+}
+
+
+/********************************************************************
+** Function: getHeapBytes: Returns the bytes a string holds on the
+ *           heap, counting unused capacity and the terminator.
+** Params:   const string &text: string to measure.
+** Returns:  size_t: heap bytes, 0 if it is kept inside the string.
+*********************************************************************/
+size_t MemoryUsage::getHeapBytes(const std::string &text)
+{
+    //a short string's characters live inside the string object
+    const char *object = reinterpret_cast<const char *>(&text);
+    const char *characters = text.data();
+    if (characters >= object && characters < object + sizeof(text))
+    {
+        return 0;
+    }
+
+    return text.capacity() + 1;
+}
+
+
+/********************************************************************
+** Function: print: Prints the resident and peak resident memory.
+** Params:   std::ostream &out: stream to print to.
+** Returns:  None
+*********************************************************************/
+void MemoryUsage::print(std::ostream &out)
+{
+    const double BYTES_PER_MB = 1024.0 * 1024.0;
+
+    int64_t resident = getResidentBytes();
+    int64_t peak = getPeakResidentBytes();
+
+    std::ostringstream line;
+    line << std::fixed << std::setprecision(2) << "Resident memory: ";
+    if (resident >= 0)
+    {
+        line << resident / BYTES_PER_MB << " MB";
+    }
+    else
+    {
+        line << "unknown";
+    }
+    line << ", peak ";
+    if (peak >= 0)
+    {
+        line << peak / BYTES_PER_MB << " MB";
+    }
+    else
+    {
+        line << "unknown";
+    }
+
+    out << line.str() << std::endl;
+}
+
+
+/********************************************************************
+** Function: readStatus: Reads one size from /proc/self/status.
+** Params:   const string &field: field name, such as "VmRSS:".
+** Returns:  int64_t: the size in bytes, -1 if it could not be read.
+*********************************************************************/
+int64_t MemoryUsage::readStatus(const std::string &field)
+{
+    std::ifstream status(STATUS_FILE);
+    std::string line;
+    while (getline(status, line))
+    {
+        if (line.compare(0, field.size(), field) != 0)
+        {
+            continue;
+        }
+
+        //such as "VmRSS:      3412 kB"
+        std::istringstream value(line.substr(field.size()));
+        int64_t kilobytes;
+        if (value >> kilobytes)
+        {
+            return kilobytes * BYTES_PER_KB;
+        }
+        return -1;
+    }
+
+    return -1;
+}
@@ -0,0 +1,70 @@
+/*********************************************************************
+** Program name: MemoryUsage.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 8:15 AM
+** Description: Class specification file for MemoryUsage class.
+ *              MemoryUsage reads how much memory the whole process
+ *              holds from the operating system: its resident set now
+ *              and at its peak, from /proc/self/status on Linux. It
+ *              also measures the heap bytes behind a string, which
+ *              short strings kept inside the string object do not
+ *              have.
+*********************************************************************/
+
+
+#ifndef MEMORY_USAGE_HPP
+#define MEMORY_USAGE_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+class MemoryUsage
+{
+public:
+
+    /********************************************************************
+    ** Function: getResidentBytes: Returns the bytes of memory the
+     *           process has resident right now.
+    ** Params:   None
+    ** Returns:  int64_t: resident bytes, -1 if unknown.
+    *********************************************************************/
+    static int64_t getResidentBytes();
+
+
+    /********************************************************************
+    ** Function: getPeakResidentBytes: Returns the most bytes of memory
+     *           the process has had resident at once.
+    ** Params:   None
+    ** Returns:  int64_t: peak resident bytes, -1 if unknown.
+    *********************************************************************/
+    static int64_t getPeakResidentBytes();
+
+
+    /********************************************************************
+    ** Function: getHeapBytes: Returns the bytes a string holds on the
+     *           heap, counting unused capacity and the terminator.
+    ** Params:   const string &text: string to measure.
+    ** Returns:  size_t: heap bytes, 0 if it is kept inside the string.
+    *********************************************************************/
+    static size_t getHeapBytes(const std::string &text);
+
+
+    /********************************************************************
+    ** Function: print: Prints the resident and peak resident memory.
+    ** Params:   std::ostream &out: stream to print to.
+    ** Returns:  None
+    *********************************************************************/
+    static void print(std::ostream &out = std::cout);
+
+private:
+
+    /********************************************************************
+    ** Function: readStatus: Reads one size from /proc/self/status.
+    ** Params:   const string &field: field name, such as "VmRSS:".
+    ** Returns:  int64_t: the size in bytes, -1 if it could not be read.
+    *********************************************************************/
+    static int64_t readStatus(const std::string &field);
+};
+
+#endif
@@ -0,0 +1,269 @@
+/*********************************************************************
+** Program name: Money.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 1:10 AM
+** Description: Class implementation file for Money class. Money is a
+ *              fixed-point amount of dollars, kept as a whole number
+ *              of cents in a 64-bit integer. Every cash flow in the
+ *              zoo goes through it, so fractional payoffs and feeding
+ *              costs are never truncated, and sums come out the same
+ *              in any order, on any compiler. Dollar amounts are
+ *              rounded to the nearest cent once, when they become
+ *              Money. Sums and products are checked, and clamp to
+ *              the largest or smallest amount instead of wrapping.
+ *              A clamped amount, and every amount worked out from
+ *              it, is marked, so reports can say it is not exact.
+*********************************************************************/
+
+
+#include "Money.hpp"
+#include "CheckedMath.hpp"
+#include <cmath>
+#include <string>
+
+//Initialize constants
+const int Money::CENTS_PER_DOLLAR = 100;
+const int Money::MAX_TEXT_SIZE = 21;
+
+/********************************************************************
+** Function: Constructor/default: Initializes to $0.00.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+Money::Money() : cents(0), clamped(false)
+{}
+
+
+/********************************************************************
+** Function: fromDollars: Returns dollars rounded to the nearest
+ *           cent.
+** Params:   double dollars: amount in dollars.
+** Returns:  Money: the amount.
+*********************************************************************/
+Money Money::fromDollars(double dollars)
+{
+    return fromCents(std::llround(dollars * CENTS_PER_DOLLAR));
+}
+
+
+/********************************************************************
+** Function: fromCents: Returns an amount of whole cents.
+** Params:   int64_t cents: amount in cents.
+** Returns:  Money: the amount.
+*********************************************************************/
+Money Money::fromCents(int64_t cents)
+{
+    Money amount;
+    amount.cents = cents;
+    return amount;
+}
+
+
+/********************************************************************
+** Function: getCents: Returns the amount in cents.
+** Params:   None
+** Returns:  int64_t: cents.
+*********************************************************************/
+int64_t Money::getCents() const
+{
+    return cents;
+}
+
+
+/********************************************************************
+** Function: toDollars: Returns the amount in dollars, for reports
+ *           and statistics only.
+** Params:   None
+** Returns:  double: dollars.
+*********************************************************************/
+double Money::toDollars() const
+{
+    return static_cast<double>(cents) / CENTS_PER_DOLLAR;
+}
+
+
+/********************************************************************
+** Function: wasClamped: Returns true if the amount, or any amount
+ *           added, subtracted, or multiplied into it, clamped at a
+ *           64-bit limit.
+** Params:   None
+** Returns:  bool: true if the amount is not exact.
+*********************************************************************/
+bool Money::wasClamped() const
+{
+    return clamped;
+}
+
+
+/********************************************************************
+** Function: toText: Writes the amount as dollars into text, the way
+ *           operator<< writes it, without allocating, so a forked
+ *           child can call it. Whole amounts are written without
+ *           cents, such as 2005, like the game always showed them,
+ *           and others with exactly two decimal places, such as
+ *           -12.05.
+** Params:   char *text: room for at least MAX_TEXT_SIZE chars.
+** Returns:  int: chars written, with no null at the end.
+*********************************************************************/
+int Money::toText(char *text) const
+{
+    const int MAX_DIGITS = 20;      //digits of the largest uint64_t
+
+    //negate as unsigned so the most negative amount still prints
+    uint64_t magnitude = cents < 0 ? 0 - static_cast<uint64_t>(cents)
+                                   : static_cast<uint64_t>(cents);
+    uint64_t dollars = magnitude / CENTS_PER_DOLLAR;
+    uint64_t fraction = magnitude % CENTS_PER_DOLLAR;
+
+    //digits come out last first
+    char digits[MAX_DIGITS];
+    int num_digits = 0;
+    do
+    {
+        digits[num_digits++] = static_cast<char>('0' + dollars % 10);
+        dollars /= 10;
+    } while (dollars > 0);
+
+    int size = 0;
+    if (cents < 0)
+    {
+        text[size++] = '-';
+    }
+    while (num_digits > 0)
+    {
+        text[size++] = digits[--num_digits];
+    }
+    if (fraction != 0)
+    {
+        text[size++] = '.';
+        text[size++] = static_cast<char>('0' + fraction / 10);
+        text[size++] = static_cast<char>('0' + fraction % 10);
+    }
+    return size;
+}
+
+
+/********************************************************************
+** Function: operator+=: Adds an amount.
+** Params:   const Money &amount: amount to add.
+** Returns:  Money &: this amount.
+*********************************************************************/
+Money &Money::operator+=(const Money &amount)
+{
+    clamped = !CheckedMath::add(cents, amount.cents, cents)
+                || clamped || amount.clamped;
+    return *this;
+}
+
+
+/********************************************************************
+** Function: operator-=: Subtracts an amount.
+** Params:   const Money &amount: amount to subtract.
+** Returns:  Money &: this amount.
+*********************************************************************/
+Money &Money::operator-=(const Money &amount)
+{
+    //negating the most negative amount would overflow, clamp instead
+    if (amount.cents == INT64_MIN)
+    {
+        clamped = clamped || amount.clamped || cents >= 0;
+        cents = cents < 0 ? cents - INT64_MIN : INT64_MAX;
+        return *this;
+    }
+    clamped = !CheckedMath::add(cents, -amount.cents, cents)
+                || clamped || amount.clamped;
+    return *this;
+}
+
+
+/********************************************************************
+** Function: operator+: Returns the sum.
+** Params:   const Money &amount: other amount.
+** Returns:  Money: the result.
+*********************************************************************/
+Money Money::operator+(const Money &amount) const
+{
+    Money sum = *this;
+    return sum += amount;
+}
+
+
+/********************************************************************
+** Function: operator-: Returns the difference.
+** Params:   const Money &amount: other amount.
+** Returns:  Money: the result.
+*********************************************************************/
+Money Money::operator-(const Money &amount) const
+{
+    Money difference = *this;
+    return difference -= amount;
+}
+
+
+/********************************************************************
+** Function: operator*: Returns the amount times a count, such as
+ *           one animal's payoff times the animals in an exhibit.
+** Params:   int64_t count: number of times to count the amount.
+** Returns:  Money: the result.
+*********************************************************************/
+Money Money::operator*(int64_t count) const
+{
+    int64_t product;
+    bool exact = CheckedMath::multiply(cents, count, product);
+    Money result = fromCents(product);
+    result.clamped = !exact || clamped;
+    return result;
+}
+
+
+/********************************************************************
+** Function: Comparison operators: Compare two amounts.
+** Params:   const Money &amount: other amount.
+** Returns:  bool: result of comparing the cents.
+*********************************************************************/
+bool Money::operator==(const Money &amount) const
+{
+    return cents == amount.cents;
+}
+
+bool Money::operator!=(const Money &amount) const
+{
+    return cents != amount.cents;
+}
+
+bool Money::operator<(const Money &amount) const
+{
+    return cents < amount.cents;
+}
+
+bool Money::operator>(const Money &amount) const
+{
+    return cents > amount.cents;
+}
+
+bool Money::operator<=(const Money &amount) const
+{
+    return cents <= amount.cents;
+}
+
+bool Money::operator>=(const Money &amount) const
+{
+    return cents >= amount.cents;
+}
+
+
+/********************************************************************
+** Function: operator<<: Writes the amount as dollars, whatever the
+ *           stream's formatting flags are. Whole amounts are written
+ *           without cents, such as 2005, like the game always showed
+ *           them, and others with exactly two decimal places, such
+ *           as -12.05.
+** Params:   std::ostream &out: stream to write to.
+ *           const Money &amount: amount to write.
+** Returns:  std::ostream &: the stream.
+*********************************************************************/
+std::ostream &operator<<(std::ostream &out, const Money &amount)
+{
+    char text[Money::MAX_TEXT_SIZE];
+    return out << std::string(text, amount.toText(text));
+}
@@ -0,0 +1,154 @@
+/*********************************************************************
+** Program name: Money.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 1:10 AM
+** Description: Class specification file for Money class. Money is a
+ *              fixed-point amount of dollars, kept as a whole number
+ *              of cents in a 64-bit integer. Every cash flow in the
+ *              zoo goes through it, so fractional payoffs and feeding
+ *              costs are never truncated, and sums come out the same
+ *              in any order, on any compiler. Dollar amounts are
+ *              rounded to the nearest cent once, when they become
+ *              Money. Sums and products are checked, and clamp to
+ *              the largest or smallest amount instead of wrapping.
+ *              A clamped amount, and every amount worked out from
+ *              it, is marked, so reports can say it is not exact.
+*********************************************************************/
+
+
+#ifndef MONEY_HPP
+#define MONEY_HPP
+
+#include <cstdint>
+#include <ostream>
+
+class Money
+{
+public:
+    //Cents in one dollar
+    static const int CENTS_PER_DOLLAR;
+    //Longest text an amount is written as, -92233720368547758.08
+    static const int MAX_TEXT_SIZE;
+
+private:
+    int64_t cents;
+    bool clamped;       //true if this or any amount it came from clamped
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor/default: Initializes to $0.00.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    Money();
+
+
+    /********************************************************************
+    ** Function: fromDollars: Returns dollars rounded to the nearest
+     *           cent.
+    ** Params:   double dollars: amount in dollars.
+    ** Returns:  Money: the amount.
+    *********************************************************************/
+    static Money fromDollars(double dollars);
+
+
+    /********************************************************************
+    ** Function: fromCents: Returns an amount of whole cents.
+    ** Params:   int64_t cents: amount in cents.
+    ** Returns:  Money: the amount.
+    *********************************************************************/
+    static Money fromCents(int64_t cents);
+
+
+    /********************************************************************
+    ** Function: getCents: Returns the amount in cents.
+    ** Params:   None
+    ** Returns:  int64_t: cents.
+    *********************************************************************/
+    int64_t getCents() const;
+
+
+    /********************************************************************
+    ** Function: toDollars: Returns the amount in dollars, for reports
+     *           and statistics only.
+    ** Params:   None
+    ** Returns:  double: dollars.
+    *********************************************************************/
+    double toDollars() const;
+
+
+    /********************************************************************
+    ** Function: wasClamped: Returns true if the amount, or any amount
+     *           added, subtracted, or multiplied into it, clamped at a
+     *           64-bit limit.
+    ** Params:   None
+    ** Returns:  bool: true if the amount is not exact.
+    *********************************************************************/
+    bool wasClamped() const;
+
+
+    /********************************************************************
+    ** Function: toText: Writes the amount as dollars into text, the way
+     *           operator<< writes it, without allocating, so a forked
+     *           child can call it.
+    ** Params:   char *text: room for at least MAX_TEXT_SIZE chars.
+    ** Returns:  int: chars written, with no null at the end.
+    *********************************************************************/
+    int toText(char *text) const;
+
+
+    /********************************************************************
+    ** Function: operator+=, operator-=: Adds or subtracts an amount.
+    ** Params:   const Money &amount: amount to add or subtract.
+    ** Returns:  Money &: this amount.
+    *********************************************************************/
+    Money &operator+=(const Money &amount);
+    Money &operator-=(const Money &amount);
+
+
+    /********************************************************************
+    ** Function: operator+, operator-: Returns the sum or difference.
+    ** Params:   const Money &amount: other amount.
+    ** Returns:  Money: the result.
+    *********************************************************************/
+    Money operator+(const Money &amount) const;
+    Money operator-(const Money &amount) const;
+
+
+    /********************************************************************
+    ** Function: operator*: Returns the amount times a count, such as
+     *           one animal's payoff times the animals in an exhibit.
+    ** Params:   int64_t count: number of times to count the amount.
+    ** Returns:  Money: the result.
+    *********************************************************************/
+    Money operator*(int64_t count) const;
+
+
+    /********************************************************************
+    ** Function: Comparison operators: Compare two amounts.
+    ** Params:   const Money &amount: other amount.
+    ** Returns:  bool: result of comparing the cents.
+    *********************************************************************/
+    bool operator==(const Money &amount) const;
+    bool operator!=(const Money &amount) const;
+    bool operator<(const Money &amount) const;
+    bool operator>(const Money &amount) const;
+    bool operator<=(const Money &amount) const;
+    bool operator>=(const Money &amount) const;
+};
+
+
+/********************************************************************
+** Function: operator<<: Writes the amount as dollars, whatever the
+ *           stream's formatting flags are. Whole amounts are written
+ *           without cents, such as 2005, like the game always showed
+ *           them, and others with exactly two decimal places, such
+ *           as -12.05.
+** Params:   std::ostream &out: stream to write to.
+ *           const Money &amount: amount to write.
+** Returns:  std::ostream &: the stream.
+*********************************************************************/
+std::ostream &operator<<(std::ostream &out, const Money &amount);
+
+#endif
@@ -4,25 +4,67 @@
 ** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
 ** Date: Apr 07, 2019 at 4:59 PM
 ** Description: Class implementation file for MyRandom class. MyRandom
- *              is a helper class with static functions that utilize
- *              srand() and rand() to generate random numbers. It can
- *              seed the number generator, as well as generate a
- *              random integer within a specified range.
+ *              is a helper class with static functions that
+ *              generate random numbers the way glibc's srand() and
+ *              rand() do, giving the same sequences, but with one
+ *              generator per thread, so zoos on different threads
+ *              neither share a lock nor disturb each other's
+ *              sequence. It can seed the number generator, as well
+ *              as generate a random integer within a specified range.
 *********************************************************************/
 
 
 #include "MyRandom.hpp"
 
+//Initialize constants
+const int MyRandom::MAX_DRAW = 2147483647;
+
+//Initialize static members
+thread_local int32_t MyRandom::state[MyRandom::STATE_SIZE];
+thread_local int MyRandom::front = MyRandom::SEPARATION;
+thread_local int MyRandom::rear = 0;
+thread_local bool MyRandom::seeded = false;
+
 /********************************************************************
-** Function: seed globally seeds random number generator with
- *           srand(). This is a static class function.
-** Params:  unsigned int the_seed - unsigned int used to seed srand()
+** Function: seed seeds the calling thread's random number
+ *           generator, as srand() would. This is a static class
+ *           function.
+** Params:  unsigned int the_seed - unsigned int used to seed it
  *          default = time(0)
 ** Returns: void
 *********************************************************************/
 void MyRandom::seed(unsigned int the_seed)
 {
-    srand(the_seed);
+    //Park-Miller steps, computed without overflow by Schrage's method
+    const int32_t MULTIPLIER = 16807;
+    const int32_t QUOTIENT = 127773;
+    const int32_t REMAINDER = 2836;
+    //glibc throws away this many draws per word of state
+    const int WARM_UP_DRAWS = STATE_SIZE * 10;
+
+    //a zero seed would leave every word zero
+    int32_t word = the_seed == 0 ? 1 : static_cast<int32_t>(the_seed);
+    state[0] = word;
+    for (int i=1; i<STATE_SIZE; i++)
+    {
+        int32_t high = word / QUOTIENT;
+        int32_t low = word % QUOTIENT;
+        word = MULTIPLIER * low - REMAINDER * high;
+        if (word < 0)
+        {
+            word += MAX_DRAW;
+        }
+        state[i] = word;
+    }
+
+    front = SEPARATION;
+    rear = 0;
+    seeded = true;
+
+    for (int i=0; i<WARM_UP_DRAWS; i++)
+    {
+        draw();
+    }
 }
 
 
@@ -39,5 +81,63 @@ void MyRandom::seed(unsigned int the_seed)
 *********************************************************************/
 int MyRandom::randomInteger(int range_start, int range_end)
 {
-    return (rand() % (range_end - range_start + 1)) + range_start;
+    return (draw() % (range_end - range_start + 1)) + range_start;
+}
+
+
+/********************************************************************
+** Function: randomLong generates a random 64-bit integer within
+ *           provided range. Ranges that fit randomInteger use one
+ *           draw and give the same number it would. Wider
+ *           ranges combine several calls. This is a static class
+ *           function.
+** Params:  int64_t range_start - lowest valid value in range.
+ *          int64_t range_end - highest valid value in range.
+** Returns: int64_t - the randomly chosen integer in specified range.
+*********************************************************************/
+int64_t MyRandom::randomLong(int64_t range_start, int64_t range_end)
+{
+    //one call covers ranges up to MAX_DRAW + 1
+    const uint64_t CALL_RANGE = static_cast<uint64_t>(MAX_DRAW) + 1;
+
+    uint64_t range = static_cast<uint64_t>(range_end)
+                        - static_cast<uint64_t>(range_start) + 1;
+    uint64_t drawn = static_cast<uint64_t>(draw());
+    uint64_t draw_range = CALL_RANGE;
+
+    //add another call's worth of digits until the range is covered
+    while (draw_range < range && draw_range <= UINT64_MAX / CALL_RANGE)
+    {
+        drawn = drawn * CALL_RANGE + static_cast<uint64_t>(draw());
+        draw_range *= CALL_RANGE;
+    }
+
+    return static_cast<int64_t>(static_cast<uint64_t>(range_start)
+                                    + drawn % range);
+}
+
+
+/********************************************************************
+** Function: draw returns the next number of the calling thread's
+ *           generator, as rand() would, seeding it with 1 first if
+ *           the thread never seeded it, as glibc does.
+** Params:  None
+** Returns: int - number from 0 to MAX_DRAW.
+*********************************************************************/
+int MyRandom::draw()
+{
+    if (!seeded)
+    {
+        seed(1);
+    }
+
+    //words add with 32-bit wraparound, and the low bit is dropped
+    uint32_t sum = static_cast<uint32_t>(state[front])
+                    + static_cast<uint32_t>(state[rear]);
+    state[front] = static_cast<int32_t>(sum);
+
+    front = (front + 1) % STATE_SIZE;
+    rear = (rear + 1) % STATE_SIZE;
+
+    return static_cast<int>(sum >> 1);
 }
\ No newline at end of file
@@ -4,10 +4,13 @@
 ** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
 ** Date: Apr 07, 2019 at 4:59 PM
 ** Description: Class specification file for MyRandom class. MyRandom
- *              is a helper class with static functions that utilize
- *              srand() and rand() to generate random numbers. It can
- *              seed the number generator, as well as generate a
- *              random integer within a specified range.
+ *              is a helper class with static functions that
+ *              generate random numbers the way glibc's srand() and
+ *              rand() do, giving the same sequences, but with one
+ *              generator per thread, so zoos on different threads
+ *              neither share a lock nor disturb each other's
+ *              sequence. It can seed the number generator, as well
+ *              as generate a random integer within a specified range.
 *********************************************************************/
 
 
@@ -16,15 +19,31 @@
 
 #include <cstdlib>
 #include <ctime>
+#include <cstdint>
 
 class MyRandom
 {
+public:
+    //Largest number a single draw gives, RAND_MAX on glibc
+    static const int MAX_DRAW;
+
+private:
+    //glibc's additive feedback generator: 31 words, taps 3 apart
+    static const int STATE_SIZE = 31;
+    static const int SEPARATION = 3;
+
+    static thread_local int32_t state[STATE_SIZE];
+    static thread_local int front;      //word updated by the next draw
+    static thread_local int rear;       //word added to it
+    static thread_local bool seeded;    //false until this thread seeds
+
 public:
 
     /********************************************************************
-    ** Function: seed globally seeds random number generator with
-     *           srand(). This is a static class function.
-    ** Params:  unsigned int the_seed - unsigned int used to seed srand()
+    ** Function: seed seeds the calling thread's random number
+     *           generator, as srand() would. This is a static class
+     *           function.
+    ** Params:  unsigned int the_seed - unsigned int used to seed it
      *          default = time(0)
     ** Returns: void
     *********************************************************************/
@@ -43,6 +62,30 @@ public:
      *           9th ed. Gaddis, et al. Page 135
     *********************************************************************/
     static int randomInteger(int range_start, int range_end);
+
+
+    /********************************************************************
+    ** Function: randomLong generates a random 64-bit integer within
+     *           provided range. Ranges that fit randomInteger use one
+     *           draw and give the same number it would. Wider
+     *           ranges combine several calls. This is a static class
+     *           function.
+    ** Params:  int64_t range_start - lowest valid value in range.
+     *          int64_t range_end - highest valid value in range.
+    ** Returns: int64_t - the randomly chosen integer in specified range.
+    *********************************************************************/
+    static int64_t randomLong(int64_t range_start, int64_t range_end);
+
+private:
+
+    /********************************************************************
+    ** Function: draw returns the next number of the calling thread's
+     *           generator, as rand() would, seeding it with 1 first if
+     *           the thread never seeded it, as glibc does.
+    ** Params:  None
+    ** Returns: int - number from 0 to MAX_DRAW.
+    *********************************************************************/
+    static int draw();
 };
 
 #endif
\ No newline at end of file
@@ -12,8 +12,8 @@
  *              a time, have the same feeding cost as the base food
  *              cost, and generate 10% of their purchasing cost as
  *              payoff. They inherit all data members and functions
- *              of Animal, with the addition of a string for their
- *              name, "Penguin", and a function to get their name.
+ *              of Animal, and read their name, "Penguin", and traits
+ *              from the species registry.
 *********************************************************************/
 
 
@@ -21,33 +21,24 @@
 
 /********************************************************************
 ** Function: Constructor/default: Sets age of penguin to argument.
- *           Sets name, cost, number of babies, feeding cost, and
- *           payoff with constant default values.
+ *           Name, cost, number of babies, feeding cost, and
+ *           payoff are shared by all penguins in the species registry.
 ** Params:   int age: age of penguin.
  *          default = 0;
 ** Returns: None
 *********************************************************************/
-Penguin::Penguin(int age)
-{
-    this->age = age;
-    name = DEFAULTS[PENGUIN].default_name;
-    cost = DEFAULTS[PENGUIN].default_cost;
-    num_babies = DEFAULTS[PENGUIN].default_num_babies;
-    feeding_cost = DEFAULTS[PENGUIN].default_food_cost_multiplier
-                   * getBaseFoodCost();
-    payoff = DEFAULTS[PENGUIN].default_cost
-            * DEFAULTS[PENGUIN].default_payoff_percentage;
-}
+Penguin::Penguin(int age) : Animal(PENGUIN, age)
+{}
 
 
 /********************************************************************
 ** Function: getName: Returns name of animal.
 ** Params:   None
-** Returns:  string name: "Penguin"
+** Returns:  const string &name: "Penguin"
 *********************************************************************/
-std::string Penguin::getName() const
+const std::string &Penguin::getName() const
 {
-    return name;
+    return getTraits().name;
 }
 
 
@@ -58,5 +49,5 @@ std::string Penguin::getName() const
 *********************************************************************/
 double Penguin::getFeedingCost() const
 {
-    return feeding_cost;
+    return getTraits().feeding_cost;
 }
@@ -12,8 +12,8 @@
  *              a time, have the same feeding cost as the base food
  *              cost, and generate 10% of their purchasing cost as
  *              payoff. They inherit all data members and functions
- *              of Animal, with the addition of a string for their
- *              name, "Penguin", and a function to get their name.
+ *              of Animal, and read their name, "Penguin", and traits
+ *              from the species registry.
 *********************************************************************/
 
 
@@ -23,18 +23,14 @@
 #include "Animal.hpp"
 #include <string>
 
-class Penguin : public Animal
+class Penguin final : public Animal
 {
-protected:
-    std::string name;
-    double feeding_cost;
-
 public:
 
     /********************************************************************
     ** Function: Constructor/default: Sets age of penguin to argument.
-     *           Sets name, cost, number of babies, feeding cost, and
-     *           payoff with constant default values.
+     *           Name, cost, number of babies, feeding cost, and
+     *           payoff are shared by all penguins in the species registry.
     ** Params:   int age: age of penguin.
      *          default = 0;
     ** Returns: None
@@ -45,9 +41,9 @@ public:
     /********************************************************************
     ** Function: getName: Returns name of animal.
     ** Params:   None
-    ** Returns:  string name: "Penguin"
+    ** Returns:  const string &name: "Penguin"
     *********************************************************************/
-    virtual std::string getName() const override;
+    virtual const std::string &getName() const override final;
 
 
     /********************************************************************
@@ -55,7 +51,7 @@ public:
     ** Params:   None
     ** Returns:  double feeding_cost.
     *********************************************************************/
-    virtual double getFeedingCost() const override;
+    virtual double getFeedingCost() const override final;
 
 };
 
@@ -0,0 +1,229 @@
+/*********************************************************************
+** Program name: PerfCounters.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 6:45 AM
+** Description: Class implementation file for PerfCounters class.
+ *              PerfCounters reads the CPU's hardware counters for
+ *              cycles, instructions, cache misses, and branch misses
+ *              through Linux's perf_event_open, as one group so all
+ *              four are read together. The counters count the thread
+ *              that opened them, in user space only. Counters the
+ *              CPU, kernel, or container does not allow are reported
+ *              as unavailable, and if none can be opened everything
+ *              keeps working without them. PhaseTimer scopes add each
+ *              phase's counts to per-phase totals, and Benchmark
+ *              reads them around every timed batch.
+*********************************************************************/
+
+
+#include "PerfCounters.hpp"
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+//Initialize constants
+const char *const PerfCounters::COUNTER_NAMES[] =
+        {"cycles", "instructions", "cache-misses", "branch-misses"};
+const PerfCounters::Sample PerfCounters::ZERO_SAMPLE = {{0, 0, 0, 0}};
+
+//Initialize static members
+thread_local int PerfCounters::group_fd = -1;
+thread_local int PerfCounters::fds[PerfCounters::NUM_COUNTERS] =
+        {-1, -1, -1, -1};
+bool PerfCounters::available[PerfCounters::NUM_COUNTERS];
+int PerfCounters::group_index[PerfCounters::NUM_COUNTERS];
+int PerfCounters::num_open = 0;
+std::string PerfCounters::error;
+
+//perf event of each counter, in the order of Counter
+static const uint64_t EVENT_CONFIGS[] =
+        {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+         PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+/********************************************************************
+** Function: openEvent: Opens one hardware counter of the calling
+ *           thread, in user space only.
+** Params:   uint64_t config: hardware event to count.
+ *           int group: fd of the group leader, -1 to lead a group.
+** Returns:  int: fd of the counter, -1 with errno set on failure.
+*********************************************************************/
+static int openEvent(uint64_t config, int group)
+{
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.read_format = PERF_FORMAT_GROUP;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    //this thread, on any CPU
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1,
+                                    group, 0));
+}
+
+
+/********************************************************************
+** Function: open: Opens every counter this machine allows, for
+ *           the calling thread.
+** Params:   None
+** Returns:  bool: true if at least one counter opened.
+*********************************************************************/
+bool PerfCounters::open()
+{
+    close();
+    error.clear();
+
+    for (int i=0; i<NUM_COUNTERS; i++)
+    {
+        int fd = openEvent(EVENT_CONFIGS[i], group_fd);
+        fds[i] = fd;
+        available[i] = fd >= 0;
+        if (!available[i])
+        {
+            //keep the first reason, the rest are usually the same
+            if (error.empty())
+            {
+                error = std::string(COUNTER_NAMES[i]) + ": "
+                        + std::strerror(errno);
+            }
+            continue;
+        }
+
+        group_index[i] = num_open++;
+        if (group_fd < 0)
+        {
+            group_fd = fd;
+        }
+    }
+
+    return group_fd >= 0;
+}
+
+
+/********************************************************************
+** Function: close: Closes this thread's counters.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void PerfCounters::close()
+{
+    for (int i=0; i<NUM_COUNTERS; i++)
+    {
+        if (fds[i] >= 0)
+        {
+            ::close(fds[i]);
+            fds[i] = -1;
+        }
+        available[i] = false;
+    }
+    group_fd = -1;
+    num_open = 0;
+}
+
+
+/********************************************************************
+** Function: isOpen: Returns true if this thread has counters open.
+** Params:   None
+** Returns:  bool: true if read can succeed.
+*********************************************************************/
+bool PerfCounters::isOpen()
+{
+    return group_fd >= 0;
+}
+
+
+/********************************************************************
+** Function: isAvailable: Returns true if a counter opened.
+** Params:   Counter counter: counter to check.
+** Returns:  bool: true if it is counted.
+*********************************************************************/
+bool PerfCounters::isAvailable(Counter counter)
+{
+    return available[counter];
+}
+
+
+/********************************************************************
+** Function: getError: Returns why counters are unavailable.
+** Params:   None
+** Returns:  const std::string &: the reason, empty if all opened.
+*********************************************************************/
+const std::string &PerfCounters::getError()
+{
+    return error;
+}
+
+
+/********************************************************************
+** Function: read: Reads every open counter. Counters that are not
+ *           available read as 0.
+** Params:   Sample &sample: set to the counts.
+** Returns:  bool: false if no counters are open.
+*********************************************************************/
+bool PerfCounters::read(Sample &sample)
+{
+    //a group read gives the number of counters, then each value
+    uint64_t buffer[1 + NUM_COUNTERS];
+
+    sample = ZERO_SAMPLE;
+    if (group_fd < 0
+            || ::read(group_fd, buffer, sizeof(buffer)) < 0)
+    {
+        return false;
+    }
+
+    for (int i=0; i<NUM_COUNTERS; i++)
+    {
+        if (available[i])
+        {
+            sample.values[i] = static_cast<int64_t>(
+                                    buffer[1 + group_index[i]]);
+        }
+    }
+    return true;
+}
+
+
+/********************************************************************
+** Function: addDifference: Adds the counts between two samples to
+ *           a total.
+** Params:   const Sample &start: earlier sample.
+ *           const Sample &end: later sample.
+ *           Sample &total: total to add to.
+** Returns:  None
+*********************************************************************/
+void PerfCounters::addDifference(const Sample &start, const Sample &end,
+                                    Sample &total)
+{
+    for (int i=0; i<NUM_COUNTERS; i++)
+    {
+        total.values[i] += end.values[i] - start.values[i];
+    }
+}
+
+
+/********************************************************************
+** Function: printStatus: Prints which counters are counted, and
+ *           why any are not.
+** Params:   std::ostream &out: stream to print to.
+** Returns:  None
+*********************************************************************/
+void PerfCounters::printStatus(std::ostream &out)
+{
+    out << "Performance counters:";
+    for (int i=0; i<NUM_COUNTERS; i++)
+    {
+        out << " " << COUNTER_NAMES[i]
+                << (available[i] ? "" : " (unavailable)");
+    }
+    out << std::endl;
+
+    if (!error.empty())
+    {
+        out << "Performance counters unavailable: " << error << std::endl;
+    }
+}
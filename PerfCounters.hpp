@@ -0,0 +1,126 @@
+/*********************************************************************
+** Program name: PerfCounters.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 6:45 AM
+** Description: Class specification file for PerfCounters class.
+ *              PerfCounters reads the CPU's hardware counters for
+ *              cycles, instructions, cache misses, and branch misses
+ *              through Linux's perf_event_open, as one group so all
+ *              four are read together. The counters count the thread
+ *              that opened them, in user space only. Counters the
+ *              CPU, kernel, or container does not allow are reported
+ *              as unavailable, and if none can be opened everything
+ *              keeps working without them. PhaseTimer scopes add each
+ *              phase's counts to per-phase totals, and Benchmark
+ *              reads them around every timed batch.
+*********************************************************************/
+
+
+#ifndef PERF_COUNTERS_HPP
+#define PERF_COUNTERS_HPP
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+class PerfCounters
+{
+public:
+    //Hardware events counted
+    enum Counter {CYCLES, INSTRUCTIONS, CACHE_MISSES, BRANCH_MISSES,
+                    NUM_COUNTERS};
+
+    //Name of each counter, in the order of Counter
+    static const char *const COUNTER_NAMES[];
+
+    //Value of every counter at one time, or counted over a span
+    struct Sample
+    {
+        int64_t values[NUM_COUNTERS];
+    };
+
+    //Sample of all zeros
+    static const Sample ZERO_SAMPLE;
+
+private:
+    static thread_local int group_fd;   //first counter opened, -1 if none
+    static thread_local int fds[NUM_COUNTERS];  //-1 if not open
+    static bool available[NUM_COUNTERS];
+    static int group_index[NUM_COUNTERS];   //place in a group read
+    static int num_open;
+    static std::string error;               //why counters are missing
+
+public:
+
+    /********************************************************************
+    ** Function: open: Opens every counter this machine allows, for
+     *           the calling thread.
+    ** Params:   None
+    ** Returns:  bool: true if at least one counter opened.
+    *********************************************************************/
+    static bool open();
+
+
+    /********************************************************************
+    ** Function: close: Closes this thread's counters.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    static void close();
+
+
+    /********************************************************************
+    ** Function: isOpen: Returns true if this thread has counters open.
+    ** Params:   None
+    ** Returns:  bool: true if read can succeed.
+    *********************************************************************/
+    static bool isOpen();
+
+
+    /********************************************************************
+    ** Function: isAvailable: Returns true if a counter opened.
+    ** Params:   Counter counter: counter to check.
+    ** Returns:  bool: true if it is counted.
+    *********************************************************************/
+    static bool isAvailable(Counter counter);
+
+
+    /********************************************************************
+    ** Function: getError: Returns why counters are unavailable.
+    ** Params:   None
+    ** Returns:  const std::string &: the reason, empty if all opened.
+    *********************************************************************/
+    static const std::string &getError();
+
+
+    /********************************************************************
+    ** Function: read: Reads every open counter. Counters that are not
+     *           available read as 0.
+    ** Params:   Sample &sample: set to the counts.
+    ** Returns:  bool: false if no counters are open.
+    *********************************************************************/
+    static bool read(Sample &sample);
+
+
+    /********************************************************************
+    ** Function: addDifference: Adds the counts between two samples to
+     *           a total.
+    ** Params:   const Sample &start: earlier sample.
+     *           const Sample &end: later sample.
+     *           Sample &total: total to add to.
+    ** Returns:  None
+    *********************************************************************/
+    static void addDifference(const Sample &start, const Sample &end,
+                                Sample &total);
+
+
+    /********************************************************************
+    ** Function: printStatus: Prints which counters are counted, and
+     *           why any are not.
+    ** Params:   std::ostream &out: stream to print to.
+    ** Returns:  None
+    *********************************************************************/
+    static void printStatus(std::ostream &out = std::cout);
+};
+
+#endif
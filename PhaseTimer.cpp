@@ -0,0 +1,336 @@
+/*********************************************************************
+** Program name: PhaseTimer.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 4:40 AM
+** Description: Class implementation file for PhaseTimer class.
+ *              PhaseTimer times each phase of a zoo day, and each
+ *              I/O call in it, into one LatencyHistogram per phase.
+ *              A Scope times the block it is declared in. Timers are
+ *              always compiled in, but stay off until enable() is
+ *              called, and then cost one branch each. The histograms
+ *              can be printed on exit, or on SIGUSR1 at the end of
+ *              the day it arrives in. Scopes also keep track of each
+ *              thread's current phase, for AllocationTracker. While
+ *              timing, a scope also adds its phase's hardware counts
+ *              to that phase's totals if PerfCounters are open. Scopes
+ *              on any thread can record at once: the histograms take
+ *              relaxed atomic counts, and the hardware totals, which
+ *              already cost system calls to read, take a lock.
+*********************************************************************/
+
+
+#include "PhaseTimer.hpp"
+#include <algorithm>
+#include <iomanip>
+
+//Initialize constants
+const char *const PhaseTimer::PHASE_NAMES[] =
+        {"day header", "beginningOfDay", "midday", "randomEvent",
+         "endOfDay", "prompt", "event write", "event read", "autosave"};
+
+//Initialize static members
+std::atomic<bool> PhaseTimer::enabled(false);
+LatencyHistogram PhaseTimer::histograms[PhaseTimer::NUM_PHASES];
+PerfCounters::Sample PhaseTimer::phase_counters[PhaseTimer::NUM_PHASES];
+std::mutex PhaseTimer::counters_mutex;
+volatile std::sig_atomic_t PhaseTimer::dump_requested = 0;
+thread_local PhaseTimer::Phase PhaseTimer::current_phase =
+        PhaseTimer::NUM_PHASES;
+
+/********************************************************************
+** Function: Scope::Constructor: Makes phase the current phase, and
+ *           starts timing it if timers are on.
+** Params:   Phase phase: phase to time.
+** Returns:  None
+*********************************************************************/
+PhaseTimer::Scope::Scope(Phase phase)
+    : phase(phase), outer_phase(current_phase),
+        timing(enabled.load(std::memory_order_relaxed)),
+        counting(false)
+{
+    current_phase = phase;
+    if (timing)
+    {
+        counting = PerfCounters::read(start_counters);
+        start = std::chrono::steady_clock::now();
+    }
+}
+
+
+/********************************************************************
+** Function: Scope::Destructor: Records the time since construction,
+ *           and restores the phase it was started in.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+PhaseTimer::Scope::~Scope()
+{
+    current_phase = outer_phase;
+    if (timing)
+    {
+        record(phase, std::chrono::duration_cast<std::chrono::nanoseconds>
+                (std::chrono::steady_clock::now() - start).count());
+    }
+
+    PerfCounters::Sample end_counters;
+    if (counting && PerfCounters::read(end_counters))
+    {
+        std::lock_guard<std::mutex> lock(counters_mutex);
+        PerfCounters::addDifference(start_counters, end_counters,
+                                    phase_counters[phase]);
+    }
+}
+
+
+/********************************************************************
+** Function: enable: Turns the timers on or off.
+** Params:   bool on: true to time phases.
+** Returns:  None
+*********************************************************************/
+void PhaseTimer::enable(bool on)
+{
+    enabled.store(on, std::memory_order_relaxed);
+}
+
+
+/********************************************************************
+** Function: isEnabled: Returns true if the timers are on.
+** Params:   None
+** Returns:  bool: true if phases are timed.
+*********************************************************************/
+bool PhaseTimer::isEnabled()
+{
+    return enabled.load(std::memory_order_relaxed);
+}
+
+
+/********************************************************************
+** Function: currentPhase: Returns the innermost phase this thread
+ *           is in, timers on or off.
+** Params:   None
+** Returns:  Phase: the phase, NUM_PHASES if none.
+*********************************************************************/
+PhaseTimer::Phase PhaseTimer::currentPhase()
+{
+    return current_phase;
+}
+
+
+/********************************************************************
+** Function: record: Counts one run of a phase.
+** Params:   Phase phase: phase that ran.
+ *           int64_t nanoseconds: how long it took.
+** Returns:  None
+*********************************************************************/
+void PhaseTimer::record(Phase phase, int64_t nanoseconds)
+{
+    histograms[phase].record(nanoseconds);
+}
+
+
+/********************************************************************
+** Function: getHistogram: Returns the times of one phase.
+** Params:   Phase phase: phase to look up.
+** Returns:  const LatencyHistogram &: its histogram.
+*********************************************************************/
+const LatencyHistogram &PhaseTimer::getHistogram(Phase phase)
+{
+    return histograms[phase];
+}
+
+
+/********************************************************************
+** Function: reset: Forgets every time recorded.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void PhaseTimer::reset()
+{
+    std::lock_guard<std::mutex> lock(counters_mutex);
+    for (int i=0; i<NUM_PHASES; i++)
+    {
+        histograms[i].reset();
+        phase_counters[i] = PerfCounters::ZERO_SAMPLE;
+    }
+}
+
+
+/********************************************************************
+** Function: print: Prints count, mean, p50, p90, p99, and max of
+ *           every phase that ran, in microseconds, then the mean
+ *           hardware counts of each run, if counters are open.
+** Params:   std::ostream &out: stream to print to.
+** Returns:  None
+*********************************************************************/
+void PhaseTimer::print(std::ostream &out)
+{
+    const int NAME_WIDTH = 16;
+    const int NUMBER_WIDTH = 12;
+    const double NS_PER_US = 1000.0;
+    const int NUM_PERCENTILES = 3;
+    const double PERCENTILES[NUM_PERCENTILES] = {0.5, 0.9, 0.99};
+    const char *PERCENTILE_NAMES[NUM_PERCENTILES] = {"p50", "p90", "p99"};
+
+    std::ios::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+
+    out << "Phase times (us):" << std::endl;
+    out << std::left << std::setw(NAME_WIDTH) << "phase" << std::right
+            << std::setw(NUMBER_WIDTH) << "count"
+            << std::setw(NUMBER_WIDTH) << "mean";
+    for (int p=0; p<NUM_PERCENTILES; p++)
+    {
+        out << std::setw(NUMBER_WIDTH) << PERCENTILE_NAMES[p];
+    }
+    out << std::setw(NUMBER_WIDTH) << "max" << std::endl;
+
+    out << std::fixed << std::setprecision(2);
+    for (int i=0; i<NUM_PHASES; i++)
+    {
+        const LatencyHistogram &histogram = histograms[i];
+        if (histogram.getCount() == 0)
+        {
+            continue;
+        }
+
+        out << std::left << std::setw(NAME_WIDTH) << PHASE_NAMES[i]
+                << std::right << std::setw(NUMBER_WIDTH)
+                << histogram.getCount() << std::setw(NUMBER_WIDTH)
+                << histogram.getMean() / NS_PER_US;
+        for (int p=0; p<NUM_PERCENTILES; p++)
+        {
+            out << std::setw(NUMBER_WIDTH)
+                    << histogram.percentile(PERCENTILES[p]) / NS_PER_US;
+        }
+        out << std::setw(NUMBER_WIDTH) << histogram.getMax() / NS_PER_US
+                << std::endl;
+    }
+
+    if (PerfCounters::isOpen())
+    {
+        printCounters(out);
+    }
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+
+/********************************************************************
+** Function: printCounters: Prints the mean hardware counts of one
+ *           run of every phase that ran, and its instructions per
+ *           cycle.
+** Params:   std::ostream &out: stream to print to.
+** Returns:  None
+*********************************************************************/
+void PhaseTimer::printCounters(std::ostream &out)
+{
+    const int NAME_WIDTH = 16;
+    const int NUMBER_WIDTH = 15;
+    const char *NOT_COUNTED = "n/a";
+
+    std::ios::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+
+    out << "Phase counters (mean per run):" << std::endl;
+    out << std::left << std::setw(NAME_WIDTH) << "phase" << std::right;
+    for (int c=0; c<PerfCounters::NUM_COUNTERS; c++)
+    {
+        out << std::setw(NUMBER_WIDTH) << PerfCounters::COUNTER_NAMES[c];
+    }
+    out << std::setw(NUMBER_WIDTH) << "IPC" << std::endl;
+
+    bool has_ipc = PerfCounters::isAvailable(PerfCounters::CYCLES)
+            && PerfCounters::isAvailable(PerfCounters::INSTRUCTIONS);
+
+    //a copy, so scopes ending on other threads do not wait on output
+    PerfCounters::Sample totals[NUM_PHASES];
+    {
+        std::lock_guard<std::mutex> lock(counters_mutex);
+        std::copy(phase_counters, phase_counters + NUM_PHASES, totals);
+    }
+
+    out << std::fixed;
+    for (int i=0; i<NUM_PHASES; i++)
+    {
+        int64_t runs = histograms[i].getCount();
+        if (runs == 0)
+        {
+            continue;
+        }
+
+        const PerfCounters::Sample &total = totals[i];
+        out << std::left << std::setw(NAME_WIDTH) << PHASE_NAMES[i]
+                << std::right << std::setprecision(0);
+        for (int c=0; c<PerfCounters::NUM_COUNTERS; c++)
+        {
+            out << std::setw(NUMBER_WIDTH);
+            if (PerfCounters::isAvailable(
+                    static_cast<PerfCounters::Counter>(c)))
+            {
+                out << static_cast<double>(total.values[c]) / runs;
+            }
+            else
+            {
+                out << NOT_COUNTED;
+            }
+        }
+
+        out << std::setw(NUMBER_WIDTH) << std::setprecision(2);
+        if (has_ipc && total.values[PerfCounters::CYCLES] > 0)
+        {
+            out << static_cast<double>(
+                        total.values[PerfCounters::INSTRUCTIONS])
+                    / total.values[PerfCounters::CYCLES];
+        }
+        else
+        {
+            out << NOT_COUNTED;
+        }
+        out << std::endl;
+    }
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+
+/********************************************************************
+** Function: installSignalHandler: Makes SIGUSR1 ask for the
+ *           histograms to be printed.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void PhaseTimer::installSignalHandler()
+{
+    std::signal(SIGUSR1, requestDump);
+}
+
+
+/********************************************************************
+** Function: dumpIfRequested: Prints the histograms if SIGUSR1
+ *           arrived since the last call. The Zoo calls it once a
+ *           day, since printing is not safe in a signal handler.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void PhaseTimer::dumpIfRequested()
+{
+    if (dump_requested)
+    {
+        dump_requested = 0;
+        print();
+    }
+}
+
+
+/********************************************************************
+** Function: requestDump: SIGUSR1 handler, sets dump_requested.
+** Params:   int signal_number: signal that arrived.
+** Returns:  None
+*********************************************************************/
+void PhaseTimer::requestDump(int signal_number)
+{
+    static_cast<void>(signal_number);
+    dump_requested = 1;
+}
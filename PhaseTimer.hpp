@@ -0,0 +1,184 @@
+/*********************************************************************
+** Program name: PhaseTimer.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 4:40 AM
+** Description: Class specification file for PhaseTimer class.
+ *              PhaseTimer times each phase of a zoo day, and each
+ *              I/O call in it, into one LatencyHistogram per phase.
+ *              A Scope times the block it is declared in. Timers are
+ *              always compiled in, but stay off until enable() is
+ *              called, and then cost one branch each. The histograms
+ *              can be printed on exit, or on SIGUSR1 at the end of
+ *              the day it arrives in. Scopes also keep track of each
+ *              thread's current phase, for AllocationTracker. While
+ *              timing, a scope also adds its phase's hardware counts
+ *              to that phase's totals if PerfCounters are open. Scopes
+ *              on any thread can record at once: the histograms take
+ *              relaxed atomic counts, and the hardware totals, which
+ *              already cost system calls to read, take a lock.
+*********************************************************************/
+
+
+#ifndef PHASE_TIMER_HPP
+#define PHASE_TIMER_HPP
+
+#include "LatencyHistogram.hpp"
+#include "PerfCounters.hpp"
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <iostream>
+#include <mutex>
+
+class PhaseTimer
+{
+public:
+    //Timed parts of a day, a phase includes the phases called in it.
+    // NUM_PHASES also stands for being in no phase at all
+    enum Phase {DAY_HEADER, BEGINNING_OF_DAY, MIDDAY, RANDOM_EVENT,
+                END_OF_DAY, PROMPT, EVENT_WRITE, EVENT_READ, AUTOSAVE,
+                NUM_PHASES};
+
+    //Name of each phase, in the order of Phase
+    static const char *const PHASE_NAMES[];
+
+    //Times its phase from construction to the end of its block
+    class Scope
+    {
+    private:
+        PhaseTimer::Phase phase;
+        PhaseTimer::Phase outer_phase;  //current phase before this one
+        bool timing;        //false if timers were off when it started
+        bool counting;      //true if hardware counters were read
+        std::chrono::steady_clock::time_point start;
+        PerfCounters::Sample start_counters;
+
+    public:
+
+        /****************************************************************
+        ** Function: Constructor: Makes phase the current phase, and
+         *           starts timing it if timers are on.
+        ** Params:   Phase phase: phase to time.
+        ** Returns:  None
+        *****************************************************************/
+        explicit Scope(Phase phase);
+
+
+        /****************************************************************
+        ** Function: Destructor: Records the time since construction,
+         *           and restores the phase it was started in.
+        ** Params:   None
+        ** Returns:  None
+        *****************************************************************/
+        ~Scope();
+    };
+
+private:
+    static std::atomic<bool> enabled;
+    static LatencyHistogram histograms[NUM_PHASES];
+    static PerfCounters::Sample phase_counters[NUM_PHASES];
+    static std::mutex counters_mutex;   //guards phase_counters
+    static volatile std::sig_atomic_t dump_requested;
+    static thread_local Phase current_phase;
+
+public:
+
+    /********************************************************************
+    ** Function: enable: Turns the timers on or off.
+    ** Params:   bool on: true to time phases.
+    ** Returns:  None
+    *********************************************************************/
+    static void enable(bool on = true);
+
+
+    /********************************************************************
+    ** Function: isEnabled: Returns true if the timers are on.
+    ** Params:   None
+    ** Returns:  bool: true if phases are timed.
+    *********************************************************************/
+    static bool isEnabled();
+
+
+    /********************************************************************
+    ** Function: currentPhase: Returns the innermost phase this thread
+     *           is in, timers on or off.
+    ** Params:   None
+    ** Returns:  Phase: the phase, NUM_PHASES if none.
+    *********************************************************************/
+    static Phase currentPhase();
+
+
+    /********************************************************************
+    ** Function: record: Counts one run of a phase.
+    ** Params:   Phase phase: phase that ran.
+     *           int64_t nanoseconds: how long it took.
+    ** Returns:  None
+    *********************************************************************/
+    static void record(Phase phase, int64_t nanoseconds);
+
+
+    /********************************************************************
+    ** Function: getHistogram: Returns the times of one phase.
+    ** Params:   Phase phase: phase to look up.
+    ** Returns:  const LatencyHistogram &: its histogram.
+    *********************************************************************/
+    static const LatencyHistogram &getHistogram(Phase phase);
+
+
+    /********************************************************************
+    ** Function: reset: Forgets every time recorded.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    static void reset();
+
+
+    /********************************************************************
+    ** Function: print: Prints count, mean, p50, p90, p99, and max of
+     *           every phase that ran, in microseconds, then the mean
+     *           hardware counts of each run, if counters are open.
+    ** Params:   std::ostream &out: stream to print to.
+    ** Returns:  None
+    *********************************************************************/
+    static void print(std::ostream &out = std::cout);
+
+
+    /********************************************************************
+    ** Function: installSignalHandler: Makes SIGUSR1 ask for the
+     *           histograms to be printed.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    static void installSignalHandler();
+
+
+    /********************************************************************
+    ** Function: dumpIfRequested: Prints the histograms if SIGUSR1
+     *           arrived since the last call. The Zoo calls it once a
+     *           day, since printing is not safe in a signal handler.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    static void dumpIfRequested();
+
+private:
+
+    /********************************************************************
+    ** Function: printCounters: Prints the mean hardware counts of one
+     *           run of every phase that ran, and its instructions per
+     *           cycle.
+    ** Params:   std::ostream &out: stream to print to.
+    ** Returns:  None
+    *********************************************************************/
+    static void printCounters(std::ostream &out);
+
+
+    /********************************************************************
+    ** Function: requestDump: SIGUSR1 handler, sets dump_requested.
+    ** Params:   int signal_number: signal that arrived.
+    ** Returns:  None
+    *********************************************************************/
+    static void requestDump(int signal_number);
+};
+
+#endif
@@ -0,0 +1,291 @@
+/*********************************************************************
+** Program name: ProgressReporter.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 10:30 AM
+** Description: Class implementation file for ProgressReporter class.
+ *              ProgressReporter shows how far along a long headless
+ *              run or sweep is. Every few seconds a background thread
+ *              prints a line to stderr with the share done, runs
+ *              finished, days simulated per second, the current
+ *              population, and the time left. The simulating threads
+ *              only store into counters of their own, without locks,
+ *              so watching a run does not slow it down.
+*********************************************************************/
+
+
+#include "ProgressReporter.hpp"
+#include <algorithm>
+#include <iomanip>
+
+using std::endl;
+
+typedef std::chrono::steady_clock Clock;
+
+//Initialize constants
+const int ProgressReporter::EVERY_SECONDS_DEFAULT = 10;
+
+//Initialize static members
+ProgressReporter::Counters ProgressReporter::counters[MAX_THREADS];
+std::atomic<int> ProgressReporter::threads_seen(0);
+thread_local ProgressReporter::Counters *ProgressReporter::own = nullptr;
+std::atomic<bool> ProgressReporter::running(false);
+std::atomic<long long> ProgressReporter::total_runs(0);
+int ProgressReporter::horizon = 0;
+int ProgressReporter::every_seconds = EVERY_SECONDS_DEFAULT;
+std::ostream *ProgressReporter::out = &std::cerr;
+std::thread ProgressReporter::reporter;
+std::mutex ProgressReporter::stop_mutex;
+std::condition_variable ProgressReporter::stop_signal;
+bool ProgressReporter::stopping = false;
+Clock::time_point ProgressReporter::start_time;
+
+/********************************************************************
+** Function: start: Starts printing progress every so often, with
+ *           every counter at zero. Does nothing if already started.
+** Params:   long long runs: runs to be done in all.
+ *           int horizon: most days a run can last.
+ *           int seconds: seconds between progress lines.
+ *           std::ostream &stream: stream to print to.
+** Returns:  None
+*********************************************************************/
+void ProgressReporter::start(long long runs, int horizon, int seconds,
+                                std::ostream &stream)
+{
+    if (running.load())
+    {
+        return;
+    }
+
+    for (int i=0; i<MAX_THREADS; i++)
+    {
+        counters[i].days.store(0);
+        counters[i].runs.store(0);
+        counters[i].run_day.store(0);
+        counters[i].population.store(0);
+    }
+
+    total_runs.store(runs);
+    ProgressReporter::horizon = horizon;
+    every_seconds = std::max(seconds, 1);
+    out = &stream;
+    stopping = false;
+    start_time = Clock::now();
+
+    running.store(true);
+    reporter = std::thread(report);
+}
+
+
+/********************************************************************
+** Function: stop: Stops the reporter thread, then prints a last
+ *           line with the totals. Does nothing if not started.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void ProgressReporter::stop()
+{
+    if (!running.load())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(stop_mutex);
+        stopping = true;
+    }
+    stop_signal.notify_one();
+    reporter.join();
+    running.store(false);
+
+    long long no_days = 0;
+    Clock::time_point since_start = start_time;
+    printLine(no_days, since_start, true);
+}
+
+
+/********************************************************************
+** Function: isRunning: Returns true between start and stop.
+** Params:   None
+** Returns:  bool: true if progress is being reported.
+*********************************************************************/
+bool ProgressReporter::isRunning()
+{
+    return running.load(std::memory_order_relaxed);
+}
+
+
+/********************************************************************
+** Function: setTotalRuns: Changes the runs to be done in all, for
+ *           a sweep that resumes with some runs already done.
+** Params:   long long runs: runs left to do.
+** Returns:  None
+*********************************************************************/
+void ProgressReporter::setTotalRuns(long long runs)
+{
+    total_runs.store(runs, std::memory_order_relaxed);
+}
+
+
+/********************************************************************
+** Function: dayEnded: Counts a day simulated by this thread. Zoo
+ *           calls it at the end of each headless day.
+** Params:   int day: day of the run that ended.
+ *           int64_t population: animals in the zoo.
+** Returns:  None
+*********************************************************************/
+void ProgressReporter::dayEnded(int day, int64_t population)
+{
+    if (!isRunning())
+    {
+        return;
+    }
+
+    //relaxed, the reporter only needs each value, not their order
+    Counters &mine = getOwnCounters();
+    mine.days.fetch_add(1, std::memory_order_relaxed);
+    mine.run_day.store(day, std::memory_order_relaxed);
+    mine.population.store(population, std::memory_order_relaxed);
+}
+
+
+/********************************************************************
+** Function: runFinished: Counts a run finished by this thread,
+ *           simulated or found in a cache.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void ProgressReporter::runFinished()
+{
+    if (!isRunning())
+    {
+        return;
+    }
+
+    Counters &mine = getOwnCounters();
+    mine.runs.fetch_add(1, std::memory_order_relaxed);
+    mine.run_day.store(0, std::memory_order_relaxed);
+}
+
+
+/********************************************************************
+** Function: getOwnCounters: Returns this thread's counters, taking
+ *           the next free ones on its first call.
+** Params:   None
+** Returns:  Counters &: counters only this thread writes, unless
+ *              there are more than MAX_THREADS threads.
+*********************************************************************/
+ProgressReporter::Counters &ProgressReporter::getOwnCounters()
+{
+    if (!own)
+    {
+        int index = threads_seen.fetch_add(1, std::memory_order_relaxed);
+        if (index >= MAX_THREADS)
+        {
+            index = MAX_THREADS - 1;
+        }
+        own = &counters[index];
+    }
+    return *own;
+}
+
+
+/********************************************************************
+** Function: report: Reporter thread body, prints a line every
+ *           every_seconds until stopped.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void ProgressReporter::report()
+{
+    long long last_days = 0;
+    Clock::time_point last_time = start_time;
+
+    std::unique_lock<std::mutex> lock(stop_mutex);
+    while (!stop_signal.wait_for(lock, std::chrono::seconds(every_seconds),
+                                    [] { return stopping; }))
+    {
+        printLine(last_days, last_time, false);
+    }
+}
+
+
+/********************************************************************
+** Function: printLine: Sums every thread's counters and prints
+ *           one progress line.
+** Params:   long long &last_days: days at the last line, updated.
+ *           std::chrono::steady_clock::time_point &last_time: time
+ *              of the last line, updated.
+ *           bool last: true for the line printed by stop, which
+ *              gives the average rate of the whole run.
+** Returns:  None
+*********************************************************************/
+void ProgressReporter::printLine(long long &last_days,
+                                    Clock::time_point &last_time, bool last)
+{
+    const double PERCENT = 100;
+    const long long SECONDS_PER_MINUTE = 60;
+    const long long SECONDS_PER_HOUR = 3600;
+
+    long long days = 0;
+    long long runs = 0;
+    double partial_runs = 0;    //share done of the runs going on
+    int64_t population = 0;
+    for (int i=0; i<MAX_THREADS; i++)
+    {
+        days += counters[i].days.load(std::memory_order_relaxed);
+        runs += counters[i].runs.load(std::memory_order_relaxed);
+        population += counters[i].population.load(std::memory_order_relaxed);
+        if (horizon > 0)
+        {
+            partial_runs += counters[i].run_day.load(
+                    std::memory_order_relaxed) / static_cast<double>(horizon);
+        }
+    }
+
+    Clock::time_point now = Clock::now();
+    std::chrono::duration<double> interval = now - last_time;
+    std::chrono::duration<double> elapsed = now - start_time;
+    double days_per_second = interval.count() > 0
+                            ? (days - last_days) / interval.count() : 0;
+    last_days = days;
+    last_time = now;
+
+    long long all_runs = total_runs.load(std::memory_order_relaxed);
+    double done = 1;
+    if (all_runs > 0)
+    {
+        done = std::min((runs + partial_runs) / all_runs, 1.0);
+    }
+
+    std::ios::fmtflags flags = out->flags();
+    std::streamsize precision = out->precision();
+
+    *out << std::fixed << (last ? "Done: " : "Progress: ")
+            << std::setprecision(1) << done * PERCENT << "%, runs "
+            << runs << "/" << all_runs << ", " << std::setprecision(0)
+            << days_per_second << " days/s, population " << population;
+
+    //time left if the rate so far holds
+    if (!last && done > 0)
+    {
+        long long left = static_cast<long long>(
+                elapsed.count() * (1 - done) / done);
+        *out << ", ETA " << left / SECONDS_PER_HOUR << ":"
+                << std::setfill('0')
+                << std::setw(2) << left % SECONDS_PER_HOUR / SECONDS_PER_MINUTE
+                << ":" << std::setw(2) << left % SECONDS_PER_MINUTE
+                << std::setfill(' ');
+    }
+    else if (!last)
+    {
+        *out << ", ETA unknown";
+    }
+    else
+    {
+        *out << ", " << std::setprecision(1) << elapsed.count() << " s";
+    }
+    *out << endl;
+
+    out->flags(flags);
+    out->precision(precision);
+}
@@ -0,0 +1,159 @@
+/*********************************************************************
+** Program name: ProgressReporter.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 10:30 AM
+** Description: Class specification file for ProgressReporter class.
+ *              ProgressReporter shows how far along a long headless
+ *              run or sweep is. Every few seconds a background thread
+ *              prints a line to stderr with the share done, runs
+ *              finished, days simulated per second, the current
+ *              population, and the time left. The simulating threads
+ *              only store into counters of their own, without locks,
+ *              so watching a run does not slow it down.
+*********************************************************************/
+
+
+#ifndef PROGRESS_REPORTER_HPP
+#define PROGRESS_REPORTER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+class ProgressReporter
+{
+public:
+    //Default seconds between progress lines
+    static const int EVERY_SECONDS_DEFAULT;
+    //Threads that get counters of their own, any more share the last
+    static const int MAX_THREADS = 64;
+
+private:
+    //Counters written by one simulating thread, read by the reporter.
+    //Each is on its own cache line, so threads do not slow each other
+    struct alignas(64) Counters
+    {
+        std::atomic<long long> days;        //days simulated in all
+        std::atomic<long long> runs;        //runs finished
+        std::atomic<int> run_day;           //day of the run going on
+        std::atomic<int64_t> population;    //animals in that run's zoo
+    };
+
+    static Counters counters[MAX_THREADS];
+    static std::atomic<int> threads_seen;
+    static thread_local Counters *own;
+
+    static std::atomic<bool> running;
+    static std::atomic<long long> total_runs;
+    static int horizon;
+    static int every_seconds;
+    static std::ostream *out;
+
+    //Wakes the reporter thread early to stop it
+    static std::thread reporter;
+    static std::mutex stop_mutex;
+    static std::condition_variable stop_signal;
+    static bool stopping;
+    static std::chrono::steady_clock::time_point start_time;
+
+public:
+
+    /********************************************************************
+    ** Function: start: Starts printing progress every so often, with
+     *           every counter at zero. Does nothing if already started.
+    ** Params:   long long runs: runs to be done in all.
+     *           int horizon: most days a run can last.
+     *           int seconds: seconds between progress lines.
+     *           std::ostream &stream: stream to print to.
+    ** Returns:  None
+    *********************************************************************/
+    static void start(long long runs, int horizon,
+                        int seconds = EVERY_SECONDS_DEFAULT,
+                        std::ostream &stream = std::cerr);
+
+
+    /********************************************************************
+    ** Function: stop: Stops the reporter thread, then prints a last
+     *           line with the totals. Does nothing if not started.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    static void stop();
+
+
+    /********************************************************************
+    ** Function: isRunning: Returns true between start and stop.
+    ** Params:   None
+    ** Returns:  bool: true if progress is being reported.
+    *********************************************************************/
+    static bool isRunning();
+
+
+    /********************************************************************
+    ** Function: setTotalRuns: Changes the runs to be done in all, for
+     *           a sweep that resumes with some runs already done.
+    ** Params:   long long runs: runs left to do.
+    ** Returns:  None
+    *********************************************************************/
+    static void setTotalRuns(long long runs);
+
+
+    /********************************************************************
+    ** Function: dayEnded: Counts a day simulated by this thread. Zoo
+     *           calls it at the end of each headless day.
+    ** Params:   int day: day of the run that ended.
+     *           int64_t population: animals in the zoo.
+    ** Returns:  None
+    *********************************************************************/
+    static void dayEnded(int day, int64_t population);
+
+
+    /********************************************************************
+    ** Function: runFinished: Counts a run finished by this thread,
+     *           simulated or found in a cache.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    static void runFinished();
+
+private:
+
+    /********************************************************************
+    ** Function: getOwnCounters: Returns this thread's counters, taking
+     *           the next free ones on its first call.
+    ** Params:   None
+    ** Returns:  Counters &: counters only this thread writes, unless
+     *              there are more than MAX_THREADS threads.
+    *********************************************************************/
+    static Counters &getOwnCounters();
+
+
+    /********************************************************************
+    ** Function: report: Reporter thread body, prints a line every
+     *           every_seconds until stopped.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    static void report();
+
+
+    /********************************************************************
+    ** Function: printLine: Sums every thread's counters and prints
+     *           one progress line.
+    ** Params:   long long &last_days: days at the last line, updated.
+     *           std::chrono::steady_clock::time_point &last_time: time
+     *              of the last line, updated.
+     *           bool last: true for the line printed by stop, which
+     *              gives the average rate of the whole run.
+    ** Returns:  None
+    *********************************************************************/
+    static void printLine(long long &last_days,
+                            std::chrono::steady_clock::time_point &last_time,
+                            bool last);
+};
+
+#endif
@@ -0,0 +1,336 @@
+/*********************************************************************
+** Program name: RegressionGate.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 7:30 AM
+** Description: Class implementation file for RegressionGate class. A
+ *              RegressionGate compares benchmark results against a
+ *              baseline written earlier by Benchmark::writeJson. Each
+ *              function and population is compared by the median of
+ *              its samples, and is a regression when it is slower by
+ *              more than a threshold and a one-sided Mann-Whitney
+ *              test says the slowdown is not noise. The comparisons
+ *              are printed as a table, so a build can fail on them.
+*********************************************************************/
+
+
+#include "RegressionGate.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+using std::endl;
+using std::string;
+using std::vector;
+
+//Initialize constants
+const double RegressionGate::THRESHOLD_DEFAULT = 0.05;
+const double RegressionGate::SIGNIFICANCE = 0.01;
+const char *const RegressionGate::VERDICT_NAMES[] =
+        {"same", "faster", "SLOWER", "new"};
+
+//Largest before x after sample sizes given an exact p-value
+static const int EXACT_MAX_PAIRS = 400;
+
+/********************************************************************
+** Function: Constructor: Sets up a gate with no baseline.
+** Params:   double threshold: slowdown allowed, 0.05 for 5%.
+** Returns:  None
+*********************************************************************/
+RegressionGate::RegressionGate(double threshold)
+    : threshold(threshold)
+{}
+
+
+/********************************************************************
+** Function: loadBaseline: Reads the baseline to compare against.
+** Params:   const string &path: JSON file written by
+ *              Benchmark::writeJson.
+** Returns:  bool: true if the baseline had results.
+*********************************************************************/
+bool RegressionGate::loadBaseline(const string &path)
+{
+    return Benchmark::readJson(path, baseline);
+}
+
+
+/********************************************************************
+** Function: compare: Compares results with the baseline, replacing
+ *           any earlier comparisons. Baseline results that were
+ *           not rerun are left out.
+** Params:   const vector<Benchmark::Result> &results: results now.
+** Returns:  None
+*********************************************************************/
+void RegressionGate::compare(const vector<Benchmark::Result> &results)
+{
+    comparisons.clear();
+
+    for (size_t i=0; i<results.size(); i++)
+    {
+        const Benchmark::Result &result = results[i];
+
+        Comparison comparison;
+        comparison.name = result.name;
+        comparison.population = result.population;
+        comparison.baseline_ns = 0;
+        comparison.current_ns = median(result.samples);
+        comparison.change = 0;
+        comparison.p_value = 1;
+        comparison.verdict = NEW;
+
+        for (size_t k=0; k<baseline.size(); k++)
+        {
+            const Benchmark::Result &before = baseline[k];
+            if (before.name != result.name
+                    || before.population != result.population)
+            {
+                continue;
+            }
+
+            comparison.baseline_ns = median(before.samples);
+            if (comparison.baseline_ns > 0)
+            {
+                comparison.change = comparison.current_ns
+                                    / comparison.baseline_ns - 1;
+            }
+
+            //test the direction the medians moved in
+            comparison.verdict = SAME;
+            if (comparison.change > 0)
+            {
+                comparison.p_value = slowerPValue(before.samples,
+                                                    result.samples);
+                if (comparison.change > threshold
+                        && comparison.p_value < SIGNIFICANCE)
+                {
+                    comparison.verdict = SLOWER;
+                }
+            }
+            else
+            {
+                comparison.p_value = slowerPValue(result.samples,
+                                                    before.samples);
+                if (-comparison.change > threshold
+                        && comparison.p_value < SIGNIFICANCE)
+                {
+                    comparison.verdict = FASTER;
+                }
+            }
+            break;
+        }
+
+        comparisons.push_back(comparison);
+    }
+}
+
+
+/********************************************************************
+** Function: getComparisons: Returns the comparisons, in the order
+ *           of the results compared.
+** Params:   None
+** Returns:  const vector<Comparison> &: the comparisons.
+*********************************************************************/
+const vector<RegressionGate::Comparison> &
+RegressionGate::getComparisons() const
+{
+    return comparisons;
+}
+
+
+/********************************************************************
+** Function: getRegressionCount: Returns the number of results
+ *           that are significantly slower.
+** Params:   None
+** Returns:  int: SLOWER comparisons.
+*********************************************************************/
+int RegressionGate::getRegressionCount() const
+{
+    int regressions = 0;
+    for (size_t i=0; i<comparisons.size(); i++)
+    {
+        if (comparisons[i].verdict == SLOWER)
+        {
+            regressions++;
+        }
+    }
+
+    return regressions;
+}
+
+
+/********************************************************************
+** Function: printTable: Prints the comparisons as a table, then
+ *           a line counting the regressions.
+** Params:   std::ostream &out: stream to print to.
+** Returns:  None
+*********************************************************************/
+void RegressionGate::printTable(std::ostream &out) const
+{
+    const int NAME_WIDTH = 24;
+    const int POPULATION_WIDTH = 12;
+    const int NUMBER_WIDTH = 16;
+    const int CHANGE_WIDTH = 10;
+    const double PERCENT = 100;
+
+    std::ios_base::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+
+    out << std::left << std::setw(NAME_WIDTH) << "Function"
+            << std::right << std::setw(POPULATION_WIDTH) << "Population"
+            << std::setw(NUMBER_WIDTH) << "baseline ns/op"
+            << std::setw(NUMBER_WIDTH) << "current ns/op"
+            << std::setw(CHANGE_WIDTH) << "change"
+            << std::setw(CHANGE_WIDTH) << "p"
+            << "  verdict" << endl;
+
+    out << std::fixed;
+    for (size_t i=0; i<comparisons.size(); i++)
+    {
+        const Comparison &comparison = comparisons[i];
+        out << std::left << std::setw(NAME_WIDTH) << comparison.name
+                << std::right << std::setw(POPULATION_WIDTH)
+                << comparison.population << std::setprecision(3);
+
+        if (comparison.verdict == NEW)
+        {
+            out << std::setw(NUMBER_WIDTH) << "-"
+                    << std::setw(NUMBER_WIDTH) << comparison.current_ns
+                    << std::setw(CHANGE_WIDTH) << "-"
+                    << std::setw(CHANGE_WIDTH) << "-";
+        }
+        else
+        {
+            std::ostringstream change;
+            change << std::fixed << std::setprecision(1) << std::showpos
+                    << comparison.change * PERCENT << "%";
+            out << std::setw(NUMBER_WIDTH) << comparison.baseline_ns
+                    << std::setw(NUMBER_WIDTH) << comparison.current_ns
+                    << std::setw(CHANGE_WIDTH) << change.str()
+                    << std::setw(CHANGE_WIDTH) << std::setprecision(4)
+                    << comparison.p_value;
+        }
+
+        out << "  " << VERDICT_NAMES[comparison.verdict] << endl;
+    }
+
+    out << "Regressions: " << getRegressionCount() << " of "
+            << comparisons.size() << " results slower by more than "
+            << std::setprecision(1) << threshold * PERCENT
+            << "% with p < " << std::setprecision(2) << SIGNIFICANCE
+            << endl;
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+
+/********************************************************************
+** Function: median: Returns the median of some samples.
+** Params:   vector<double> samples: samples, copied to be sorted.
+** Returns:  double: the median, 0 if there are none.
+*********************************************************************/
+double RegressionGate::median(vector<double> samples)
+{
+    if (samples.empty())
+    {
+        return 0;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    size_t middle = samples.size() / 2;
+    if (samples.size() % 2 == 1)
+    {
+        return samples[middle];
+    }
+    return (samples[middle - 1] + samples[middle]) / 2;
+}
+
+
+/********************************************************************
+** Function: slowerPValue: One-sided Mann-Whitney test of whether
+ *           current samples are slower than baseline samples. The
+ *           p-value is exact for small samples, and from the
+ *           normal approximation for large ones.
+** Params:   const vector<double> &before: baseline samples.
+ *           const vector<double> &after: current samples.
+** Returns:  double: chance of samples this much slower by noise.
+*********************************************************************/
+double RegressionGate::slowerPValue(const vector<double> &before,
+                                    const vector<double> &after)
+{
+    int m = static_cast<int>(before.size());
+    int n = static_cast<int>(after.size());
+    if (m == 0 || n == 0)
+    {
+        return 1;
+    }
+
+    //pairs where after is slower, ties counting half
+    double u = 0;
+    for (int i=0; i<n; i++)
+    {
+        for (int k=0; k<m; k++)
+        {
+            if (after[i] > before[k])
+            {
+                u += 1;
+            }
+            else if (after[i] == before[k])
+            {
+                u += 0.5;
+            }
+        }
+    }
+
+    int pairs = n * m;
+    if (pairs > EXACT_MAX_PAIRS)
+    {
+        double mean = pairs / 2.0;
+        double sd = std::sqrt(pairs * (n + m + 1) / 12.0);
+        double z = (u - mean - 0.5) / sd;
+        return 0.5 * std::erfc(z / std::sqrt(2.0));
+    }
+
+    //ways[i][k][v]: orderings of i after and k before samples with
+    //v pairs where after is slower. The largest sample is either an
+    //after sample, slower than all k, or a before sample.
+    vector<vector<vector<double> > > ways(n + 1,
+            vector<vector<double> >(m + 1));
+    for (int i=0; i<=n; i++)
+    {
+        for (int k=0; k<=m; k++)
+        {
+            ways[i][k].assign(i * k + 1, 0);
+            if (i == 0 || k == 0)
+            {
+                ways[i][k][0] = 1;
+                continue;
+            }
+
+            for (int v=0; v<=i*k; v++)
+            {
+                if (v >= k && v - k < static_cast<int>(ways[i-1][k].size()))
+                {
+                    ways[i][k][v] += ways[i-1][k][v - k];
+                }
+                if (v < static_cast<int>(ways[i][k-1].size()))
+                {
+                    ways[i][k][v] += ways[i][k-1][v];
+                }
+            }
+        }
+    }
+
+    double total = 0;
+    double at_least = 0;
+    for (int v=0; v<=pairs; v++)
+    {
+        total += ways[n][m][v];
+        if (v >= std::ceil(u))
+        {
+            at_least += ways[n][m][v];
+        }
+    }
+
+    return at_least / total;
+}
@@ -0,0 +1,132 @@
+/*********************************************************************
+** Program name: RegressionGate.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 7:30 AM
+** Description: Class specification file for RegressionGate class. A
+ *              RegressionGate compares benchmark results against a
+ *              baseline written earlier by Benchmark::writeJson. Each
+ *              function and population is compared by the median of
+ *              its samples, and is a regression when it is slower by
+ *              more than a threshold and a one-sided Mann-Whitney
+ *              test says the slowdown is not noise. The comparisons
+ *              are printed as a table, so a build can fail on them.
+*********************************************************************/
+
+
+#ifndef REGRESSION_GATE_HPP
+#define REGRESSION_GATE_HPP
+
+#include "Benchmark.hpp"
+#include <iostream>
+#include <string>
+#include <vector>
+
+class RegressionGate
+{
+public:
+    //Verdict on one function and population
+    enum Verdict {SAME, FASTER, SLOWER, NEW};
+
+    //One result compared with its baseline
+    struct Comparison
+    {
+        std::string name;       //function timed
+        int64_t population;     //animals in the zoo, 0 if it does not apply
+        double baseline_ns;     //median ns/op of the baseline, 0 if NEW
+        double current_ns;      //median ns/op now
+        double change;          //current over baseline, minus 1
+        double p_value;         //chance of a slowdown this big by noise
+        Verdict verdict;
+    };
+
+    //Slowdown allowed before a result can regress, 0.05 for 5%
+    static const double THRESHOLD_DEFAULT;
+    //p-value a change must be under to count
+    static const double SIGNIFICANCE;
+    //Name of each verdict, in the order of Verdict
+    static const char *const VERDICT_NAMES[];
+
+private:
+    std::vector<Benchmark::Result> baseline;
+    double threshold;
+    std::vector<Comparison> comparisons;
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor: Sets up a gate with no baseline.
+    ** Params:   double threshold: slowdown allowed, 0.05 for 5%.
+    ** Returns:  None
+    *********************************************************************/
+    RegressionGate(double threshold = THRESHOLD_DEFAULT);
+
+
+    /********************************************************************
+    ** Function: loadBaseline: Reads the baseline to compare against.
+    ** Params:   const string &path: JSON file written by
+     *              Benchmark::writeJson.
+    ** Returns:  bool: true if the baseline had results.
+    *********************************************************************/
+    bool loadBaseline(const std::string &path);
+
+
+    /********************************************************************
+    ** Function: compare: Compares results with the baseline, replacing
+     *           any earlier comparisons. Baseline results that were
+     *           not rerun are left out.
+    ** Params:   const vector<Benchmark::Result> &results: results now.
+    ** Returns:  None
+    *********************************************************************/
+    void compare(const std::vector<Benchmark::Result> &results);
+
+
+    /********************************************************************
+    ** Function: getComparisons: Returns the comparisons, in the order
+     *           of the results compared.
+    ** Params:   None
+    ** Returns:  const vector<Comparison> &: the comparisons.
+    *********************************************************************/
+    const std::vector<Comparison> &getComparisons() const;
+
+
+    /********************************************************************
+    ** Function: getRegressionCount: Returns the number of results
+     *           that are significantly slower.
+    ** Params:   None
+    ** Returns:  int: SLOWER comparisons.
+    *********************************************************************/
+    int getRegressionCount() const;
+
+
+    /********************************************************************
+    ** Function: printTable: Prints the comparisons as a table, then
+     *           a line counting the regressions.
+    ** Params:   std::ostream &out: stream to print to.
+    ** Returns:  None
+    *********************************************************************/
+    void printTable(std::ostream &out = std::cout) const;
+
+private:
+
+    /********************************************************************
+    ** Function: median: Returns the median of some samples.
+    ** Params:   vector<double> samples: samples, copied to be sorted.
+    ** Returns:  double: the median, 0 if there are none.
+    *********************************************************************/
+    static double median(std::vector<double> samples);
+
+
+    /********************************************************************
+    ** Function: slowerPValue: One-sided Mann-Whitney test of whether
+     *           current samples are slower than baseline samples. The
+     *           p-value is exact for small samples, and from the
+     *           normal approximation for large ones.
+    ** Params:   const vector<double> &before: baseline samples.
+     *           const vector<double> &after: current samples.
+    ** Returns:  double: chance of samples this much slower by noise.
+    *********************************************************************/
+    static double slowerPValue(const std::vector<double> &before,
+                                const std::vector<double> &after);
+};
+
+#endif
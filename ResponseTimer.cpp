@@ -0,0 +1,150 @@
+/*********************************************************************
+** Program name: ResponseTimer.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 8:50 AM
+** Description: Class implementation file for ResponseTimer class.
+ *              ResponseTimer measures how responsive the interactive
+ *              game is: the time from a line of input being accepted
+ *              by ValidateInput to the next prompt being shown, which
+ *              covers handling the command and printing its output.
+ *              Times go into a LatencyHistogram, and are printed as
+ *              a ladder of percentiles. Timing stays off until
+ *              enable() is called, and then costs one clock read per
+ *              input and per prompt.
+*********************************************************************/
+
+
+#include "ResponseTimer.hpp"
+#include <iomanip>
+
+//Initialize static members
+bool ResponseTimer::enabled = false;
+bool ResponseTimer::waiting = false;
+std::chrono::steady_clock::time_point ResponseTimer::arrival;
+LatencyHistogram ResponseTimer::histogram;
+
+/********************************************************************
+** Function: enable: Turns timing on or off.
+** Params:   bool on: true to time responses.
+** Returns:  None
+*********************************************************************/
+void ResponseTimer::enable(bool on)
+{
+    enabled = on;
+    waiting = false;
+}
+
+
+/********************************************************************
+** Function: isEnabled: Returns true if responses are being timed.
+** Params:   None
+** Returns:  bool: true if timing is on.
+*********************************************************************/
+bool ResponseTimer::isEnabled()
+{
+    return enabled;
+}
+
+
+/********************************************************************
+** Function: inputAccepted: Starts timing a response. ValidateInput
+ *           calls it when it accepts a line of input.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void ResponseTimer::inputAccepted()
+{
+    if (enabled)
+    {
+        waiting = true;
+        arrival = std::chrono::steady_clock::now();
+    }
+}
+
+
+/********************************************************************
+** Function: promptShown: Records the time since the last input
+ *           accepted, if it has not been recorded yet.
+ *           ValidateInput calls it after flushing each prompt.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void ResponseTimer::promptShown()
+{
+    if (enabled && waiting)
+    {
+        waiting = false;
+        histogram.record(std::chrono::duration_cast<
+                std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - arrival).count());
+    }
+}
+
+
+/********************************************************************
+** Function: getHistogram: Returns the response times recorded.
+** Params:   None
+** Returns:  const LatencyHistogram &: times in nanoseconds.
+*********************************************************************/
+const LatencyHistogram &ResponseTimer::getHistogram()
+{
+    return histogram;
+}
+
+
+/********************************************************************
+** Function: reset: Forgets every response timed.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void ResponseTimer::reset()
+{
+    histogram.reset();
+    waiting = false;
+}
+
+
+/********************************************************************
+** Function: print: Prints the number of responses, their mean, and
+ *           the time each percentile from p50 to p99.99 and the
+ *           maximum stayed under.
+** Params:   std::ostream &out: stream to print to.
+** Returns:  None
+*********************************************************************/
+void ResponseTimer::print(std::ostream &out)
+{
+    const int NAME_WIDTH = 16;
+    const int NUMBER_WIDTH = 12;
+    const double NS_PER_US = 1000.0;
+    const int NUM_PERCENTILES = 7;
+    const double PERCENTILES[NUM_PERCENTILES] =
+            {0.5, 0.75, 0.9, 0.95, 0.99, 0.999, 0.9999};
+    const char *PERCENTILE_NAMES[NUM_PERCENTILES] =
+            {"p50", "p75", "p90", "p95", "p99", "p99.9", "p99.99"};
+
+    std::ios::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+
+    out << "Response times (us), input to next prompt: "
+            << histogram.getCount() << " responses" << std::endl;
+    if (histogram.getCount() > 0)
+    {
+        out << std::fixed << std::setprecision(2);
+        out << std::left << std::setw(NAME_WIDTH) << "mean" << std::right
+                << std::setw(NUMBER_WIDTH)
+                << histogram.getMean() / NS_PER_US << std::endl;
+        for (int p=0; p<NUM_PERCENTILES; p++)
+        {
+            out << std::left << std::setw(NAME_WIDTH) << PERCENTILE_NAMES[p]
+                    << std::right << std::setw(NUMBER_WIDTH)
+                    << histogram.percentile(PERCENTILES[p]) / NS_PER_US
+                    << std::endl;
+        }
+        out << std::left << std::setw(NAME_WIDTH) << "max" << std::right
+                << std::setw(NUMBER_WIDTH)
+                << histogram.getMax() / NS_PER_US << std::endl;
+    }
+
+    out.flags(flags);
+    out.precision(precision);
+}
@@ -0,0 +1,95 @@
+/*********************************************************************
+** Program name: ResponseTimer.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 8:50 AM
+** Description: Class specification file for ResponseTimer class.
+ *              ResponseTimer measures how responsive the interactive
+ *              game is: the time from a line of input being accepted
+ *              by ValidateInput to the next prompt being shown, which
+ *              covers handling the command and printing its output.
+ *              Times go into a LatencyHistogram, and are printed as
+ *              a ladder of percentiles. Timing stays off until
+ *              enable() is called, and then costs one clock read per
+ *              input and per prompt.
+*********************************************************************/
+
+
+#ifndef RESPONSE_TIMER_HPP
+#define RESPONSE_TIMER_HPP
+
+#include "LatencyHistogram.hpp"
+#include <chrono>
+#include <iostream>
+
+class ResponseTimer
+{
+private:
+    static bool enabled;
+    static bool waiting;        //true from an input to the next prompt
+    static std::chrono::steady_clock::time_point arrival;
+    static LatencyHistogram histogram;
+
+public:
+
+    /********************************************************************
+    ** Function: enable: Turns timing on or off.
+    ** Params:   bool on: true to time responses.
+    ** Returns:  None
+    *********************************************************************/
+    static void enable(bool on = true);
+
+
+    /********************************************************************
+    ** Function: isEnabled: Returns true if responses are being timed.
+    ** Params:   None
+    ** Returns:  bool: true if timing is on.
+    *********************************************************************/
+    static bool isEnabled();
+
+
+    /********************************************************************
+    ** Function: inputAccepted: Starts timing a response. ValidateInput
+     *           calls it when it accepts a line of input.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    static void inputAccepted();
+
+
+    /********************************************************************
+    ** Function: promptShown: Records the time since the last input
+     *           accepted, if it has not been recorded yet.
+     *           ValidateInput calls it after flushing each prompt.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    static void promptShown();
+
+
+    /********************************************************************
+    ** Function: getHistogram: Returns the response times recorded.
+    ** Params:   None
+    ** Returns:  const LatencyHistogram &: times in nanoseconds.
+    *********************************************************************/
+    static const LatencyHistogram &getHistogram();
+
+
+    /********************************************************************
+    ** Function: reset: Forgets every response timed.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    static void reset();
+
+
+    /********************************************************************
+    ** Function: print: Prints the number of responses, their mean, and
+     *           the time each percentile from p50 to p99.99 and the
+     *           maximum stayed under.
+    ** Params:   std::ostream &out: stream to print to.
+    ** Returns:  None
+    *********************************************************************/
+    static void print(std::ostream &out = std::cout);
+};
+
+#endif
@@ -0,0 +1,315 @@
+/*********************************************************************
+** Program name: ResultCache.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 18, 2026 at 9:40 PM
+** Description: Class implementation file for ResultCache class.
+ *              ResultCache stores outcomes of headless Zoo runs in a
+ *              directory on disk, so a run that has already been
+ *              simulated can be answered without simulating it again.
+ *              Each entry is a file named after a hash of everything
+ *              that decides the outcome: game constants, policy, seed,
+ *              and horizon. The cache has a size limit, and evicts the
+ *              least recently used entries when it goes over.
+*********************************************************************/
+
+
+#include "ResultCache.hpp"
+#include <cstdio>
+#include <vector>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+
+using std::string;
+using std::endl;
+
+//Initialize constants
+const long long ResultCache::SIZE_LIMIT_DEFAULT = 64LL * 1024 * 1024;
+const string ResultCache::CACHE_VERSION = "zoo-result-cache 4";
+const string ResultCache::ENTRY_EXTENSION = ".entry";
+
+/********************************************************************
+** Function: Constructor: Opens (creating if needed) a cache
+ *           directory and indexes the entries already in it,
+ *           ordered by their last use.
+** Params:   const string &directory: cache directory.
+ *           long long size_limit: maximum bytes of entries kept.
+** Returns:  None
+*********************************************************************/
+ResultCache::ResultCache(const string &directory, long long size_limit)
+    : directory(directory), size_limit(size_limit), total_size(0),
+    constants(Zoo::describeConstants()), hits(0), misses(0)
+{
+    //A used entry: file name, size, and last use time
+    struct Found
+    {
+        Entry entry;
+        struct timespec used;
+    };
+    std::vector<Found> found;
+
+    mkdir(directory.c_str(), 0755);
+
+    DIR *dir = opendir(directory.c_str());
+    if (!dir)
+    {
+        std::cerr << "Could not open result cache " << directory << endl;
+        return;
+    }
+
+    //collect every entry file in the directory
+    struct dirent *file;
+    while ((file = readdir(dir)) != nullptr)
+    {
+        string name = file->d_name;
+        struct stat info;
+
+        if (name.size() > ENTRY_EXTENSION.size()
+                && name.compare(name.size() - ENTRY_EXTENSION.size(),
+                        ENTRY_EXTENSION.size(), ENTRY_EXTENSION) == 0
+                && stat((directory + "/" + name).c_str(), &info) == 0)
+        {
+            Found entry = {{name, static_cast<long long>(info.st_size)},
+                            info.st_mtim};
+            found.push_back(entry);
+        }
+    }
+    closedir(dir);
+
+    //most recently used first
+    std::sort(found.begin(), found.end(),
+            [](const Found &a, const Found &b)
+            {
+                return a.used.tv_sec != b.used.tv_sec
+                        ? a.used.tv_sec > b.used.tv_sec
+                        : a.used.tv_nsec > b.used.tv_nsec;
+            });
+
+    for (size_t i=0; i<found.size(); i++)
+    {
+        recently_used.push_back(found[i].entry);
+        entries[found[i].entry.name] = --recently_used.end();
+        total_size += found[i].entry.size;
+    }
+
+    //the limit may have shrunk since the cache was last used
+    evict();
+}
+
+
+/********************************************************************
+** Function: find: Looks up a stored outcome and marks it as
+ *           recently used.
+** Params:   const Zoo::Policy &policy: policy of the run.
+ *           unsigned int seed: seed of the run.
+ *           int horizon: horizon of the run.
+ *           Zoo::Outcome &outcome: set to the stored outcome.
+** Returns:  bool: true if the outcome was in the cache.
+*********************************************************************/
+bool ResultCache::find(const Zoo::Policy &policy, unsigned int seed,
+                        int horizon, Zoo::Outcome &outcome)
+{
+    Tracer::Scope span("cache find");
+
+    const string key = makeKey(policy, seed, horizon);
+    const string name = hashKey(key);
+
+    if (entries.find(name) == entries.end())
+    {
+        misses++;
+        return false;
+    }
+
+    std::ifstream fileIn(directory + "/" + name);
+    string stored_key;
+    Zoo::Outcome stored;
+    int64_t bank_cents;
+
+    getline(fileIn, stored_key);
+    fileIn >> stored.days >> stored.bankrupt >> bank_cents
+            >> stored.population >> stored.overflowed;
+    stored.bank_account = Money::fromCents(bank_cents);
+
+    //a different key means a hash collision, treat it as a miss
+    if (!fileIn || stored_key != key)
+    {
+        misses++;
+        return false;
+    }
+
+    touch(name);
+    outcome = stored;
+    hits++;
+    return true;
+}
+
+
+/********************************************************************
+** Function: store: Saves an outcome, then evicts least recently
+ *           used entries until the cache fits its size limit.
+** Params:   const Zoo::Policy &policy: policy of the run.
+ *           unsigned int seed: seed of the run.
+ *           int horizon: horizon of the run.
+ *           const Zoo::Outcome &outcome: outcome to save.
+** Returns:  None
+*********************************************************************/
+void ResultCache::store(const Zoo::Policy &policy, unsigned int seed,
+                        int horizon, const Zoo::Outcome &outcome)
+{
+    Tracer::Scope span("cache store");
+
+    const string key = makeKey(policy, seed, horizon);
+    const string name = hashKey(key);
+    const string path = directory + "/" + name;
+    const string temp_path = path + ".tmp";
+
+    //write to a temporary file first so readers never see half an entry
+    std::ofstream fileOut(temp_path);
+    if (!fileOut)
+    {
+        return;
+    }
+    fileOut << key << endl;
+    fileOut << outcome.days << " " << outcome.bankrupt << " "
+            << outcome.bank_account.getCents() << " "
+            << outcome.population << " " << outcome.overflowed << endl;
+
+    long long size = static_cast<long long>(fileOut.tellp());
+    fileOut.close();
+
+    if (!fileOut || std::rename(temp_path.c_str(), path.c_str()))
+    {
+        std::remove(temp_path.c_str());
+        return;
+    }
+
+    //replace any older entry with the same name
+    std::map<string, std::list<Entry>::iterator>::iterator old =
+            entries.find(name);
+    if (old != entries.end())
+    {
+        total_size -= old->second->size;
+        recently_used.erase(old->second);
+        entries.erase(old);
+    }
+
+    Entry entry = {name, size};
+    recently_used.push_front(entry);
+    entries[name] = recently_used.begin();
+    total_size += size;
+
+    evict();
+}
+
+
+/********************************************************************
+** Function: getHits/getMisses: Returns number of finds that were
+ *           found/not found since the cache was opened.
+** Params:   None
+** Returns:  long long: the count.
+*********************************************************************/
+long long ResultCache::getHits() const
+{
+    return hits;
+}
+
+long long ResultCache::getMisses() const
+{
+    return misses;
+}
+
+
+/********************************************************************
+** Function: makeKey: Formats everything that decides a run's
+ *           outcome into one string.
+** Params:   const Zoo::Policy &policy, unsigned int seed,
+ *           int horizon: the run.
+** Returns:  string: the key.
+*********************************************************************/
+string ResultCache::makeKey(const Zoo::Policy &policy, unsigned int seed,
+                            int horizon) const
+{
+    std::ostringstream key;
+    key << CACHE_VERSION << "|" << constants << "|"
+            << Zoo::describePolicy(policy) << "|" << seed << "|" << horizon;
+    return key.str();
+}
+
+
+/********************************************************************
+** Function: hashKey: Hashes a key with 64-bit FNV-1a and formats
+ *           it as an entry file name.
+** Params:   const string &key: key from makeKey.
+** Returns:  string: 16 hex digits plus ENTRY_EXTENSION.
+*********************************************************************/
+string ResultCache::hashKey(const string &key)
+{
+    const unsigned long long FNV_OFFSET = 14695981039346656037ULL;
+    const unsigned long long FNV_PRIME = 1099511628211ULL;
+    const int HEX_DIGITS = 16;
+
+    unsigned long long hash = FNV_OFFSET;
+    for (size_t i=0; i<key.size(); i++)
+    {
+        hash ^= static_cast<unsigned char>(key[i]);
+        hash *= FNV_PRIME;
+    }
+
+    std::ostringstream name;
+    name << std::hex << std::setfill('0') << std::setw(HEX_DIGITS) << hash
+            << ENTRY_EXTENSION;
+    return name.str();
+}
+
+
+/********************************************************************
+** Function: touch: Moves an entry to the front of the recently used
+ *           list, and updates its file time so the order survives
+ *           reopening the cache.
+** Params:   const string &name: entry file name.
+** Returns:  None
+*********************************************************************/
+void ResultCache::touch(const string &name)
+{
+    std::list<Entry>::iterator entry = entries[name];
+    recently_used.splice(recently_used.begin(), recently_used, entry);
+
+    //null times means set both to now
+    utimensat(AT_FDCWD, (directory + "/" + name).c_str(), nullptr, 0);
+}
+
+
+/********************************************************************
+** Function: evict: Removes least recently used entries until
+ *           total_size is within size_limit.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void ResultCache::evict()
+{
+    while (total_size > size_limit && !recently_used.empty())
+    {
+        remove(recently_used.back().name);
+    }
+}
+
+
+/********************************************************************
+** Function: remove: Deletes an entry file and forgets it.
+** Params:   const string &name: entry file name.
+** Returns:  None
+*********************************************************************/
+void ResultCache::remove(const string &name)
+{
+    std::map<string, std::list<Entry>::iterator>::iterator entry =
+            entries.find(name);
+    if (entry == entries.end())
+    {
+        return;
+    }
+
+    std::remove((directory + "/" + name).c_str());
+    total_size -= entry->second->size;
+    recently_used.erase(entry->second);
+    entries.erase(entry);
+}
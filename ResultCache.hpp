@@ -0,0 +1,154 @@
+/*********************************************************************
+** Program name: ResultCache.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 18, 2026 at 9:40 PM
+** Description: Class specification file for ResultCache class.
+ *              ResultCache stores outcomes of headless Zoo runs in a
+ *              directory on disk, so a run that has already been
+ *              simulated can be answered without simulating it again.
+ *              Each entry is a file named after a hash of everything
+ *              that decides the outcome: game constants, policy, seed,
+ *              and horizon. The cache has a size limit, and evicts the
+ *              least recently used entries when it goes over.
+*********************************************************************/
+
+
+#ifndef RESULT_CACHE_HPP
+#define RESULT_CACHE_HPP
+
+#include "Zoo.hpp"
+#include <string>
+#include <list>
+#include <map>
+
+class ResultCache
+{
+public:
+    //Default size limit of the cache directory, 64 MB
+    static const long long SIZE_LIMIT_DEFAULT;
+
+private:
+    //Bump when a change makes old entries play out differently
+    static const std::string CACHE_VERSION;
+    static const std::string ENTRY_EXTENSION;
+
+    //An entry file in the cache directory
+    struct Entry
+    {
+        std::string name;       //file name inside the directory
+        long long size;         //file size in bytes
+    };
+
+    std::string directory;
+    long long size_limit;
+    long long total_size;
+
+    //Game constants are the same for every lookup, format them once
+    std::string constants;
+
+    //Entries from most to least recently used, and an index into it
+    std::list<Entry> recently_used;
+    std::map<std::string, std::list<Entry>::iterator> entries;
+
+    long long hits;
+    long long misses;
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor: Opens (creating if needed) a cache
+     *           directory and indexes the entries already in it,
+     *           ordered by their last use.
+    ** Params:   const string &directory: cache directory.
+     *           long long size_limit: maximum bytes of entries kept.
+    ** Returns:  None
+    *********************************************************************/
+    ResultCache(const std::string &directory,
+                long long size_limit = SIZE_LIMIT_DEFAULT);
+
+
+    /********************************************************************
+    ** Function: find: Looks up a stored outcome and marks it as
+     *           recently used.
+    ** Params:   const Zoo::Policy &policy: policy of the run.
+     *           unsigned int seed: seed of the run.
+     *           int horizon: horizon of the run.
+     *           Zoo::Outcome &outcome: set to the stored outcome.
+    ** Returns:  bool: true if the outcome was in the cache.
+    *********************************************************************/
+    bool find(const Zoo::Policy &policy, unsigned int seed, int horizon,
+                Zoo::Outcome &outcome);
+
+
+    /********************************************************************
+    ** Function: store: Saves an outcome, then evicts least recently
+     *           used entries until the cache fits its size limit.
+    ** Params:   const Zoo::Policy &policy: policy of the run.
+     *           unsigned int seed: seed of the run.
+     *           int horizon: horizon of the run.
+     *           const Zoo::Outcome &outcome: outcome to save.
+    ** Returns:  None
+    *********************************************************************/
+    void store(const Zoo::Policy &policy, unsigned int seed, int horizon,
+                const Zoo::Outcome &outcome);
+
+
+    /********************************************************************
+    ** Function: getHits/getMisses: Returns number of finds that were
+     *           found/not found since the cache was opened.
+    ** Params:   None
+    ** Returns:  long long: the count.
+    *********************************************************************/
+    long long getHits() const;
+    long long getMisses() const;
+
+private:
+
+    /********************************************************************
+    ** Function: makeKey: Formats everything that decides a run's
+     *           outcome into one string.
+    ** Params:   const Zoo::Policy &policy, unsigned int seed,
+     *           int horizon: the run.
+    ** Returns:  string: the key.
+    *********************************************************************/
+    std::string makeKey(const Zoo::Policy &policy, unsigned int seed,
+                        int horizon) const;
+
+
+    /********************************************************************
+    ** Function: hashKey: Hashes a key with 64-bit FNV-1a and formats
+     *           it as an entry file name.
+    ** Params:   const string &key: key from makeKey.
+    ** Returns:  string: 16 hex digits plus ENTRY_EXTENSION.
+    *********************************************************************/
+    static std::string hashKey(const std::string &key);
+
+
+    /********************************************************************
+    ** Function: touch: Moves an entry to the front of the recently used
+     *           list, and updates its file time so the order survives
+     *           reopening the cache.
+    ** Params:   const string &name: entry file name.
+    ** Returns:  None
+    *********************************************************************/
+    void touch(const std::string &name);
+
+
+    /********************************************************************
+    ** Function: evict: Removes least recently used entries until
+     *           total_size is within size_limit.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void evict();
+
+
+    /********************************************************************
+    ** Function: remove: Deletes an entry file and forgets it.
+    ** Params:   const string &name: entry file name.
+    ** Returns:  None
+    *********************************************************************/
+    void remove(const std::string &name);
+};
+
+#endif
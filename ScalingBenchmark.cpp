@@ -0,0 +1,414 @@
+/*********************************************************************
+** Program name: ScalingBenchmark.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 9:30 AM
+** Description: Class implementation file for ScalingBenchmark class.
+ *              A ScalingBenchmark runs a fixed amount of zoo work on
+ *              1, 2, 4, ... up to a maximum number of threads, to
+ *              show how many cores zoo workloads can use. There are
+ *              two workloads: many small zoos, each simulated for
+ *              Benchmark::DAY_LOOP_DAYS days, and one giant zoo of
+ *              GIANT_POPULATION animals, kept as single animals,
+ *              whose daily passes are split between the threads, which
+ *              are joined once a day. For each thread count it
+ *              reports throughput, speedup, parallel efficiency, and
+ *              the Karp-Flatt serial fraction, then fits Amdahl's law
+ *              to all of them for one serial fraction per workload.
+*********************************************************************/
+
+
+#include "ScalingBenchmark.hpp"
+#include "Benchmark.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <limits>
+#include <thread>
+
+using std::endl;
+using std::vector;
+
+//Initialize constants
+const char *const ScalingBenchmark::WORKLOAD_NAMES[] =
+        {"small zoos", "giant zoo"};
+const char *const ScalingBenchmark::UNIT_NAMES[] =
+        {"zoo days/s", "animal days/s"};
+const int ScalingBenchmark::SMALL_ZOO_COUNT = 2048;
+const int64_t ScalingBenchmark::GIANT_POPULATION = 1000000;
+const int ScalingBenchmark::GIANT_DAYS = 256;
+const int ScalingBenchmark::REPEATS = 3;
+
+//First seed of the small zoos, each zoo gets the next one
+static const unsigned int FIRST_SEED = 1;
+//Exhibits the giant zoo's animals are spread over
+static const SpeciesId GIANT_TYPES[] = {TIGER, PENGUIN, TURTLE};
+static const int GIANT_TYPES_SIZE = 3;
+
+/********************************************************************
+** Function: Constructor: Sets up a benchmark of 1, 2, 4, ... up to
+ *           max_threads threads, always including max_threads.
+** Params:   int max_threads: most threads to run on, 0 for one
+ *              per hardware thread.
+** Returns:  None
+*********************************************************************/
+ScalingBenchmark::ScalingBenchmark(int max_threads)
+    : max_threads(max_threads)
+{
+    if (this->max_threads <= 0)
+    {
+        //hardware_concurrency may not know, and then says 0
+        this->max_threads = std::max(
+                static_cast<int>(std::thread::hardware_concurrency()), 1);
+    }
+}
+
+
+/********************************************************************
+** Function: run: Times both workloads at every thread count.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void ScalingBenchmark::run()
+{
+    const int THREAD_STEP = 2;
+
+    //the registry fills itself on first use, which must not race
+    SpeciesRegistry::size();
+
+    vector<int> thread_counts;
+    for (int threads=1; threads<max_threads; threads*=THREAD_STEP)
+    {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(max_threads);
+
+    for (int repeat=0; repeat<REPEATS; repeat++)
+    {
+        for (size_t i=0; i<thread_counts.size(); i++)
+        {
+            timeSmallZoos(thread_counts[i]);
+        }
+    }
+
+    //filling the giant zoo is not timed, and it is kept for reuse.
+    //Cohorts would make a day's passes barely depend on the population
+    Zoo zoo(Zoo::DEFAULT_POLICY, FIRST_SEED);
+    zoo.setCohortThreshold(std::numeric_limits<int>::max());
+    for (int64_t i=0; i<GIANT_POPULATION; i++)
+    {
+        zoo.addAnimal(GIANT_TYPES[i % GIANT_TYPES_SIZE], ZERO, true);
+    }
+
+    for (int repeat=0; repeat<REPEATS; repeat++)
+    {
+        for (size_t i=0; i<thread_counts.size(); i++)
+        {
+            timeGiantZoo(zoo, thread_counts[i]);
+        }
+    }
+}
+
+
+/********************************************************************
+** Function: getResults: Returns the results, by workload, then by
+ *           thread count.
+** Params:   None
+** Returns:  const vector<Result> &: the results.
+*********************************************************************/
+const vector<ScalingBenchmark::Result> &ScalingBenchmark::getResults() const
+{
+    return results;
+}
+
+
+/********************************************************************
+** Function: getSerialFraction: Fits Amdahl's law, speedup =
+ *           1 / (s + (1 - s) / threads), to a workload's speedups
+ *           by least squares.
+** Params:   Workload workload: workload to fit.
+** Returns:  double: serial fraction s from 0 to 1, -1 if there is
+ *              no result on more than one thread.
+*********************************************************************/
+double ScalingBenchmark::getSerialFraction(Workload workload) const
+{
+    double serial_seconds = 0;
+    for (size_t i=0; i<results.size(); i++)
+    {
+        if (results[i].workload == workload && results[i].threads == 1)
+        {
+            serial_seconds = results[i].seconds;
+        }
+    }
+
+    //1/speedup - 1/threads = s * (1 - 1/threads), a line through 0
+    double sum_xy = 0;
+    double sum_xx = 0;
+    for (size_t i=0; i<results.size(); i++)
+    {
+        const Result &result = results[i];
+        if (result.workload != workload || result.threads < 2
+                || serial_seconds <= 0)
+        {
+            continue;
+        }
+
+        double x = 1 - 1.0 / result.threads;
+        double y = result.seconds / serial_seconds - 1.0 / result.threads;
+        sum_xy += x * y;
+        sum_xx += x * x;
+    }
+
+    if (sum_xx == 0)
+    {
+        return -1;
+    }
+    return std::min(std::max(sum_xy / sum_xx, 0.0), 1.0);
+}
+
+
+/********************************************************************
+** Function: printReport: Prints a table per workload, then its
+ *           serial fraction and the speedup that allows at most.
+** Params:   std::ostream &out: stream to print to.
+** Returns:  None
+*********************************************************************/
+void ScalingBenchmark::printReport(std::ostream &out) const
+{
+    const int NUMBER_WIDTH = 16;
+    const double PERCENT = 100;
+
+    std::ios::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+
+    out << std::fixed;
+    for (int w=0; w<NUM_WORKLOADS; w++)
+    {
+        Workload workload = static_cast<Workload>(w);
+        double serial_seconds = 0;
+
+        out << WORKLOAD_NAMES[w] << ":" << endl;
+        out << std::setw(NUMBER_WIDTH) << "threads"
+                << std::setw(NUMBER_WIDTH) << "seconds"
+                << std::setw(NUMBER_WIDTH) << UNIT_NAMES[w]
+                << std::setw(NUMBER_WIDTH) << "speedup"
+                << std::setw(NUMBER_WIDTH) << "efficiency"
+                << std::setw(NUMBER_WIDTH) << "karp-flatt" << endl;
+
+        for (size_t i=0; i<results.size(); i++)
+        {
+            const Result &result = results[i];
+            if (result.workload != workload)
+            {
+                continue;
+            }
+            if (result.threads == 1)
+            {
+                serial_seconds = result.seconds;
+            }
+
+            double speedup = serial_seconds / result.seconds;
+            out << std::setw(NUMBER_WIDTH) << result.threads
+                    << std::setw(NUMBER_WIDTH) << std::setprecision(3)
+                    << result.seconds
+                    << std::setw(NUMBER_WIDTH) << std::setprecision(0)
+                    << result.units / result.seconds
+                    << std::setw(NUMBER_WIDTH) << std::setprecision(2)
+                    << speedup
+                    << std::setw(NUMBER_WIDTH - 1) << std::setprecision(1)
+                    << speedup / result.threads * PERCENT << "%"
+                    << std::setw(NUMBER_WIDTH);
+
+            //the serial fraction this one speedup implies
+            if (result.threads > 1)
+            {
+                double threads = result.threads;
+                out << std::setprecision(3)
+                        << (1 / speedup - 1 / threads) / (1 - 1 / threads);
+            }
+            else
+            {
+                out << "-";
+            }
+            out << endl;
+        }
+
+        double serial_fraction = getSerialFraction(workload);
+        if (serial_fraction < 0)
+        {
+            out << "Amdahl serial fraction: n/a, needs more than one thread"
+                    << endl;
+        }
+        else
+        {
+            out << "Amdahl serial fraction: " << std::setprecision(3)
+                    << serial_fraction << ", so at most ";
+            if (serial_fraction > 0)
+            {
+                out << std::setprecision(1) << 1 / serial_fraction
+                        << "x speedup";
+            }
+            else
+            {
+                out << "linear speedup";
+            }
+            out << endl;
+        }
+        out << endl;
+    }
+
+    out.flags(flags);
+    out.precision(precision);
+}
+
+
+/********************************************************************
+** Function: timeSmallZoos: Simulates SMALL_ZOO_COUNT zoos on threads
+ *           threads, each taking the next zoo until none are left.
+** Params:   int threads: threads to run on.
+** Returns:  None
+*********************************************************************/
+void ScalingBenchmark::timeSmallZoos(int threads)
+{
+    std::atomic<int> next_zoo(0);
+    std::atomic<int64_t> days(0);
+    vector<std::thread> workers;
+
+    std::chrono::steady_clock::time_point start =
+            std::chrono::steady_clock::now();
+    for (int t=0; t<threads; t++)
+    {
+        workers.push_back(std::thread(simulateSmallZoos, &next_zoo, &days));
+    }
+    for (int t=0; t<threads; t++)
+    {
+        workers[t].join();
+    }
+    std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+
+    addResult(SMALL_ZOOS, threads, elapsed.count(),
+                static_cast<double>(days.load()));
+}
+
+
+/********************************************************************
+** Function: timeGiantZoo: Runs GIANT_DAYS days of daily passes over
+ *           one zoo, each day split between threads threads. Each
+ *           thread ages its share of every exhibit and adds up the
+ *           feeding costs and payoffs of its range of exhibits. Once
+ *           all are joined, the day's totals go to the bank.
+** Params:   Zoo &zoo: full giant zoo.
+ *           int threads: threads to run on.
+** Returns:  None
+*********************************************************************/
+void ScalingBenchmark::timeGiantZoo(Zoo &zoo, int threads)
+{
+    vector<Money> feeding_costs(threads);
+    vector<Money> profits(threads);
+    vector<std::thread> workers;
+
+    std::chrono::steady_clock::time_point start =
+            std::chrono::steady_clock::now();
+    for (int day=0; day<GIANT_DAYS; day++)
+    {
+        workers.clear();
+        for (int t=0; t<threads; t++)
+        {
+            workers.push_back(std::thread(runGiantShare, &zoo, t, threads,
+                                            &feeding_costs[t], &profits[t]));
+        }
+
+        //the day ends when every share is done
+        Money feeding_cost;
+        Money profit = zoo.tiger_bonus;
+        for (int t=0; t<threads; t++)
+        {
+            workers[t].join();
+            feeding_cost += feeding_costs[t];
+            profit += profits[t];
+        }
+        zoo.subFromBank(feeding_cost);
+        zoo.addToBank(profit);
+    }
+    std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+
+    addResult(GIANT_ZOO, threads, elapsed.count(),
+                static_cast<double>(GIANT_DAYS) * GIANT_POPULATION);
+}
+
+
+/********************************************************************
+** Function: simulateSmallZoos: Thread body, simulates small zoos
+ *           until none are left.
+** Params:   std::atomic<int> *next_zoo: index of the next zoo.
+ *           std::atomic<int64_t> *days: days simulated, added to.
+** Returns:  None
+*********************************************************************/
+void ScalingBenchmark::simulateSmallZoos(std::atomic<int> *next_zoo,
+                                            std::atomic<int64_t> *days)
+{
+    int64_t my_days = 0;
+    for (int i=next_zoo->fetch_add(1); i<SMALL_ZOO_COUNT;
+            i=next_zoo->fetch_add(1))
+    {
+        //each thread seeds its own random numbers, see MyRandom
+        Zoo zoo(Zoo::DEFAULT_POLICY, FIRST_SEED + i);
+        my_days += zoo.simulate(Benchmark::DAY_LOOP_DAYS).days;
+    }
+    days->fetch_add(my_days);
+}
+
+
+/********************************************************************
+** Function: runGiantShare: Thread body, runs one share of a day's
+ *           daily passes over the giant zoo.
+** Params:   Zoo *zoo: the giant zoo.
+ *           int share: this thread's share, from 0 to shares - 1.
+ *           int shares: threads the day is split between.
+ *           Money *feeding_cost: set to the share's feeding cost.
+ *           Money *profit: set to the share's payoffs.
+** Returns:  None
+*********************************************************************/
+void ScalingBenchmark::runGiantShare(Zoo *zoo, int share, int shares,
+                                        Money *feeding_cost, Money *profit)
+{
+    //only aging visits every animal, the exhibits are few
+    int first = zoo->num_exhibits * share / shares;
+    int last = zoo->num_exhibits * (share + 1) / shares;
+
+    zoo->increaseAnimalsAgeShare(share, shares);
+    *feeding_cost = zoo->getFeedingCost(first, last);
+    *profit = zoo->getAnimalProfits(first, last);
+}
+
+
+/********************************************************************
+** Function: addResult: Records a run, keeping only the fastest of
+ *           a workload and thread count.
+** Params:   Workload workload: workload run.
+ *           int threads: threads it ran on.
+ *           double seconds: wall time of the run.
+ *           double units: zoo days or animal days simulated.
+** Returns:  None
+*********************************************************************/
+void ScalingBenchmark::addResult(Workload workload, int threads,
+                                    double seconds, double units)
+{
+    for (size_t i=0; i<results.size(); i++)
+    {
+        Result &result = results[i];
+        if (result.workload == workload && result.threads == threads)
+        {
+            if (seconds < result.seconds)
+            {
+                result.seconds = seconds;
+                result.units = units;
+            }
+            return;
+        }
+    }
+
+    Result result = {workload, threads, seconds, units};
+    results.push_back(result);
+}
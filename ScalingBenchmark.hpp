@@ -0,0 +1,170 @@
+/*********************************************************************
+** Program name: ScalingBenchmark.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 9:30 AM
+** Description: Class specification file for ScalingBenchmark class.
+ *              A ScalingBenchmark runs a fixed amount of zoo work on
+ *              1, 2, 4, ... up to a maximum number of threads, to
+ *              show how many cores zoo workloads can use. There are
+ *              two workloads: many small zoos, each simulated for
+ *              Benchmark::DAY_LOOP_DAYS days, and one giant zoo of
+ *              GIANT_POPULATION animals, whose daily passes are split
+ *              between the threads, which are joined once a day. For
+ *              each thread count it
+ *              reports throughput, speedup, parallel efficiency, and
+ *              the Karp-Flatt serial fraction, then fits Amdahl's law
+ *              to all of them for one serial fraction per workload.
+*********************************************************************/
+
+
+#ifndef SCALING_BENCHMARK_HPP
+#define SCALING_BENCHMARK_HPP
+
+#include "Zoo.hpp"
+#include <atomic>
+#include <iostream>
+#include <vector>
+
+class ScalingBenchmark
+{
+public:
+    //Work run at every thread count
+    enum Workload {SMALL_ZOOS, GIANT_ZOO, NUM_WORKLOADS};
+
+    //Name of each workload, and of the unit its throughput is in
+    static const char *const WORKLOAD_NAMES[];
+    static const char *const UNIT_NAMES[];
+
+    //Best of REPEATS runs of one workload on some threads
+    struct Result
+    {
+        Workload workload;
+        int threads;
+        double seconds;     //wall time of the whole workload
+        double units;       //zoo days or animal days simulated
+    };
+
+    //Small zoos simulated in all, split between the threads
+    static const int SMALL_ZOO_COUNT;
+    //Animals in the giant zoo
+    static const int64_t GIANT_POPULATION;
+    //Days of daily passes run, each split between the threads
+    static const int GIANT_DAYS;
+    //Runs of each workload and thread count, the fastest is kept
+    static const int REPEATS;
+
+private:
+    int max_threads;
+    std::vector<Result> results;
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor: Sets up a benchmark of 1, 2, 4, ... up to
+     *           max_threads threads, always including max_threads.
+    ** Params:   int max_threads: most threads to run on, 0 for one
+     *              per hardware thread.
+    ** Returns:  None
+    *********************************************************************/
+    ScalingBenchmark(int max_threads = 0);
+
+
+    /********************************************************************
+    ** Function: run: Times both workloads at every thread count.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void run();
+
+
+    /********************************************************************
+    ** Function: getResults: Returns the results, by workload, then by
+     *           thread count.
+    ** Params:   None
+    ** Returns:  const vector<Result> &: the results.
+    *********************************************************************/
+    const std::vector<Result> &getResults() const;
+
+
+    /********************************************************************
+    ** Function: getSerialFraction: Fits Amdahl's law, speedup =
+     *           1 / (s + (1 - s) / threads), to a workload's speedups
+     *           by least squares.
+    ** Params:   Workload workload: workload to fit.
+    ** Returns:  double: serial fraction s from 0 to 1, -1 if there is
+     *              no result on more than one thread.
+    *********************************************************************/
+    double getSerialFraction(Workload workload) const;
+
+
+    /********************************************************************
+    ** Function: printReport: Prints a table per workload, then its
+     *           serial fraction and the speedup that allows at most.
+    ** Params:   std::ostream &out: stream to print to.
+    ** Returns:  None
+    *********************************************************************/
+    void printReport(std::ostream &out = std::cout) const;
+
+private:
+
+    /********************************************************************
+    ** Function: timeSmallZoos: Simulates SMALL_ZOO_COUNT zoos on threads
+     *           threads, each taking the next zoo until none are left.
+    ** Params:   int threads: threads to run on.
+    ** Returns:  None
+    *********************************************************************/
+    void timeSmallZoos(int threads);
+
+
+    /********************************************************************
+    ** Function: timeGiantZoo: Runs GIANT_DAYS days of daily passes over
+     *           one zoo, each day split between threads threads. Each
+     *           thread ages its share of every exhibit and adds up the
+     *           feeding costs and payoffs of its range of exhibits. Once
+     *           all are joined, the day's totals go to the bank.
+    ** Params:   Zoo &zoo: full giant zoo.
+     *           int threads: threads to run on.
+    ** Returns:  None
+    *********************************************************************/
+    void timeGiantZoo(Zoo &zoo, int threads);
+
+
+    /********************************************************************
+    ** Function: simulateSmallZoos: Thread body, simulates small zoos
+     *           until none are left.
+    ** Params:   std::atomic<int> *next_zoo: index of the next zoo.
+     *           std::atomic<int64_t> *days: days simulated, added to.
+    ** Returns:  None
+    *********************************************************************/
+    static void simulateSmallZoos(std::atomic<int> *next_zoo,
+                                    std::atomic<int64_t> *days);
+
+
+    /********************************************************************
+    ** Function: runGiantShare: Thread body, runs one share of a day's
+     *           daily passes over the giant zoo.
+    ** Params:   Zoo *zoo: the giant zoo.
+     *           int share: this thread's share, from 0 to shares - 1.
+     *           int shares: threads the day is split between.
+     *           Money *feeding_cost: set to the share's feeding cost.
+     *           Money *profit: set to the share's payoffs.
+    ** Returns:  None
+    *********************************************************************/
+    static void runGiantShare(Zoo *zoo, int share, int shares,
+                                Money *feeding_cost, Money *profit);
+
+
+    /********************************************************************
+    ** Function: addResult: Records a run, keeping only the fastest of
+     *           a workload and thread count.
+    ** Params:   Workload workload: workload run.
+     *           int threads: threads it ran on.
+     *           double seconds: wall time of the run.
+     *           double units: zoo days or animal days simulated.
+    ** Returns:  None
+    *********************************************************************/
+    void addResult(Workload workload, int threads, double seconds,
+                    double units);
+};
+
+#endif
@@ -0,0 +1,153 @@
+/*********************************************************************
+** Program name: SlotMap.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 1:45 AM
+** Description: Class implementation file for SlotMap class. SlotMap
+ *              hands out stable handles to animals whose place in an
+ *              exhibit array keeps changing. Each handle names a slot
+ *              that records the animal's exhibit and index, and the
+ *              Zoo updates the slot whenever it moves the animal.
+ *              Insert, remove, and lookup are all O(1). Freed slots
+ *              are reused, and each slot counts how many times it has
+ *              been freed, so a handle to a removed animal is never
+ *              mistaken for the animal that reused its slot.
+*********************************************************************/
+
+
+#include "SlotMap.hpp"
+
+//Initialize constants
+const SlotMap::Handle SlotMap::NO_HANDLE = {UINT32_MAX, 0};
+
+/********************************************************************
+** Function: Constructor/default: Initializes an empty slot map.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+SlotMap::SlotMap() : free_head(-1)
+{}
+
+
+/********************************************************************
+** Function: insert: Gives a new animal a slot, reusing a free one
+ *           if there is one. Once every slot a handle can name is
+ *           in use, the animal gets no slot.
+** Params:   int exhibit: exhibit the animal is in.
+ *           int64_t position: index of the animal in the exhibit.
+** Returns:  Handle: handle to the animal, NO_HANDLE if there was
+ *              no slot left.
+*********************************************************************/
+SlotMap::Handle SlotMap::insert(int exhibit, int64_t position)
+{
+    uint32_t index;
+
+    if (free_head >= 0)
+    {
+        index = static_cast<uint32_t>(free_head);
+        free_head = slots[index].position;
+    }
+    else if (slots.size() >= NO_HANDLE.index)
+    {
+        //the last index means no handle, so it is never a slot
+        return NO_HANDLE;
+    }
+    else
+    {
+        index = static_cast<uint32_t>(slots.size());
+        Slot slot = {0, -1, -1};
+        slots.push_back(slot);
+    }
+
+    slots[index].exhibit = exhibit;
+    slots[index].position = position;
+
+    Handle handle = {index, slots[index].generation};
+    return handle;
+}
+
+
+/********************************************************************
+** Function: remove: Frees the slot of a removed animal. Handles to
+ *           it stop finding anything.
+** Params:   uint32_t index: slot of the animal, ignored if it is
+ *              NO_HANDLE's.
+** Returns:  None
+*********************************************************************/
+void SlotMap::remove(uint32_t index)
+{
+    if (index == NO_HANDLE.index)
+    {
+        return;
+    }
+
+    slots[index].generation++;
+    slots[index].exhibit = -1;
+    slots[index].position = free_head;
+    free_head = index;
+}
+
+
+/********************************************************************
+** Function: move: Records that an animal moved within its exhibit.
+** Params:   uint32_t index: slot of the animal, ignored if it is
+ *              NO_HANDLE's.
+ *           int64_t position: its new index in the exhibit.
+** Returns:  None
+*********************************************************************/
+void SlotMap::move(uint32_t index, int64_t position)
+{
+    if (index != NO_HANDLE.index)
+    {
+        slots[index].position = position;
+    }
+}
+
+
+/********************************************************************
+** Function: getHandle: Returns the handle to the animal in a slot.
+** Params:   uint32_t index: slot of the animal.
+** Returns:  Handle: handle to it, NO_HANDLE if index is NO_HANDLE's.
+*********************************************************************/
+SlotMap::Handle SlotMap::getHandle(uint32_t index) const
+{
+    if (index == NO_HANDLE.index)
+    {
+        return NO_HANDLE;
+    }
+
+    Handle handle = {index, slots[index].generation};
+    return handle;
+}
+
+
+/********************************************************************
+** Function: find: Looks up where the animal of a handle is.
+** Params:   Handle handle: handle from insert.
+ *           int &exhibit: set to the animal's exhibit.
+ *           int64_t &position: set to the animal's index in it.
+** Returns:  bool: false if the animal has been removed.
+*********************************************************************/
+bool SlotMap::find(Handle handle, int &exhibit, int64_t &position) const
+{
+    if (handle.index >= slots.size()
+            || slots[handle.index].generation != handle.generation
+            || slots[handle.index].exhibit < 0)
+    {
+        return false;
+    }
+
+    exhibit = slots[handle.index].exhibit;
+    position = slots[handle.index].position;
+    return true;
+}
+
+
+/********************************************************************
+** Function: getBytes: Returns bytes of memory held by the slots.
+** Params:   None
+** Returns:  size_t: bytes of slot storage, counting spare capacity.
+*********************************************************************/
+size_t SlotMap::getBytes() const
+{
+    return slots.capacity() * sizeof(Slot);
+}
@@ -0,0 +1,117 @@
+/*********************************************************************
+** Program name: SlotMap.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 1:45 AM
+** Description: Class specification file for SlotMap class. SlotMap
+ *              hands out stable handles to animals whose place in an
+ *              exhibit array keeps changing. Each handle names a slot
+ *              that records the animal's exhibit and index, and the
+ *              Zoo updates the slot whenever it moves the animal.
+ *              Insert, remove, and lookup are all O(1). Freed slots
+ *              are reused, and each slot counts how many times it has
+ *              been freed, so a handle to a removed animal is never
+ *              mistaken for the animal that reused its slot.
+*********************************************************************/
+
+
+#ifndef SLOT_MAP_HPP
+#define SLOT_MAP_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+class SlotMap
+{
+public:
+    //Stable reference to one animal
+    struct Handle
+    {
+        uint32_t index;         //slot of the animal
+        uint32_t generation;    //times the slot was freed when handed out
+    };
+
+    //Handle that never finds an animal
+    static const Handle NO_HANDLE;
+
+private:
+    //Where one animal is, or a link in the free list
+    struct Slot
+    {
+        uint32_t generation;
+        int exhibit;            //exhibit of the animal, -1 if free
+        int64_t position;       //index in the exhibit, or next free slot
+    };
+
+    std::vector<Slot> slots;
+    int64_t free_head;          //first free slot, -1 if none
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor/default: Initializes an empty slot map.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    SlotMap();
+
+
+    /********************************************************************
+    ** Function: insert: Gives a new animal a slot, reusing a free one
+     *           if there is one. Once every slot a handle can name is
+     *           in use, the animal gets no slot.
+    ** Params:   int exhibit: exhibit the animal is in.
+     *           int64_t position: index of the animal in the exhibit.
+    ** Returns:  Handle: handle to the animal, NO_HANDLE if there was
+     *              no slot left.
+    *********************************************************************/
+    Handle insert(int exhibit, int64_t position);
+
+
+    /********************************************************************
+    ** Function: remove: Frees the slot of a removed animal. Handles to
+     *           it stop finding anything.
+    ** Params:   uint32_t index: slot of the animal, ignored if it is
+     *              NO_HANDLE's.
+    ** Returns:  None
+    *********************************************************************/
+    void remove(uint32_t index);
+
+
+    /********************************************************************
+    ** Function: move: Records that an animal moved within its exhibit.
+    ** Params:   uint32_t index: slot of the animal, ignored if it is
+     *              NO_HANDLE's.
+     *           int64_t position: its new index in the exhibit.
+    ** Returns:  None
+    *********************************************************************/
+    void move(uint32_t index, int64_t position);
+
+
+    /********************************************************************
+    ** Function: getHandle: Returns the handle to the animal in a slot.
+    ** Params:   uint32_t index: slot of the animal.
+    ** Returns:  Handle: handle to it, NO_HANDLE if index is NO_HANDLE's.
+    *********************************************************************/
+    Handle getHandle(uint32_t index) const;
+
+
+    /********************************************************************
+    ** Function: find: Looks up where the animal of a handle is.
+    ** Params:   Handle handle: handle from insert.
+     *           int &exhibit: set to the animal's exhibit.
+     *           int64_t &position: set to the animal's index in it.
+    ** Returns:  bool: false if the animal has been removed.
+    *********************************************************************/
+    bool find(Handle handle, int &exhibit, int64_t &position) const;
+
+
+    /********************************************************************
+    ** Function: getBytes: Returns bytes of memory held by the slots.
+    ** Params:   None
+    ** Returns:  size_t: bytes of slot storage, counting spare capacity.
+    *********************************************************************/
+    size_t getBytes() const;
+};
+
+#endif
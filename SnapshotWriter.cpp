@@ -0,0 +1,423 @@
+/*********************************************************************
+** Program name: SnapshotWriter.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 12:15 PM
+** Description: Class implementation file for SnapshotWriter class.
+ *              SnapshotWriter formats a Zoo snapshot into a buffer
+ *              of fixed size, allocated when it is made, and writes
+ *              the buffer to a file descriptor with write(2) each
+ *              time it fills. It formats numbers itself, so writing
+ *              never allocates and never takes a lock. That lets a
+ *              forked child write the snapshot from its copy of the
+ *              zoo, while other threads of the parent may have held
+ *              malloc's lock when it forked.
+*********************************************************************/
+
+
+#include "SnapshotWriter.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <unistd.h>
+
+//Initialize constants
+const size_t SnapshotWriter::BUFFER_SIZE_DEFAULT = 64 * 1024;
+
+//Digits of the largest uint64_t
+static const int MAX_DIGITS = 20;
+//Significant digits a double is written with, enough to round trip
+static const int DOUBLE_DIGITS = 17;
+//Whole doubles below this are written as integers, like %.17g does
+static const double WHOLE_LIMIT = 1e17;
+//Longest double written, such as -1.2345678901234567e-308
+static const size_t MAX_DOUBLE_SIZE = 32;
+
+/********************************************************************
+** Function: toDigits: Finds the first 17 significant digits of a
+ *           double exactly, rounded half to even like printf rounds
+ *           them. The double is a 53 bit integer times a power of
+ *           two, so it is worked out as a big integer in base 10^9
+ *           on the stack, times a power of ten.
+** Params:   double magnitude: positive, finite number.
+ *           char *digits: set to the digits, room for 17.
+ *           int &exponent: set to the power of ten of the first digit.
+** Returns:  int: number of digits, without trailing zeros.
+*********************************************************************/
+static int toDigits(double magnitude, char *digits, int &exponent)
+{
+    const uint32_t LIMB_BASE = 1000000000;
+    const int LIMB_DIGITS = 9;
+    //a 53 bit integer times 5^1126, for the smallest doubles, fits in 90
+    const int MAX_LIMBS = 90;
+    //largest powers of 2 and 5 a limb can be multiplied by at once
+    const int MAX_TWOS = 29;
+    const int MAX_FIVES = 13;
+    const int MANTISSA_BITS = 53;
+
+    //magnitude = mantissa * 2^binary_exponent, exactly
+    int binary_exponent;
+    double fraction = std::frexp(magnitude, &binary_exponent);
+    uint64_t mantissa = static_cast<uint64_t>(
+            std::ldexp(fraction, MANTISSA_BITS));
+    binary_exponent -= MANTISSA_BITS;
+
+    uint32_t limbs[MAX_LIMBS];
+    int num_limbs = 0;
+    do
+    {
+        limbs[num_limbs++] = static_cast<uint32_t>(mantissa % LIMB_BASE);
+        mantissa /= LIMB_BASE;
+    } while (mantissa > 0);
+
+    //2^-k is 5^k / 10^k, so a negative power of two becomes fives
+    int decimal_shift = binary_exponent < 0 ? -binary_exponent : 0;
+    int remaining = binary_exponent < 0 ? -binary_exponent : binary_exponent;
+    while (remaining > 0)
+    {
+        int step = std::min(remaining, binary_exponent < 0 ? MAX_FIVES
+                                                           : MAX_TWOS);
+        uint64_t factor = 1;
+        for (int i=0; i<step; i++)
+        {
+            factor *= binary_exponent < 0 ? 5 : 2;
+        }
+        remaining -= step;
+
+        uint64_t carry = 0;
+        for (int i=0; i<num_limbs; i++)
+        {
+            uint64_t product = limbs[i] * factor + carry;
+            limbs[i] = static_cast<uint32_t>(product % LIMB_BASE);
+            carry = product / LIMB_BASE;
+        }
+        while (carry > 0)
+        {
+            limbs[num_limbs++] = static_cast<uint32_t>(carry % LIMB_BASE);
+            carry /= LIMB_BASE;
+        }
+    }
+
+    //every decimal digit, most significant first
+    char all_digits[MAX_LIMBS * LIMB_DIGITS];
+    int num_digits = 0;
+    for (int i=num_limbs-1; i>=0; i--)
+    {
+        char limb_digits[LIMB_DIGITS];
+        uint32_t limb = limbs[i];
+        for (int d=LIMB_DIGITS-1; d>=0; d--)
+        {
+            limb_digits[d] = static_cast<char>('0' + limb % 10);
+            limb /= 10;
+        }
+        for (int d=0; d<LIMB_DIGITS; d++)
+        {
+            if (num_digits > 0 || limb_digits[d] != '0')
+            {
+                all_digits[num_digits++] = limb_digits[d];
+            }
+        }
+    }
+    exponent = num_digits - 1 - decimal_shift;
+
+    //round to 17 digits, half to even
+    int kept = std::min(num_digits, DOUBLE_DIGITS);
+    bool round_up = false;
+    if (num_digits > DOUBLE_DIGITS)
+    {
+        char next = all_digits[DOUBLE_DIGITS];
+        bool rest_zero = true;
+        for (int i=DOUBLE_DIGITS+1; i<num_digits && rest_zero; i++)
+        {
+            rest_zero = all_digits[i] == '0';
+        }
+        round_up = next > '5'
+                    || (next == '5' && (!rest_zero
+                        || (all_digits[DOUBLE_DIGITS-1] - '0') % 2 == 1));
+    }
+    for (int i=kept-1; round_up && i>=0; i--)
+    {
+        round_up = all_digits[i] == '9';
+        all_digits[i] = round_up ? '0' : static_cast<char>(all_digits[i] + 1);
+    }
+    if (round_up)
+    {
+        //all nines became zeros, so it is the next power of ten
+        all_digits[0] = '1';
+        exponent++;
+    }
+
+    while (kept > 1 && all_digits[kept-1] == '0')
+    {
+        kept--;
+    }
+    std::memcpy(digits, all_digits, kept);
+    return kept;
+}
+
+
+/********************************************************************
+** Function: Constructor: Allocates the buffer. Nothing can be
+ *           written until start is called.
+** Params:   size_t buffer_size: bytes buffered between writes.
+** Returns:  None
+*********************************************************************/
+SnapshotWriter::SnapshotWriter(size_t buffer_size)
+    : buffer(std::max(buffer_size, MAX_DOUBLE_SIZE)), used(0), fd(-1),
+        bytes(0), failed(false)
+{}
+
+
+/********************************************************************
+** Function: start: Starts writing a new snapshot to fd, which the
+ *           caller opened and closes.
+** Params:   int fd: file descriptor to write to.
+** Returns:  None
+*********************************************************************/
+void SnapshotWriter::start(int fd)
+{
+    this->fd = fd;
+    used = 0;
+    bytes = 0;
+    failed = fd < 0;
+}
+
+
+/********************************************************************
+** Function: finish: Writes what is left in the buffer.
+** Params:   None
+** Returns:  long long: bytes written since start, or -1 if any
+ *              write failed.
+*********************************************************************/
+long long SnapshotWriter::finish()
+{
+    flush();
+    return failed ? -1 : bytes;
+}
+
+
+/********************************************************************
+** Function: operator<<: Formats text or a number into the buffer.
+ *           Integers and amounts of money are written like an
+ *           ostream writes them. Doubles are written to 17
+ *           significant digits, whole ones as integers.
+** Params:   The value to write.
+** Returns:  SnapshotWriter &: this writer.
+*********************************************************************/
+SnapshotWriter &SnapshotWriter::operator<<(char character)
+{
+    append(&character, 1);
+    return *this;
+}
+
+SnapshotWriter &SnapshotWriter::operator<<(const char *text)
+{
+    append(text, std::strlen(text));
+    return *this;
+}
+
+SnapshotWriter &SnapshotWriter::operator<<(const std::string &text)
+{
+    append(text.data(), text.size());
+    return *this;
+}
+
+SnapshotWriter &SnapshotWriter::operator<<(int number)
+{
+    return *this << static_cast<int64_t>(number);
+}
+
+SnapshotWriter &SnapshotWriter::operator<<(int64_t number)
+{
+    //negate as unsigned so the most negative number still prints
+    appendDigits(number < 0 ? 0 - static_cast<uint64_t>(number)
+                            : static_cast<uint64_t>(number),
+                    number < 0);
+    return *this;
+}
+
+SnapshotWriter &SnapshotWriter::operator<<(double number)
+{
+    const int LAST_FIXED_EXPONENT = DOUBLE_DIGITS - 1;
+    const int FIRST_FIXED_EXPONENT = -4;
+
+    if (std::isnan(number))
+    {
+        return *this << "nan";
+    }
+    bool negative = std::signbit(number);
+    double magnitude = std::fabs(number);
+    if (std::isinf(magnitude))
+    {
+        return *this << (negative ? "-inf" : "inf");
+    }
+
+    //whole numbers, such as every trait of a new animal, are exact
+    if (magnitude < WHOLE_LIMIT && magnitude == std::floor(magnitude))
+    {
+        appendDigits(static_cast<uint64_t>(magnitude), negative);
+        return *this;
+    }
+
+    char digits[DOUBLE_DIGITS];
+    int exponent;
+    int num_digits = toDigits(magnitude, digits, exponent);
+
+    makeRoom(MAX_DOUBLE_SIZE);
+    char *text = &buffer[used];
+    size_t size = 0;
+    if (negative)
+    {
+        text[size++] = '-';
+    }
+
+    if (exponent >= FIRST_FIXED_EXPONENT && exponent <= LAST_FIXED_EXPONENT)
+    {
+        //fixed notation, such as 0.001 or 12.5
+        if (exponent < 0)
+        {
+            text[size++] = '0';
+            text[size++] = '.';
+            for (int i=exponent+1; i<0; i++)
+            {
+                text[size++] = '0';
+            }
+        }
+        for (int i=0; i<num_digits; i++)
+        {
+            text[size++] = digits[i];
+            if (i == exponent && i < num_digits - 1)
+            {
+                text[size++] = '.';
+            }
+        }
+        for (int i=num_digits; i<=exponent; i++)
+        {
+            text[size++] = '0';
+        }
+    }
+    else
+    {
+        //scientific notation, such as 1.5e-07
+        text[size++] = digits[0];
+        if (num_digits > 1)
+        {
+            text[size++] = '.';
+        }
+        for (int i=1; i<num_digits; i++)
+        {
+            text[size++] = digits[i];
+        }
+        text[size++] = 'e';
+        text[size++] = exponent < 0 ? '-' : '+';
+        int power = exponent < 0 ? -exponent : exponent;
+        if (power >= 100)
+        {
+            text[size++] = static_cast<char>('0' + power / 100);
+        }
+        text[size++] = static_cast<char>('0' + power / 10 % 10);
+        text[size++] = static_cast<char>('0' + power % 10);
+    }
+
+    used += size;
+    bytes += static_cast<long long>(size);
+    return *this;
+}
+
+SnapshotWriter &SnapshotWriter::operator<<(const Money &amount)
+{
+    makeRoom(Money::MAX_TEXT_SIZE);
+    size_t size = static_cast<size_t>(amount.toText(&buffer[used]));
+    used += size;
+    bytes += static_cast<long long>(size);
+    return *this;
+}
+
+
+/********************************************************************
+** Function: append: Copies bytes into the buffer, writing it out
+ *           whenever it fills.
+** Params:   const char *data: bytes to copy.
+ *           size_t size: number of bytes.
+** Returns:  None
+*********************************************************************/
+void SnapshotWriter::append(const char *data, size_t size)
+{
+    bytes += static_cast<long long>(size);
+
+    while (size > 0)
+    {
+        if (used == buffer.size())
+        {
+            flush();
+        }
+        size_t part = std::min(size, buffer.size() - used);
+        std::memcpy(&buffer[used], data, part);
+        used += part;
+        data += part;
+        size -= part;
+    }
+}
+
+
+/********************************************************************
+** Function: makeRoom: Writes the buffer out unless it has room for
+ *           size more bytes.
+** Params:   size_t size: bytes about to be formatted in place.
+** Returns:  None
+*********************************************************************/
+void SnapshotWriter::makeRoom(size_t size)
+{
+    if (buffer.size() - used < size)
+    {
+        flush();
+    }
+}
+
+
+/********************************************************************
+** Function: flush: Writes the buffer to fd, retrying short and
+ *           interrupted writes, and empties it.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void SnapshotWriter::flush()
+{
+    size_t done = 0;
+    while (!failed && done < used)
+    {
+        ssize_t written = write(fd, &buffer[done], used - done);
+        if (written < 0 && errno != EINTR)
+        {
+            failed = true;
+        }
+        done += written > 0 ? static_cast<size_t>(written) : 0;
+    }
+    used = 0;
+}
+
+
+/********************************************************************
+** Function: appendDigits: Writes an integer in base 10, with a
+ *           minus sign if negative is true.
+** Params:   uint64_t magnitude: value without its sign.
+ *           bool negative: true to write a minus sign first.
+** Returns:  None
+*********************************************************************/
+void SnapshotWriter::appendDigits(uint64_t magnitude, bool negative)
+{
+    //digits come out last first, so fill from the end
+    char digits[MAX_DIGITS + 1];
+    int start = MAX_DIGITS + 1;
+    do
+    {
+        digits[--start] = static_cast<char>('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude > 0);
+
+    if (negative)
+    {
+        digits[--start] = '-';
+    }
+    append(digits + start, static_cast<size_t>(MAX_DIGITS + 1 - start));
+}
@@ -0,0 +1,123 @@
+/*********************************************************************
+** Program name: SnapshotWriter.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 12:15 PM
+** Description: Class specification file for SnapshotWriter class.
+ *              SnapshotWriter formats a Zoo snapshot into a buffer
+ *              of fixed size, allocated when it is made, and writes
+ *              the buffer to a file descriptor with write(2) each
+ *              time it fills. It formats numbers itself, so writing
+ *              never allocates and never takes a lock. That lets a
+ *              forked child write the snapshot from its copy of the
+ *              zoo, while other threads of the parent may have held
+ *              malloc's lock when it forked.
+*********************************************************************/
+
+
+#ifndef SNAPSHOT_WRITER_HPP
+#define SNAPSHOT_WRITER_HPP
+
+#include "Money.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class SnapshotWriter
+{
+public:
+    //Default bytes buffered between writes
+    static const size_t BUFFER_SIZE_DEFAULT;
+
+private:
+    std::vector<char> buffer;   //allocated once, never resized
+    size_t used;                //bytes waiting to be written
+    int fd;                     //file descriptor written to, -1 if none
+    long long bytes;            //bytes written since start
+    bool failed;                //true once a write failed
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor: Allocates the buffer. Nothing can be
+     *           written until start is called.
+    ** Params:   size_t buffer_size: bytes buffered between writes.
+    ** Returns:  None
+    *********************************************************************/
+    SnapshotWriter(size_t buffer_size = BUFFER_SIZE_DEFAULT);
+
+
+    /********************************************************************
+    ** Function: start: Starts writing a new snapshot to fd, which the
+     *           caller opened and closes.
+    ** Params:   int fd: file descriptor to write to.
+    ** Returns:  None
+    *********************************************************************/
+    void start(int fd);
+
+
+    /********************************************************************
+    ** Function: finish: Writes what is left in the buffer.
+    ** Params:   None
+    ** Returns:  long long: bytes written since start, or -1 if any
+     *              write failed.
+    *********************************************************************/
+    long long finish();
+
+
+    /********************************************************************
+    ** Function: operator<<: Formats text or a number into the buffer.
+     *           Integers and amounts of money are written like an
+     *           ostream writes them. Doubles are written to 17
+     *           significant digits, whole ones as integers.
+    ** Params:   The value to write.
+    ** Returns:  SnapshotWriter &: this writer.
+    *********************************************************************/
+    SnapshotWriter &operator<<(char character);
+    SnapshotWriter &operator<<(const char *text);
+    SnapshotWriter &operator<<(const std::string &text);
+    SnapshotWriter &operator<<(int number);
+    SnapshotWriter &operator<<(int64_t number);
+    SnapshotWriter &operator<<(double number);
+    SnapshotWriter &operator<<(const Money &amount);
+
+private:
+
+    /********************************************************************
+    ** Function: append: Copies bytes into the buffer, writing it out
+     *           whenever it fills.
+    ** Params:   const char *data: bytes to copy.
+     *           size_t size: number of bytes.
+    ** Returns:  None
+    *********************************************************************/
+    void append(const char *data, size_t size);
+
+
+    /********************************************************************
+    ** Function: makeRoom: Writes the buffer out unless it has room for
+     *           size more bytes.
+    ** Params:   size_t size: bytes about to be formatted in place.
+    ** Returns:  None
+    *********************************************************************/
+    void makeRoom(size_t size);
+
+
+    /********************************************************************
+    ** Function: flush: Writes the buffer to fd, retrying short and
+     *           interrupted writes, and empties it.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void flush();
+
+
+    /********************************************************************
+    ** Function: appendDigits: Writes an integer in base 10, with a
+     *           minus sign if negative is true.
+    ** Params:   uint64_t magnitude: value without its sign.
+     *           bool negative: true to write a minus sign first.
+    ** Returns:  None
+    *********************************************************************/
+    void appendDigits(uint64_t magnitude, bool negative);
+};
+
+#endif
@@ -0,0 +1,337 @@
+/*********************************************************************
+** Program name: SpeciesRegistry.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 18, 2026 at 11:40 PM
+** Description: Class implementation file for SpeciesRegistry class.
+ *              SpeciesRegistry is a helper class with static functions
+ *              that holds every species the zoo can keep. Species get
+ *              dense integer IDs, so their traits are found by
+ *              indexing a table. Tigers, penguins, turtles, and the
+ *              exhibit for new animals are always registered first,
+ *              with IDs matching AnimalType. More species can be
+ *              loaded from a file at startup, without recompiling.
+ *              Species must all be registered before any Zoo is made.
+ *              Each new animal's traits are interned here too, once
+ *              per distinct set of traits, so animals only carry an ID.
+*********************************************************************/
+
+
+#include "SpeciesRegistry.hpp"
+#include "MemoryUsage.hpp"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cctype>
+#include <cstdint>
+
+//Initialize static members
+std::vector<SpeciesRegistry::Species> SpeciesRegistry::table;
+int SpeciesRegistry::num_registered = 0;
+std::unordered_map<std::string, SpeciesId> SpeciesRegistry::ids;
+std::map<SpeciesRegistry::Traits, SpeciesId> SpeciesRegistry::interned;
+
+//Initialize constants
+const int SpeciesRegistry::MAX_IDS = UINT16_MAX + 1;
+
+/********************************************************************
+** Function: standardSpecies: Builds a standard species' entry from
+ *           its row of the defaults table.
+** Params:   AnimalType type: row of the defaults table.
+** Returns:  Species: the entry.
+*********************************************************************/
+static SpeciesRegistry::Species standardSpecies(AnimalType type)
+{
+    SpeciesRegistry::Species species;
+    species.name = DEFAULTS[type].default_name;
+    species.cost = DEFAULTS[type].default_cost;
+    species.num_babies = DEFAULTS[type].default_num_babies;
+    species.feeding_cost = DEFAULTS[type].default_food_cost_multiplier
+                            * AnimalConstants::BASE_FOOD_COST;
+    species.payoff = DEFAULTS[type].default_cost
+                        * DEFAULTS[type].default_payoff_percentage;
+    species.custom = false;
+    species.exhibit = type;
+    return species;
+}
+
+
+/********************************************************************
+** Function: load: Registers the species in file after the standard
+ *           ones, replacing any loaded before. Each line of the file
+ *           is a name, cost, number of babies, food cost multiplier,
+ *           and payoff percentage, like the defaults table. Blank
+ *           lines and lines starting with # are skipped.
+** Params:   const string &file: species file to read.
+** Returns:  bool: true if every line was a new, valid species.
+ *           Only the standard species are left on failure.
+*********************************************************************/
+bool SpeciesRegistry::load(const std::string &file)
+{
+    const char COMMENT = '#';
+
+    reset();
+
+    std::ifstream fileIn(file);
+    if (!fileIn)
+    {
+        std::cerr << "Could not open species file " << file << std::endl;
+        return false;
+    }
+
+    std::string line;
+    int line_number = ZERO;
+    while (getline(fileIn, line))
+    {
+        line_number++;
+
+        std::istringstream fields(line);
+        std::string name;
+        if (!(fields >> name) || name[ZERO] == COMMENT)
+        {
+            continue;
+        }
+
+        int cost;
+        int num_babies;
+        double food_cost_multiplier;
+        double payoff_percentage;
+        std::string extra;
+        fields >> cost >> num_babies >> food_cost_multiplier
+                >> payoff_percentage;
+
+        Species species;
+        species.name = name;
+        species.cost = cost;
+        species.num_babies = num_babies;
+        species.feeding_cost = food_cost_multiplier
+                                * AnimalConstants::BASE_FOOD_COST;
+        species.payoff = cost * payoff_percentage;
+        species.custom = false;
+        species.exhibit = num_registered;
+
+        if (fields.fail() || fields >> extra || cost < ZERO
+                || num_babies < ZERO || food_cost_multiplier < ZERO
+                || payoff_percentage < ZERO || add(species) < ZERO)
+        {
+            std::cerr << "Species file " << file << " line " << line_number
+                    << " is not a new species" << std::endl;
+            reset();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/********************************************************************
+** Function: size: Returns the number of species registered, not
+ *           counting interned traits.
+** Params:   None
+** Returns:  int: number of species, and of exhibits in a zoo.
+*********************************************************************/
+int SpeciesRegistry::size()
+{
+    if (table.empty())
+    {
+        reset();
+    }
+    return num_registered;
+}
+
+
+/********************************************************************
+** Function: get: Returns the traits of a species.
+** Params:   SpeciesId id: ID from 0 to size()-1, or from intern.
+** Returns:  const Species &: the species' traits.
+*********************************************************************/
+const SpeciesRegistry::Species &SpeciesRegistry::get(SpeciesId id)
+{
+    if (table.empty())
+    {
+        reset();
+    }
+    return table[id];
+}
+
+
+/********************************************************************
+** Function: find: Looks up a species by name, ignoring case.
+** Params:   const string &name: name of the species.
+** Returns:  SpeciesId: its ID, or -1 if there is no such species.
+*********************************************************************/
+SpeciesId SpeciesRegistry::find(const std::string &name)
+{
+    if (table.empty())
+    {
+        reset();
+    }
+
+    std::unordered_map<std::string, SpeciesId>::const_iterator found =
+            ids.find(toLower(name));
+    return found == ids.end() ? -1 : found->second;
+}
+
+
+/********************************************************************
+** Function: getNameBytes: Returns the heap bytes held by the names
+ *           of the species and interned traits living in an
+ *           exhibit, with their copies in the lookup maps.
+** Params:   SpeciesId exhibit: exhibit from 0 to size()-1.
+** Returns:  size_t: heap bytes of name strings.
+*********************************************************************/
+size_t SpeciesRegistry::getNameBytes(SpeciesId exhibit)
+{
+    if (table.empty())
+    {
+        reset();
+    }
+
+    size_t bytes = ZERO;
+    for (size_t i=ZERO; i<table.size(); i++)
+    {
+        if (table[i].exhibit == exhibit)
+        {
+            bytes += MemoryUsage::getHeapBytes(table[i].name);
+        }
+    }
+
+    std::unordered_map<std::string, SpeciesId>::const_iterator id;
+    for (id=ids.begin(); id!=ids.end(); ++id)
+    {
+        if (table[id->second].exhibit == exhibit)
+        {
+            bytes += MemoryUsage::getHeapBytes(id->first);
+        }
+    }
+
+    std::map<Traits, SpeciesId>::const_iterator traits;
+    for (traits=interned.begin(); traits!=interned.end(); ++traits)
+    {
+        if (table[traits->second].exhibit == exhibit)
+        {
+            bytes += MemoryUsage::getHeapBytes(std::get<0>(traits->first));
+        }
+    }
+
+    return bytes;
+}
+
+
+/********************************************************************
+** Function: reset: Clears the registry down to the standard
+ *           species: tigers, penguins, turtles, and new animals.
+ *           Interned traits are cleared too.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void SpeciesRegistry::reset()
+{
+    table.clear();
+    num_registered = ZERO;
+    ids.clear();
+    interned.clear();
+
+    //order must match AnimalType
+    add(standardSpecies(TIGER));
+    add(standardSpecies(PENGUIN));
+    add(standardSpecies(TURTLE));
+
+    //user-made animals share one exhibit, their traits are interned
+    Species custom;
+    custom.name = "New animals";
+    custom.cost = DEFAULTS[CUSTOM].default_cost;
+    custom.num_babies = DEFAULTS[CUSTOM].default_num_babies;
+    custom.feeding_cost = DEFAULTS[CUSTOM].default_food_cost_multiplier;
+    custom.payoff = DEFAULTS[CUSTOM].default_payoff_percentage;
+    custom.custom = true;
+    custom.exhibit = CUSTOM;
+    add(custom);
+}
+
+
+/********************************************************************
+** Function: intern: Returns the ID of a new animal's traits,
+ *           adding them the first time they are seen. Interned
+ *           traits live in the new animals exhibit and are kept
+ *           until the registry is reset.
+** Params:   const string &name: name of animal.
+ *           int cost: cost of animal.
+ *           int num_babies: number of babies the animal produces.
+ *           double feeding_cost: cost to feed animal.
+ *           double payoff: profit generated by animal.
+** Returns:  SpeciesId: ID shared by every animal with these traits,
+ *              or -1 if they are new and the registry is full.
+*********************************************************************/
+SpeciesId SpeciesRegistry::intern(const std::string &name, int cost,
+                                    int num_babies, double feeding_cost,
+                                    double payoff)
+{
+    if (table.empty())
+    {
+        reset();
+    }
+
+    Traits traits(name, cost, num_babies, feeding_cost, payoff);
+    std::map<Traits, SpeciesId>::const_iterator found = interned.find(traits);
+    if (found != interned.end())
+    {
+        return found->second;
+    }
+    if (table.size() >= static_cast<size_t>(MAX_IDS))
+    {
+        return -1;
+    }
+
+    Species species;
+    species.name = name;
+    species.cost = cost;
+    species.num_babies = num_babies;
+    species.feeding_cost = feeding_cost;
+    species.payoff = payoff;
+    species.custom = true;
+    species.exhibit = CUSTOM;
+
+    SpeciesId id = static_cast<SpeciesId>(table.size());
+    table.push_back(species);
+    interned[traits] = id;
+    return id;
+}
+
+
+/********************************************************************
+** Function: add: Registers a species under the next ID.
+** Params:   const Species &species: traits of the species.
+** Returns:  SpeciesId: its ID, or -1 if the name is taken or the
+ *              registry is full.
+*********************************************************************/
+SpeciesId SpeciesRegistry::add(const Species &species)
+{
+    SpeciesId id = static_cast<SpeciesId>(table.size());
+
+    if (id >= MAX_IDS || !ids.insert(std::make_pair(toLower(species.name), id)).second)
+    {
+        return -1;
+    }
+
+    table.push_back(species);
+    num_registered++;
+    return id;
+}
+
+
+/********************************************************************
+** Function: toLower: Returns name in lowercase, used as map key.
+** Params:   const string &name: name to convert.
+** Returns:  string: lowercase name.
+*********************************************************************/
+std::string SpeciesRegistry::toLower(const std::string &name)
+{
+    std::string lower = name;
+    for (size_t i=ZERO; i<lower.size(); i++)
+    {
+        lower[i] = static_cast<char>
+                (std::tolower(static_cast<unsigned char>(lower[i])));
+    }
+    return lower;
+}
@@ -0,0 +1,161 @@
+/*********************************************************************
+** Program name: SpeciesRegistry.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 18, 2026 at 11:40 PM
+** Description: Class specification file for SpeciesRegistry class.
+ *              SpeciesRegistry is a helper class with static functions
+ *              that holds every species the zoo can keep. Species get
+ *              dense integer IDs, so their traits are found by
+ *              indexing a table. Tigers, penguins, turtles, and the
+ *              exhibit for new animals are always registered first,
+ *              with IDs matching AnimalType. More species can be
+ *              loaded from a file at startup, without recompiling.
+ *              Species must all be registered before any Zoo is made.
+ *              Each new animal's traits are interned here too, once
+ *              per distinct set of traits, so animals only carry an ID.
+*********************************************************************/
+
+
+#ifndef SPECIES_REGISTRY_HPP
+#define SPECIES_REGISTRY_HPP
+
+#include "AnimalConstants.hpp"
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <map>
+#include <tuple>
+
+class SpeciesRegistry
+{
+public:
+    //Species and interned traits the registry can hold, so every ID
+    // fits the 16 bits an AnimalRecord keeps it in
+    static const int MAX_IDS;
+
+    //Traits shared by every animal of a species
+    struct Species
+    {
+        std::string name;
+        int cost;
+        int num_babies;
+        double feeding_cost;    //base food cost times food multiplier
+        double payoff;          //cost times payoff percentage
+        bool custom;            //made by the user, not registered
+        SpeciesId exhibit;      //exhibit the animals live in
+    };
+
+private:
+    //Fills the registry and resets it after
+    friend class UnitTest;
+
+    //Name, cost, number of babies, feeding cost, and payoff
+    typedef std::tuple<std::string, int, int, double, double> Traits;
+
+    //Registered species first, then interned traits
+    static std::vector<Species> table;
+    static int num_registered;
+
+    //Lowercase name to ID
+    static std::unordered_map<std::string, SpeciesId> ids;
+
+    //Traits of new animals to ID
+    static std::map<Traits, SpeciesId> interned;
+
+public:
+
+    /********************************************************************
+    ** Function: load: Registers the species in file after the standard
+     *           ones, replacing any loaded before. Each line of the file
+     *           is a name, cost, number of babies, food cost multiplier,
+     *           and payoff percentage, like the defaults table. Blank
+     *           lines and lines starting with # are skipped.
+    ** Params:   const string &file: species file to read.
+    ** Returns:  bool: true if every line was a new, valid species.
+     *           Only the standard species are left on failure.
+    *********************************************************************/
+    static bool load(const std::string &file);
+
+
+    /********************************************************************
+    ** Function: size: Returns the number of species registered, not
+     *           counting interned traits.
+    ** Params:   None
+    ** Returns:  int: number of species, and of exhibits in a zoo.
+    *********************************************************************/
+    static int size();
+
+
+    /********************************************************************
+    ** Function: get: Returns the traits of a species.
+    ** Params:   SpeciesId id: ID from 0 to size()-1, or from intern.
+    ** Returns:  const Species &: the species' traits.
+    *********************************************************************/
+    static const Species &get(SpeciesId id);
+
+
+    /********************************************************************
+    ** Function: find: Looks up a species by name, ignoring case.
+    ** Params:   const string &name: name of the species.
+    ** Returns:  SpeciesId: its ID, or -1 if there is no such species.
+    *********************************************************************/
+    static SpeciesId find(const std::string &name);
+
+
+    /********************************************************************
+    ** Function: intern: Returns the ID of a new animal's traits,
+     *           adding them the first time they are seen. Interned
+     *           traits live in the new animals exhibit and are kept
+     *           until the registry is reset.
+    ** Params:   const string &name: name of animal.
+     *           int cost: cost of animal.
+     *           int num_babies: number of babies the animal produces.
+     *           double feeding_cost: cost to feed animal.
+     *           double payoff: profit generated by animal.
+    ** Returns:  SpeciesId: ID shared by every animal with these traits,
+     *              or -1 if they are new and the registry is full.
+    *********************************************************************/
+    static SpeciesId intern(const std::string &name, int cost,
+                            int num_babies, double feeding_cost,
+                            double payoff);
+
+
+    /********************************************************************
+    ** Function: getNameBytes: Returns the heap bytes held by the names
+     *           of the species and interned traits living in an
+     *           exhibit, with their copies in the lookup maps.
+    ** Params:   SpeciesId exhibit: exhibit from 0 to size()-1.
+    ** Returns:  size_t: heap bytes of name strings.
+    *********************************************************************/
+    static size_t getNameBytes(SpeciesId exhibit);
+
+private:
+
+    /********************************************************************
+    ** Function: reset: Clears the registry down to the standard
+     *           species: tigers, penguins, turtles, and new animals.
+     *           Interned traits are cleared too.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    static void reset();
+
+
+    /********************************************************************
+    ** Function: add: Registers a species under the next ID.
+    ** Params:   const Species &species: traits of the species.
+    ** Returns:  SpeciesId: its ID, or -1 if the name is taken or the
+     *              registry is full.
+    *********************************************************************/
+    static SpeciesId add(const Species &species);
+
+
+    /********************************************************************
+    ** Function: toLower: Returns name in lowercase, used as map key.
+    ** Params:   const string &name: name to convert.
+    ** Returns:  string: lowercase name.
+    *********************************************************************/
+    static std::string toLower(const std::string &name);
+};
+
+#endif
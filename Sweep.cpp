@@ -0,0 +1,370 @@
+/*********************************************************************
+** Program name: Sweep.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 18, 2026 at 9:00 PM
+** Description: Class implementation file for Sweep class. A Sweep
+ *              runs many headless Zoo simulations with the same
+ *              policy and horizon over a range of seeds, and
+ *              aggregates their outcomes. Progress is checkpointed
+ *              to a file every so often, so a sweep that gets
+ *              interrupted can resume where it left off instead of
+ *              starting over.
+*********************************************************************/
+
+
+#include "Sweep.hpp"
+#include "CheckedMath.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+
+using std::cout;
+using std::endl;
+using std::string;
+
+//Initialize constants
+const int Sweep::CHECKPOINT_SECONDS_DEFAULT = 60;
+const string Sweep::CHECKPOINT_HEADER = "zoo-sweep-checkpoint 4";
+
+//Set by SIGINT/SIGTERM so the sweep can checkpoint before exiting
+static volatile std::sig_atomic_t interrupted = 0;
+
+/********************************************************************
+** Function: onInterrupt: Signal handler that asks the running sweep
+ *           to save a checkpoint and stop.
+** Params:   int signal_number: signal received (unused).
+** Returns:  None
+*********************************************************************/
+static void onInterrupt(int)
+{
+    interrupted = 1;
+}
+
+
+/********************************************************************
+** Function: Constructor: Sets up a sweep over seeds
+ *           [first_seed, first_seed + num_seeds).
+** Params:   const Zoo::Policy &policy: policy for every run.
+ *           int horizon: maximum days per run.
+ *           unsigned int first_seed: seed of the first run.
+ *           unsigned int num_seeds: number of runs.
+ *           const string &checkpoint_file: file to save progress
+ *              to. Empty string disables checkpoints.
+ *           int checkpoint_seconds: seconds between checkpoints.
+** Returns:  None
+*********************************************************************/
+Sweep::Sweep(const Zoo::Policy &policy, int horizon, unsigned int first_seed,
+        unsigned int num_seeds, const string &checkpoint_file,
+        int checkpoint_seconds)
+    : policy(policy), horizon(horizon), first_seed(first_seed),
+    num_seeds(num_seeds), checkpoint_file(checkpoint_file),
+    checkpoint_seconds(checkpoint_seconds), cache(nullptr),
+    next_seed(first_seed)
+{
+    totals.runs = 0;
+    totals.bankruptcies = 0;
+    totals.total_days = 0;
+    totals.total_population = 0;
+    totals.sum_bank = 0;
+    totals.sum_bank_squared_high = 0;
+    totals.sum_bank_squared_low = 0;
+    totals.overflows = 0;
+}
+
+
+/********************************************************************
+** Function: setCache: Looks up every run in cache before
+ *           simulating it, and stores new outcomes in it.
+** Params:   ResultCache *cache: cache to use, or nullptr for none.
+** Returns:  None
+*********************************************************************/
+void Sweep::setCache(ResultCache *cache)
+{
+    this->cache = cache;
+}
+
+
+/********************************************************************
+** Function: run: Runs the sweep. If the checkpoint file already
+ *           holds progress for this same sweep, the finished seeds
+ *           are skipped. Saves a checkpoint every
+ *           checkpoint_seconds, when interrupted by SIGINT or
+ *           SIGTERM, and when the sweep finishes.
+** Params:   None
+** Returns:  bool: true if every seed was run, false if the sweep
+ *              was interrupted or the checkpoint did not match.
+*********************************************************************/
+bool Sweep::run()
+{
+    typedef std::chrono::steady_clock Clock;
+
+    if (!loadCheckpoint())
+    {
+        return false;
+    }
+
+    if (next_seed != first_seed)
+    {
+        cout << "Resuming sweep at seed " << next_seed << " ("
+                << totals.runs << " runs already done)" << endl;
+    }
+
+    //runs done before the checkpoint do not count towards the rate
+    ProgressReporter::setTotalRuns(first_seed + num_seeds - next_seed);
+
+    interrupted = 0;
+    std::signal(SIGINT, onInterrupt);
+    std::signal(SIGTERM, onInterrupt);
+
+    const unsigned int end_seed = first_seed + num_seeds;
+    Clock::time_point last_checkpoint = Clock::now();
+
+    while (next_seed != end_seed && !interrupted)
+    {
+        Zoo::Outcome outcome;
+
+        //only simulate runs that are not cached
+        if (!cache || !cache->find(policy, next_seed, horizon, outcome))
+        {
+            Zoo zoo(policy, next_seed);
+            outcome = zoo.simulate(horizon);
+
+            if (cache)
+            {
+                cache->store(policy, next_seed, horizon, outcome);
+            }
+        }
+
+        addOutcome(outcome);
+        next_seed++;
+        ProgressReporter::runFinished();
+
+        //checkpoint every so often
+        if (!checkpoint_file.empty() && Clock::now() - last_checkpoint
+                >= std::chrono::seconds(checkpoint_seconds))
+        {
+            saveCheckpoint();
+            last_checkpoint = Clock::now();
+        }
+    }
+
+    std::signal(SIGINT, SIG_DFL);
+    std::signal(SIGTERM, SIG_DFL);
+
+    if (!checkpoint_file.empty())
+    {
+        saveCheckpoint();
+    }
+
+    if (interrupted)
+    {
+        cout << "Sweep interrupted at seed " << next_seed;
+        if (!checkpoint_file.empty())
+        {
+            cout << ", progress saved to " << checkpoint_file;
+        }
+        cout << endl;
+    }
+
+    return next_seed == end_seed;
+}
+
+
+/********************************************************************
+** Function: getTotals: Returns aggregated outcomes so far.
+** Params:   None
+** Returns:  const Aggregate &: running totals.
+*********************************************************************/
+const Sweep::Aggregate &Sweep::getTotals() const
+{
+    return totals;
+}
+
+
+/********************************************************************
+** Function: printSummary: Prints number of runs, bankruptcy rate,
+ *           and mean/standard deviation of the final bank account,
+ *           mean days opened, and mean population, then how many
+ *           runs or totals overflowed, if any did.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void Sweep::printSummary() const
+{
+    cout << "Runs: " << totals.runs << endl;
+    if (totals.runs == 0)
+    {
+        return;
+    }
+
+    //sums stay in whole cents, only the mean and spread are doubles
+    const int HALF_BITS = 64;
+    const double CENTS_PER_DOLLAR = 100.0;
+    double runs = static_cast<double>(totals.runs);
+    double mean_cents = static_cast<double>(totals.sum_bank) / runs;
+    double sum_squared = std::ldexp(
+            static_cast<double>(totals.sum_bank_squared_high), HALF_BITS)
+            + static_cast<double>(totals.sum_bank_squared_low);
+    double variance = sum_squared / runs - mean_cents * mean_cents;
+    double mean_bank = mean_cents / CENTS_PER_DOLLAR;
+    double std_dev_bank = std::sqrt(std::max(variance, 0.0))
+                            / CENTS_PER_DOLLAR;
+
+    cout << std::fixed << std::setprecision(2);
+    cout << "Bankrupt: " << 100.0 * totals.bankruptcies / runs << "%" << endl;
+    cout << "Mean days opened: " << totals.total_days / runs << endl;
+    cout << "Mean final bank account: $" << mean_bank
+            << " (std dev $" << std_dev_bank << ")"
+            << endl;
+    cout << "Mean final population: " << totals.total_population / runs
+            << endl;
+
+    //only shown when it happened, so normal summaries stay the same
+    if (totals.overflows > 0)
+    {
+        cout << "Overflows: " << totals.overflows
+                << " runs or totals clamped at 64-bit limits" << endl;
+    }
+}
+
+
+/********************************************************************
+** Function: addOutcome: Adds one run's outcome to the totals.
+** Params:   const Zoo::Outcome &outcome: outcome of the run.
+** Returns:  None
+*********************************************************************/
+void Sweep::addOutcome(const Zoo::Outcome &outcome)
+{
+    totals.runs++;
+    if (outcome.bankrupt)
+    {
+        totals.bankruptcies++;
+    }
+    totals.total_days += outcome.days;
+    if (outcome.overflowed)
+    {
+        totals.overflows++;
+    }
+    if (!CheckedMath::add(totals.total_population, outcome.population,
+                            totals.total_population))
+    {
+        totals.overflows++;
+    }
+    int64_t bank = outcome.bank_account.getCents();
+    if (!CheckedMath::add(totals.sum_bank, bank, totals.sum_bank))
+    {
+        totals.overflows++;
+    }
+    if (!CheckedMath::addSquare(bank, totals.sum_bank_squared_high,
+                                totals.sum_bank_squared_low))
+    {
+        totals.overflows++;
+    }
+}
+
+
+/********************************************************************
+** Function: configString: Formats the sweep's settings. Used to
+ *           make sure a checkpoint belongs to this sweep.
+** Params:   None
+** Returns:  string: policy, horizon, seed range, and game constants,
+ *              including the registered species, on one line.
+*********************************************************************/
+string Sweep::configString() const
+{
+    std::ostringstream config;
+    config << Zoo::describePolicy(policy) << " "
+            << horizon << " " << first_seed << " " << num_seeds << " "
+            << Zoo::describeConstants();
+    return config.str();
+}
+
+
+/********************************************************************
+** Function: loadCheckpoint: Restores progress from the checkpoint
+ *           file if there is one.
+** Params:   None
+** Returns:  bool: false if the checkpoint exists but belongs to a
+ *              different sweep or is unreadable, true otherwise.
+*********************************************************************/
+bool Sweep::loadCheckpoint()
+{
+    if (checkpoint_file.empty())
+    {
+        return true;
+    }
+
+    std::ifstream fileIn(checkpoint_file);
+    if (!fileIn)
+    {
+        return true;    //nothing saved yet, start from the beginning
+    }
+
+    string header;
+    string config;
+    getline(fileIn, header);
+    getline(fileIn, config);
+
+    if (header != CHECKPOINT_HEADER || config != configString())
+    {
+        std::cerr << "Checkpoint " << checkpoint_file
+                << " belongs to a different sweep" << endl;
+        return false;
+    }
+
+    Aggregate saved;
+    unsigned int saved_seed;
+    fileIn >> saved_seed >> saved.runs >> saved.bankruptcies
+            >> saved.total_days >> saved.total_population
+            >> saved.sum_bank >> saved.sum_bank_squared_high
+            >> saved.sum_bank_squared_low >> saved.overflows;
+
+    if (!fileIn || saved_seed - first_seed > num_seeds
+            || saved.runs != static_cast<long long>(saved_seed - first_seed))
+    {
+        std::cerr << "Checkpoint " << checkpoint_file << " is corrupt" << endl;
+        return false;
+    }
+
+    next_seed = saved_seed;
+    totals = saved;
+    return true;
+}
+
+
+/********************************************************************
+** Function: saveCheckpoint: Writes progress to a temporary file,
+ *           then renames it over the checkpoint file so a crash
+ *           mid-write never leaves a half written checkpoint.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void Sweep::saveCheckpoint() const
+{
+    Tracer::Scope span("saveCheckpoint");
+
+    const string temp_file = checkpoint_file + ".tmp";
+
+    std::ofstream fileOut(temp_file);
+    if (!fileOut)
+    {
+        std::cerr << "Could not write checkpoint " << temp_file << endl;
+        return;
+    }
+
+    fileOut << CHECKPOINT_HEADER << endl;
+    fileOut << configString() << endl;
+    fileOut << next_seed << " " << totals.runs << " " << totals.bankruptcies
+            << " " << totals.total_days << " " << totals.total_population
+            << " " << totals.sum_bank << " " << totals.sum_bank_squared_high
+            << " " << totals.sum_bank_squared_low
+            << " " << totals.overflows << endl;
+    fileOut.close();
+
+    if (!fileOut || std::rename(temp_file.c_str(), checkpoint_file.c_str()))
+    {
+        std::cerr << "Could not save checkpoint " << checkpoint_file << endl;
+    }
+}
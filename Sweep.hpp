@@ -0,0 +1,158 @@
+/*********************************************************************
+** Program name: Sweep.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 18, 2026 at 9:00 PM
+** Description: Class specification file for Sweep class. A Sweep
+ *              runs many headless Zoo simulations with the same
+ *              policy and horizon over a range of seeds, and
+ *              aggregates their outcomes. Progress is checkpointed
+ *              to a file every so often, so a sweep that gets
+ *              interrupted can resume where it left off instead of
+ *              starting over.
+*********************************************************************/
+
+
+#ifndef SWEEP_HPP
+#define SWEEP_HPP
+
+#include "Zoo.hpp"
+#include "ResultCache.hpp"
+#include <string>
+
+class Sweep
+{
+public:
+    //Running totals of all outcomes seen so far
+    struct Aggregate
+    {
+        long long runs;
+        long long bankruptcies;
+        long long total_days;
+        int64_t total_population;
+        int64_t sum_bank;       //final bank accounts, in cents
+        uint64_t sum_bank_squared_high;  //their squares, in cents
+        uint64_t sum_bank_squared_low;   // squared, as 128 bits
+        long long overflows;    //runs, or totals here, clamped at a limit
+    };
+
+    //Default seconds between checkpoints
+    static const int CHECKPOINT_SECONDS_DEFAULT;
+
+private:
+    //First line of every checkpoint file
+    static const std::string CHECKPOINT_HEADER;
+
+    Zoo::Policy policy;
+    int horizon;
+    unsigned int first_seed;
+    unsigned int num_seeds;
+    std::string checkpoint_file;
+    int checkpoint_seconds;
+
+    //Optional cache of outcomes, not owned by the sweep
+    ResultCache *cache;
+
+    //Seeds [first_seed, next_seed) are done and included in totals
+    unsigned int next_seed;
+    Aggregate totals;
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor: Sets up a sweep over seeds
+     *           [first_seed, first_seed + num_seeds).
+    ** Params:   const Zoo::Policy &policy: policy for every run.
+     *           int horizon: maximum days per run.
+     *           unsigned int first_seed: seed of the first run.
+     *           unsigned int num_seeds: number of runs.
+     *           const string &checkpoint_file: file to save progress
+     *              to. Empty string disables checkpoints.
+     *           int checkpoint_seconds: seconds between checkpoints.
+    ** Returns:  None
+    *********************************************************************/
+    Sweep(const Zoo::Policy &policy, int horizon, unsigned int first_seed,
+            unsigned int num_seeds, const std::string &checkpoint_file = "",
+            int checkpoint_seconds = CHECKPOINT_SECONDS_DEFAULT);
+
+
+    /********************************************************************
+    ** Function: setCache: Looks up every run in cache before
+     *           simulating it, and stores new outcomes in it.
+    ** Params:   ResultCache *cache: cache to use, or nullptr for none.
+    ** Returns:  None
+    *********************************************************************/
+    void setCache(ResultCache *cache);
+
+
+    /********************************************************************
+    ** Function: run: Runs the sweep. If the checkpoint file already
+     *           holds progress for this same sweep, the finished seeds
+     *           are skipped. Saves a checkpoint every
+     *           checkpoint_seconds, when interrupted by SIGINT or
+     *           SIGTERM, and when the sweep finishes.
+    ** Params:   None
+    ** Returns:  bool: true if every seed was run, false if the sweep
+     *              was interrupted or the checkpoint did not match.
+    *********************************************************************/
+    bool run();
+
+
+    /********************************************************************
+    ** Function: getTotals: Returns aggregated outcomes so far.
+    ** Params:   None
+    ** Returns:  const Aggregate &: running totals.
+    *********************************************************************/
+    const Aggregate &getTotals() const;
+
+
+    /********************************************************************
+    ** Function: printSummary: Prints number of runs, bankruptcy rate,
+     *           and mean/standard deviation of the final bank account,
+     *           mean days opened, and mean population, then how many
+     *           runs or totals overflowed, if any did.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void printSummary() const;
+
+private:
+
+    /********************************************************************
+    ** Function: addOutcome: Adds one run's outcome to the totals.
+    ** Params:   const Zoo::Outcome &outcome: outcome of the run.
+    ** Returns:  None
+    *********************************************************************/
+    void addOutcome(const Zoo::Outcome &outcome);
+
+
+    /********************************************************************
+    ** Function: configString: Formats the sweep's settings. Used to
+     *           make sure a checkpoint belongs to this sweep.
+    ** Params:   None
+    ** Returns:  string: policy, horizon, seed range, and game constants,
+     *              including the registered species, on one line.
+    *********************************************************************/
+    std::string configString() const;
+
+
+    /********************************************************************
+    ** Function: loadCheckpoint: Restores progress from the checkpoint
+     *           file if there is one.
+    ** Params:   None
+    ** Returns:  bool: false if the checkpoint exists but belongs to a
+     *              different sweep or is unreadable, true otherwise.
+    *********************************************************************/
+    bool loadCheckpoint();
+
+
+    /********************************************************************
+    ** Function: saveCheckpoint: Writes progress to a temporary file,
+     *           then renames it over the checkpoint file so a crash
+     *           mid-write never leaves a half written checkpoint.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void saveCheckpoint() const;
+};
+
+#endif
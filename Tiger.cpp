@@ -12,43 +12,33 @@
  *              time, cost 5 times as much as the base cost to feed,
  *              and generates 20% of their purchasing cost as payoff.
  *              They inherit all data members and functions of Animal,
- *              with the addition of a string for their name, "Tiger",
- *              and a function to get their name.
+ *              and read their name, "Tiger", and traits from the
+ *              species registry.
 *********************************************************************/
 
 
 #include "Tiger.hpp"
 
 /********************************************************************
-** Function: Constructor/default: Sets age of tiger to argument. Sets
- *           name, cost, number of babies with constant default
- *           values. Feeding cost and payoff are calculated with
- *           default multipliers and base costs.
+** Function: Constructor/default: Sets age of tiger to argument.
+ *           Name, cost, number of babies, feeding cost, and
+ *           payoff are shared by all tigers in the species registry.
 ** Params:   int age: age of tiger.
  *          default = 0;
 ** Returns: None
 *********************************************************************/
-Tiger::Tiger(int age)
-{
-    this->age = age;
-    name = DEFAULTS[TIGER].default_name;
-    cost = DEFAULTS[TIGER].default_cost;
-    num_babies = DEFAULTS[TIGER].default_num_babies;
-    feeding_cost = DEFAULTS[TIGER].default_food_cost_multiplier
-                    * getBaseFoodCost();
-    payoff = DEFAULTS[TIGER].default_cost
-            * DEFAULTS[TIGER].default_payoff_percentage;
-}
+Tiger::Tiger(int age) : Animal(TIGER, age)
+{}
 
 
 /********************************************************************
 ** Function: getName: Returns name of animal.
 ** Params:   None
-** Returns:  string name: "Tiger"
+** Returns:  const string &name: "Tiger"
 *********************************************************************/
-std::string Tiger::getName() const
+const std::string &Tiger::getName() const
 {
-    return name;
+    return getTraits().name;
 }
 
 
@@ -59,5 +49,5 @@ std::string Tiger::getName() const
 *********************************************************************/
 double Tiger::getFeedingCost() const
 {
-    return feeding_cost;
+    return getTraits().feeding_cost;
 }
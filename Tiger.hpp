@@ -12,8 +12,8 @@
  *              time, cost 5 times as much as the base cost to feed,
  *              and generates 20% of their purchasing cost as payoff.
  *              They inherit all data members and functions of Animal,
- *              with the addition of a string for their name, "Tiger",
- *              and a function to get their name.
+ *              and read their name, "Tiger", and traits from the
+ *              species registry.
 *********************************************************************/
 
 
@@ -23,18 +23,14 @@
 #include "Animal.hpp"
 #include <string>
 
-class Tiger : public Animal
+class Tiger final : public Animal
 {
-protected:
-    std::string name;
-    double feeding_cost;
-
 public:
 
     /********************************************************************
-    ** Function: Constructor/default: Sets age of tiger to argument. Sets
-     *           name, cost, number of babies, feeding cost, and payoff
-     *           with constant default values.
+    ** Function: Constructor/default: Sets age of tiger to argument.
+     *           Name, cost, number of babies, feeding cost, and
+     *           payoff are shared by all tigers in the species registry.
     ** Params:   int age: age of tiger.
      *          default = 0;
     ** Returns: None
@@ -45,9 +41,9 @@ public:
     /********************************************************************
     ** Function: getName: Returns name of animal.
     ** Params:   None
-    ** Returns:  string name: "Tiger"
+    ** Returns:  const string &name: "Tiger"
     *********************************************************************/
-    virtual std::string getName() const override;
+    virtual const std::string &getName() const override final;
 
 
     /********************************************************************
@@ -55,7 +51,7 @@ public:
     ** Params:   None
     ** Returns:  double feeding_cost.
     *********************************************************************/
-    virtual double getFeedingCost() const override;
+    virtual double getFeedingCost() const override final;
 
 };
 
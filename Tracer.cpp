@@ -0,0 +1,298 @@
+/*********************************************************************
+** Program name: Tracer.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 5:20 AM
+** Description: Class implementation file for Tracer class. Tracer
+ *              records spans of the simulation, such as each day,
+ *              each event handler, exhibit allocations, and file
+ *              I/O, and writes them as a Chrome trace JSON file that
+ *              chrome://tracing or Perfetto can open offline. Each
+ *              span carries its thread, and the zoo's day and
+ *              population when it started. Every thread records into
+ *              its own buffer, so tracing a parallel run only takes
+ *              a lock the first time a thread records a span. The Zoo
+ *              makes room for a day's spans before the day's phases,
+ *              so recording them does not allocate inside a phase.
+*********************************************************************/
+
+
+#include "Tracer.hpp"
+#include "Zoo.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+
+using std::string;
+using std::vector;
+
+typedef std::chrono::steady_clock Clock;
+
+//Initialize constants
+const size_t Tracer::MIN_DAY_SPANS = 256;
+
+//Initialize static members
+std::atomic<bool> Tracer::enabled(false);
+Clock::time_point Tracer::epoch;
+std::mutex Tracer::buffers_mutex;
+vector<Tracer::ThreadBuffer*> Tracer::buffers;
+std::atomic<int> Tracer::generation(0);
+thread_local Tracer::ThreadBuffer *Tracer::local_buffer = nullptr;
+thread_local int Tracer::local_generation = -1;
+
+/********************************************************************
+** Function: nanosecondsBetween: Returns nanoseconds from start to
+ *           end.
+** Params:   Clock::time_point start, end: the two times.
+** Returns:  int64_t: nanoseconds.
+*********************************************************************/
+static int64_t nanosecondsBetween(Clock::time_point start,
+                                    Clock::time_point end)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>
+            (end - start).count();
+}
+
+
+/********************************************************************
+** Function: Scope::Constructor: Starts a span of a zoo, if tracing
+ *           is on. The zoo's day and population are only read
+ *           when tracing.
+** Params:   const char *name: span name, must outlive the
+ *              trace, such as a string literal.
+ *           const Zoo &zoo: zoo the span belongs to.
+** Returns:  None
+*********************************************************************/
+Tracer::Scope::Scope(const char *name, const Zoo &zoo)
+    : name(name), day(-1), population(-1), tracing(enabled.load())
+{
+    if (tracing)
+    {
+        day = zoo.day_counter;
+        population = zoo.getPopulation();
+        start = Clock::now();
+    }
+}
+
+
+/********************************************************************
+** Function: Scope::Constructor: Starts a span outside any zoo, if
+ *           tracing is on.
+** Params:   const char *name: span name, must outlive the
+ *              trace, such as a string literal.
+** Returns:  None
+*********************************************************************/
+Tracer::Scope::Scope(const char *name)
+    : name(name), day(-1), population(-1), tracing(enabled.load())
+{
+    if (tracing)
+    {
+        start = Clock::now();
+    }
+}
+
+
+/********************************************************************
+** Function: Scope::Destructor: Records the span in this thread's
+ *           buffer.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+Tracer::Scope::~Scope()
+{
+    if (tracing)
+    {
+        Clock::time_point end = Clock::now();
+        Span span = {name, nanosecondsBetween(epoch, start),
+                        nanosecondsBetween(start, end), day, population};
+        threadBuffer()->spans.push_back(span);
+    }
+}
+
+
+/********************************************************************
+** Function: enable: Turns tracing on or off. Turning it on starts
+ *           the trace's clock. Call it before starting threads.
+** Params:   bool on: true to record spans.
+** Returns:  None
+*********************************************************************/
+void Tracer::enable(bool on)
+{
+    if (on && !enabled.load())
+    {
+        epoch = Clock::now();
+    }
+    enabled.store(on);
+}
+
+
+/********************************************************************
+** Function: isEnabled: Returns true if spans are recorded.
+** Params:   None
+** Returns:  bool: true if tracing.
+*********************************************************************/
+bool Tracer::isEnabled()
+{
+    return enabled.load();
+}
+
+
+/********************************************************************
+** Function: reserveDay: Makes room in this thread's buffer for
+ *           twice the spans of its busiest day so far, and at least
+ *           MIN_DAY_SPANS, if tracing. The Zoo calls it at the start
+ *           of each day, outside its phases.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void Tracer::reserveDay()
+{
+    const size_t DAY_ROOM_FACTOR = 2;
+
+    if (!enabled.load())
+    {
+        return;
+    }
+
+    ThreadBuffer *buffer = threadBuffer();
+    vector<Span> &spans = buffer->spans;
+
+    buffer->most_per_day = std::max(buffer->most_per_day,
+                                    spans.size() - buffer->day_start);
+    buffer->day_start = spans.size();
+
+    //grown geometrically, so the room is made rarely
+    size_t room = std::max(DAY_ROOM_FACTOR * buffer->most_per_day,
+                            MIN_DAY_SPANS);
+    if (spans.capacity() - spans.size() < room)
+    {
+        spans.reserve(std::max(spans.size() + room,
+                                DAY_ROOM_FACTOR * spans.capacity()));
+    }
+}
+
+
+/********************************************************************
+** Function: getSpanCount: Returns spans recorded by every thread.
+ *           Call it once threads have finished.
+** Params:   None
+** Returns:  size_t: number of spans.
+*********************************************************************/
+size_t Tracer::getSpanCount()
+{
+    std::lock_guard<std::mutex> lock(buffers_mutex);
+
+    size_t count = 0;
+    for (size_t i=0; i<buffers.size(); i++)
+    {
+        count += buffers[i]->spans.size();
+    }
+    return count;
+}
+
+
+/********************************************************************
+** Function: writeJson: Writes every span as a Chrome trace JSON
+ *           file. Call it once threads have finished.
+** Params:   const std::string &path: file to write.
+** Returns:  bool: true if the file was written.
+*********************************************************************/
+bool Tracer::writeJson(const string &path)
+{
+    const int PROCESS_ID = 1;
+    const double NS_PER_US = 1000.0;
+    const int DIGITS = 3;
+
+    std::ofstream json(path);
+    if (!json)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(buffers_mutex);
+
+    json << std::fixed << std::setprecision(DIGITS);
+    json << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [" << '\n';
+
+    bool first = true;
+    for (size_t i=0; i<buffers.size(); i++)
+    {
+        const ThreadBuffer &buffer = *buffers[i];
+
+        //name each thread, so viewers label its track
+        json << (first ? "" : ",\n")
+                << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": "
+                << PROCESS_ID << ", \"tid\": " << buffer.thread_id
+                << ", \"args\": {\"name\": \"thread "
+                << buffer.thread_id << "\"}}";
+        first = false;
+
+        //spans are complete events, times in microseconds
+        for (size_t k=0; k<buffer.spans.size(); k++)
+        {
+            const Span &span = buffer.spans[k];
+            json << ",\n{\"name\": \"" << span.name
+                    << "\", \"ph\": \"X\", \"pid\": " << PROCESS_ID
+                    << ", \"tid\": " << buffer.thread_id
+                    << ", \"ts\": " << span.start_ns / NS_PER_US
+                    << ", \"dur\": " << span.duration_ns / NS_PER_US
+                    << ", \"args\": {";
+            if (span.day >= 0)
+            {
+                json << "\"day\": " << span.day
+                        << ", \"population\": " << span.population;
+            }
+            json << "}}";
+        }
+    }
+
+    json << '\n' << "]}" << '\n';
+    json.close();
+
+    return static_cast<bool>(json);
+}
+
+
+/********************************************************************
+** Function: reset: Frees every buffer and the spans in it. Call it
+ *           once threads have finished.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void Tracer::reset()
+{
+    std::lock_guard<std::mutex> lock(buffers_mutex);
+
+    for (size_t i=0; i<buffers.size(); i++)
+    {
+        delete buffers[i];
+        buffers[i] = nullptr;
+    }
+    buffers.clear();
+    generation++;
+}
+
+
+/********************************************************************
+** Function: threadBuffer: Returns this thread's buffer, making
+ *           and registering it on the thread's first span.
+** Params:   None
+** Returns:  ThreadBuffer *: the buffer.
+*********************************************************************/
+Tracer::ThreadBuffer *Tracer::threadBuffer()
+{
+    if (local_buffer && local_generation == generation.load())
+    {
+        return local_buffer;
+    }
+
+    std::lock_guard<std::mutex> lock(buffers_mutex);
+
+    local_buffer = new ThreadBuffer;
+    local_buffer->thread_id = static_cast<int>(buffers.size()) + 1;
+    local_buffer->day_start = 0;
+    local_buffer->most_per_day = 0;
+    local_generation = generation.load();
+    buffers.push_back(local_buffer);
+
+    return local_buffer;
+}
@@ -0,0 +1,175 @@
+/*********************************************************************
+** Program name: Tracer.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 5:20 AM
+** Description: Class specification file for Tracer class. Tracer
+ *              records spans of the simulation, such as each day,
+ *              each event handler, exhibit allocations, and file
+ *              I/O, and writes them as a Chrome trace JSON file that
+ *              chrome://tracing or Perfetto can open offline. Each
+ *              span carries its thread, and the zoo's day and
+ *              population when it started. Every thread records into
+ *              its own buffer, so tracing a parallel run only takes
+ *              a lock the first time a thread records a span. The Zoo
+ *              makes room for a day's spans before the day's phases,
+ *              so recording them does not allocate inside a phase.
+*********************************************************************/
+
+
+#ifndef TRACER_HPP
+#define TRACER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class Zoo;
+
+class Tracer
+{
+public:
+    //Records a span from construction to the end of its block
+    class Scope
+    {
+    private:
+        const char *name;
+        int day;                //day of the zoo, -1 outside a zoo
+        int64_t population;     //animals in the zoo, -1 outside a zoo
+        bool tracing;           //false if tracing was off when it started
+        std::chrono::steady_clock::time_point start;
+
+    public:
+
+        /****************************************************************
+        ** Function: Constructor: Starts a span of a zoo, if tracing
+         *           is on. The zoo's day and population are only read
+         *           when tracing.
+        ** Params:   const char *name: span name, must outlive the
+         *              trace, such as a string literal.
+         *           const Zoo &zoo: zoo the span belongs to.
+        ** Returns:  None
+        *****************************************************************/
+        Scope(const char *name, const Zoo &zoo);
+
+
+        /****************************************************************
+        ** Function: Constructor: Starts a span outside any zoo, if
+         *           tracing is on.
+        ** Params:   const char *name: span name, must outlive the
+         *              trace, such as a string literal.
+        ** Returns:  None
+        *****************************************************************/
+        explicit Scope(const char *name);
+
+
+        /****************************************************************
+        ** Function: Destructor: Records the span in this thread's
+         *           buffer.
+        ** Params:   None
+        ** Returns:  None
+        *****************************************************************/
+        ~Scope();
+    };
+
+private:
+    //One finished span
+    struct Span
+    {
+        const char *name;
+        int64_t start_ns;       //since tracing was enabled
+        int64_t duration_ns;
+        int day;
+        int64_t population;
+    };
+
+    //Spans recorded by one thread
+    struct ThreadBuffer
+    {
+        int thread_id;          //1 for the first thread to record
+        std::vector<Span> spans;
+        size_t day_start;       //spans before the current day
+        size_t most_per_day;    //spans of the busiest day so far
+    };
+
+    //Fewest spans a day's room is made for
+    static const size_t MIN_DAY_SPANS;
+
+    static std::atomic<bool> enabled;
+    static std::chrono::steady_clock::time_point epoch;
+    static std::mutex buffers_mutex;    //guards buffers, not their spans
+    static std::vector<ThreadBuffer*> buffers;
+    static std::atomic<int> generation; //times reset, so old buffers drop
+    static thread_local ThreadBuffer *local_buffer;   //this thread's
+    static thread_local int local_generation;   //reset it was made after
+
+public:
+
+    /********************************************************************
+    ** Function: enable: Turns tracing on or off. Turning it on starts
+     *           the trace's clock. Call it before starting threads.
+    ** Params:   bool on: true to record spans.
+    ** Returns:  None
+    *********************************************************************/
+    static void enable(bool on = true);
+
+
+    /********************************************************************
+    ** Function: isEnabled: Returns true if spans are recorded.
+    ** Params:   None
+    ** Returns:  bool: true if tracing.
+    *********************************************************************/
+    static bool isEnabled();
+
+
+    /********************************************************************
+    ** Function: reserveDay: Makes room in this thread's buffer for
+     *           twice the spans of its busiest day so far, and at least
+     *           MIN_DAY_SPANS, if tracing. The Zoo calls it at the start
+     *           of each day, outside its phases.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    static void reserveDay();
+
+
+    /********************************************************************
+    ** Function: getSpanCount: Returns spans recorded by every thread.
+     *           Call it once threads have finished.
+    ** Params:   None
+    ** Returns:  size_t: number of spans.
+    *********************************************************************/
+    static size_t getSpanCount();
+
+
+    /********************************************************************
+    ** Function: writeJson: Writes every span as a Chrome trace JSON
+     *           file. Call it once threads have finished.
+    ** Params:   const std::string &path: file to write.
+    ** Returns:  bool: true if the file was written.
+    *********************************************************************/
+    static bool writeJson(const std::string &path);
+
+
+    /********************************************************************
+    ** Function: reset: Frees every buffer and the spans in it. Call it
+     *           once threads have finished.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    static void reset();
+
+private:
+
+    /********************************************************************
+    ** Function: threadBuffer: Returns this thread's buffer, making
+     *           and registering it on the thread's first span.
+    ** Params:   None
+    ** Returns:  ThreadBuffer *: the buffer.
+    *********************************************************************/
+    static ThreadBuffer *threadBuffer();
+};
+
+#endif
@@ -12,9 +12,8 @@
  *              babies at a time, feeding costs are half that of the
  *              base food cost, and generates 5% of their purchasing
  *              cost as payoff. They inherit all data members and
- *              functions of Animal, with the addition of a string
- *              for their name, "Turtle", and a function to get their
- *              name.
+ *              functions of Animal, and read their name, "Turtle", and
+ *              traits from the species registry.
 *********************************************************************/
 
 
@@ -22,33 +21,24 @@
 
 /********************************************************************
 ** Function: Constructor/default: Sets age of turtle to argument.
- *           Sets name, cost, number of babies, feeding cost, and
- *           payoff with constant default values.
+ *           Name, cost, number of babies, feeding cost, and
+ *           payoff are shared by all turtles in the species registry.
 ** Params:   int age: age of turtle.
  *          default = 0;
 ** Returns: None
 *********************************************************************/
-Turtle::Turtle(int age)
-{
-    this->age = age;
-    name = DEFAULTS[TURTLE].default_name;
-    cost = DEFAULTS[TURTLE].default_cost;
-    num_babies = DEFAULTS[TURTLE].default_num_babies;
-    feeding_cost = DEFAULTS[TURTLE].default_food_cost_multiplier
-                   * getBaseFoodCost();
-    payoff = DEFAULTS[TURTLE].default_cost
-             * DEFAULTS[TURTLE].default_payoff_percentage;
-}
+Turtle::Turtle(int age) : Animal(TURTLE, age)
+{}
 
 
 /********************************************************************
 ** Function: getName: Returns name of animal.
 ** Params:   None
-** Returns:  string name: "Turtle"
+** Returns:  const string &name: "Turtle"
 *********************************************************************/
-std::string Turtle::getName() const
+const std::string &Turtle::getName() const
 {
-    return name;
+    return getTraits().name;
 }
 
 
@@ -59,5 +49,5 @@ std::string Turtle::getName() const
 *********************************************************************/
 double Turtle::getFeedingCost() const
 {
-    return feeding_cost;
+    return getTraits().feeding_cost;
 }
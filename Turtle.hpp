@@ -12,9 +12,8 @@
  *              babies at a time, feeding costs are half that of the
  *              base food cost, and generates 5% of their purchasing
  *              cost as payoff. They inherit all data members and
- *              functions of Animal, with the addition of a string
- *              for their name, "Turtle", and a function to get their
- *              name.
+ *              functions of Animal, and read their name, "Turtle", and
+ *              traits from the species registry.
 *********************************************************************/
 
 
@@ -24,18 +23,14 @@
 #include "Animal.hpp"
 #include <string>
 
-class Turtle : public Animal
+class Turtle final : public Animal
 {
-protected:
-    std::string name;
-    double feeding_cost;
-
 public:
 
     /********************************************************************
     ** Function: Constructor/default: Sets age of turtle to argument.
-     *           Sets name, cost, number of babies, feeding cost, and
-     *           payoff with constant default values.
+     *           Name, cost, number of babies, feeding cost, and
+     *           payoff are shared by all turtles in the species registry.
     ** Params:   int age: age of turtle.
      *          default = 0;
     ** Returns: None
@@ -46,9 +41,9 @@ public:
     /********************************************************************
     ** Function: getName: Returns name of animal.
     ** Params:   None
-    ** Returns:  string name: "Turtle"
+    ** Returns:  const string &name: "Turtle"
     *********************************************************************/
-    virtual std::string getName() const override;
+    virtual const std::string &getName() const override final;
 
 
     /********************************************************************
@@ -56,7 +51,7 @@ public:
     ** Params:   None
     ** Returns:  double feeding_cost.
     *********************************************************************/
-    virtual double getFeedingCost() const override;
+    virtual double getFeedingCost() const override final;
 
 };
 
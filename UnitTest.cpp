@@ -0,0 +1,780 @@
+/*********************************************************************
+** Program name: UnitTest.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 11:30 AM
+** Description: Class implementation file for UnitTest class. A
+ *              UnitTest runs behavior checks that a game played by
+ *              hand would not notice breaking: which inputs
+ *              ValidateInput::parseInteger accepts, exact sums of
+ *              squares, the limits of a packed animal record, that
+ *              Animal and its species wrap the same records and
+ *              traits the Zoo stores, that the Zoo's per-exhibit
+ *              daily passes add up to what each animal costs and
+ *              earns, how animal handles are given out and
+ *              invalidated, and that exhibits stay in age order,
+ *              also as age cohorts.
+ *              Each check that fails is printed and
+ *              counted, built and run by make test.
+*********************************************************************/
+
+
+#include "UnitTest.hpp"
+#include "Tiger.hpp"
+#include "Penguin.hpp"
+#include "Turtle.hpp"
+#include "CustomAnimal.hpp"
+#include "ValidateInput.hpp"
+#include "CheckedMath.hpp"
+#include "Zoo.hpp"
+#include <iostream>
+#include <limits>
+
+using std::cout;
+using std::endl;
+using std::string;
+using std::vector;
+
+//Value parseInteger must leave alone when it rejects an input
+static const int UNTOUCHED = -7;
+
+/********************************************************************
+** Function: Constructor/default: Sets up a test run with no checks
+ *           run yet.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+UnitTest::UnitTest() : checks(0), failures(0)
+{}
+
+
+/********************************************************************
+** Function: run: Runs every check, printing the ones that fail,
+ *           then a line with the totals.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void UnitTest::run()
+{
+    testParseInteger();
+    testSquareSums();
+    testRecordLimits();
+    testAnimalWrappers();
+    testDailyPassTotals();
+    testHandles();
+    testAgeOrder();
+    testCohortSwitching();
+
+    cout << checks - failures << " of " << checks << " checks passed"
+            << endl;
+}
+
+
+/********************************************************************
+** Function: getFailureCount: Returns how many checks failed.
+** Params:   None
+** Returns:  int: failed checks, 0 if every check passed.
+*********************************************************************/
+int UnitTest::getFailureCount() const
+{
+    return failures;
+}
+
+
+/********************************************************************
+** Function: testParseInteger: Checks which strings parseInteger
+ *           accepts and what it parses them to: an optional sign,
+ *           then digits only, within the range of int.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void UnitTest::testParseInteger()
+{
+    const int INT_MAX_VALUE = std::numeric_limits<int>::max();
+    const int INT_MIN_VALUE = std::numeric_limits<int>::min();
+
+    //a sign alone, or nothing at all, is not a number
+    checkParse("", false);
+    checkParse("-", false);
+    checkParse("+", false);
+
+    checkParse("0", true, 0);
+    checkParse("42", true, 42);
+    checkParse("+5", true, 5);
+    checkParse("-5", true, -5);
+    checkParse("007", true, 7);
+
+    //both ends of int, and one past each
+    checkParse("2147483647", true, INT_MAX_VALUE);
+    checkParse("2147483648", false);
+    checkParse("-2147483648", true, INT_MIN_VALUE);
+    checkParse("-2147483649", false);
+    checkParse("99999999999999999999", false);
+
+    //anything but the digits rejects the whole input
+    checkParse("12abc", false);
+    checkParse("12 ", false);
+    checkParse(" 12", false);
+    checkParse("1.5", false);
+    checkParse("--1", false);
+    checkParse("+-1", false);
+    checkParse(string("12\0", 3), false);
+}
+
+
+/********************************************************************
+** Function: testSquareSums: Checks that CheckedMath::addSquare
+ *           keeps sums of squared cents exact in 128 bits, as sweeps
+ *           add up final bank accounts, and clamps past them.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void UnitTest::testSquareSums()
+{
+    const uint64_t TOP_BIT = 1ULL << 62;
+
+    uint64_t high = 0;
+    uint64_t low = 0;
+    check(CheckedMath::addSquare(3, high, low)
+            && CheckedMath::addSquare(-4, high, low)
+            && high == 0 && low == 25,
+            "addSquare adds 3 squared and -4 squared to 25");
+
+    //(2^32)^2 is the first square past the low half
+    high = 0;
+    low = UINT64_MAX;
+    check(CheckedMath::addSquare(1LL << 32, high, low)
+            && high == 1 && low == UINT64_MAX,
+            "addSquare carries into the high half");
+
+    //(2^63-1)^2 = 2^126 - 2^64 + 1, and (-2^63)^2 = 2^126
+    high = 0;
+    low = 0;
+    check(CheckedMath::addSquare(INT64_MAX, high, low)
+            && high == TOP_BIT - 1 && low == 1,
+            "addSquare squares the largest int64_t exactly");
+    high = 0;
+    low = 0;
+    check(CheckedMath::addSquare(INT64_MIN, high, low)
+            && high == TOP_BIT && low == 0,
+            "addSquare squares the smallest int64_t exactly");
+
+    //four of them make 2^128, one past the sum's limit
+    bool fits = CheckedMath::addSquare(INT64_MIN, high, low)
+            && CheckedMath::addSquare(INT64_MIN, high, low);
+    check(fits && !CheckedMath::addSquare(INT64_MIN, high, low)
+            && high == UINT64_MAX && low == UINT64_MAX,
+            "addSquare clamps a sum past 128 bits");
+}
+
+
+/********************************************************************
+** Function: testRecordLimits: Checks that a record holds its age at
+ *           AnimalRecord::MAX_AGE, and that the species registry
+ *           refuses new traits once its IDs no longer fit a record.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void UnitTest::testRecordLimits()
+{
+    AnimalRecord old_tiger(TIGER, AnimalRecord::MAX_AGE - 1);
+    old_tiger.incrementAge();
+    old_tiger.incrementAge();
+    check(old_tiger.getAge() == AnimalRecord::MAX_AGE
+            && old_tiger.getSpecies() == TIGER,
+            "a record's age stops at MAX_AGE");
+    check(AnimalRecord(PENGUIN, AnimalRecord::MAX_AGE + 10).getAge()
+            == AnimalRecord::MAX_AGE,
+            "a record made older than MAX_AGE is MAX_AGE");
+
+    //fill every ID a record can hold with new traits
+    SpeciesRegistry::reset();
+    SpeciesId first = SpeciesRegistry::intern("Filler", 100, 1, 10, 0);
+    SpeciesId last = first;
+    for (int payoff=1; last+1 < SpeciesRegistry::MAX_IDS; payoff++)
+    {
+        last = SpeciesRegistry::intern("Filler", 100, 1, 10, payoff);
+    }
+    check(SpeciesRegistry::intern("Filler", 100, 1, 10, -1) == -1,
+            "intern refuses new traits once the registry is full");
+    check(SpeciesRegistry::intern("Filler", 100, 1, 10, 0) == first,
+            "intern still finds traits it has");
+    CustomAnimal generic("Filler", 3, 100, 1, 10, -1);
+    check(generic.getSpecies() == CUSTOM,
+            "CustomAnimal is a generic new animal once the registry is full");
+    SpeciesRegistry::reset();
+}
+
+
+/********************************************************************
+** Function: testAnimalWrappers: Checks that Tiger, Penguin, Turtle,
+ *           and CustomAnimal hold the record a Zoo would store for
+ *           them, and answer the Animal class API from their species'
+ *           registry entry, as they did before records replaced them.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void UnitTest::testAnimalWrappers()
+{
+    Tiger tiger(4);
+    Penguin penguin;
+    Turtle turtle(2);
+    CustomAnimal alpaca("Alpaca", 3, 500, 2, 35, 300);
+    const Animal *ANIMALS[] = {&tiger, &penguin, &turtle, &alpaca};
+    const SpeciesId SPECIES[] = {TIGER, PENGUIN, TURTLE,
+            SpeciesRegistry::intern("Alpaca", 500, 2, 35, 300)};
+    const int AGES[] = {4, 0, 2, 3};
+    const int ANIMALS_SIZE = 4;
+
+    for (int i=0; i<ANIMALS_SIZE; i++)
+    {
+        const Animal &animal = *ANIMALS[i];
+        const SpeciesRegistry::Species &traits =
+                SpeciesRegistry::get(SPECIES[i]);
+        const AnimalRecord &record = animal.getRecord();
+        const string NAME = traits.name;
+
+        check(animal.getSpecies() == SPECIES[i]
+                && record.getSpecies() == SPECIES[i]
+                && animal.getAge() == AGES[i] && record.getAge() == AGES[i],
+                NAME + " wraps the record of its species and age");
+        check(&animal.getTraits() == &traits
+                && &animal.getName() == &traits.name,
+                NAME + " reads its species' registry entry");
+        check(animal.getCost() == record.getCost()
+                && animal.getNumBabies() == record.getNumBabies()
+                && animal.getFeedingCost() == record.getFeedingCost()
+                && animal.getPayoff() == record.getPayoff()
+                && animal.isAdult() == record.isAdult(),
+                NAME + " has the traits of its record");
+    }
+
+    //traits and ages are what the classes always gave
+    check(tiger.getCost() == 10000 && tiger.getNumBabies() == 1
+            && tiger.getFeedingCost() == 5 * Animal::getBaseFoodCost()
+            && tiger.getPayoff() == 2000,
+            "Tiger keeps its traits");
+    check(alpaca.getName() == "Alpaca" && alpaca.getFeedingCost() == 35,
+            "CustomAnimal keeps the traits it was made with");
+
+    //an animal built from a stored record, aging like one
+    CustomAnimal copy(alpaca.getSpecies(), alpaca.getAge());
+    copy.incrementAge();
+    AnimalRecord stored = alpaca.getRecord();
+    stored.incrementAge();
+    check(copy.getSpecies() == stored.getSpecies()
+            && copy.getAge() == stored.getAge() && copy.isAdult(),
+            "CustomAnimal built from a record ages like the record");
+}
+
+
+/********************************************************************
+** Function: testDailyPassTotals: Checks that feeding the zoo and
+ *           collecting its profits, which look traits up once per
+ *           exhibit or sub-exhibit, move the bank by exactly the
+ *           sum over every animal, for each feed type.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void UnitTest::testDailyPassTotals()
+{
+    const Zoo::FeedType FEED_TYPES[] = {Zoo::CHEAP, Zoo::GENERIC,
+                                        Zoo::PREMIUM};
+    const int FEED_TYPES_SIZE = 3;
+
+    //every registered species, and two new animals sharing one set of
+    // traits next to one with another
+    Zoo zoo(Zoo::DEFAULT_POLICY, 1);
+    const SpeciesId ALPACA = SpeciesRegistry::intern("Alpaca", 500, 2, 35,
+                                                        300);
+    const SpeciesId IBIS = SpeciesRegistry::intern("Ibis", 150, 3, 15, 120);
+    const SpeciesId ADDED[] = {TIGER, TIGER, PENGUIN, TURTLE, TURTLE,
+                                TURTLE, ALPACA, IBIS, ALPACA};
+    const int AGES[] = {3, 12, 1, 0, 5, 3, 3, 3, 4};
+    const int ADDED_SIZE = 9;
+    for (int i=0; i<ADDED_SIZE; i++)
+    {
+        zoo.addAnimal(ADDED[i], AGES[i], true);
+    }
+    zoo.tiger_bonus = Money::fromDollars(250) * 2;
+
+    for (int f=0; f<FEED_TYPES_SIZE; f++)
+    {
+        zoo.changeFoodCostMultiplier(FEED_TYPES[f]);
+
+        //what the passes would add up to one animal at a time
+        Money feeding_costs;
+        Money profits;
+        for (int i=0; i<zoo.num_exhibits; i++)
+        {
+            for (int64_t k=0; k<zoo.exhibit_count[i].count; k++)
+            {
+                const AnimalRecord &animal = zoo.animal_exhibits[i][k];
+                feeding_costs += Money::fromDollars(
+                        zoo.food_cost_multiplier * animal.getFeedingCost());
+                profits += Money::fromDollars(animal.getPayoff());
+            }
+        }
+
+        const string FEED = "feed type " + std::to_string(f);
+        Money before = zoo.bank_account;
+        zoo.feedAllAnimals();
+        check(zoo.bank_account == before - feeding_costs,
+                "feedAllAnimals subtracts every animal's feeding cost, "
+                + FEED);
+
+        before = zoo.bank_account;
+        zoo.calculateAnimalProfits();
+        check(zoo.bank_account == before + profits + zoo.tiger_bonus,
+                "calculateAnimalProfits adds every animal's payoff, "
+                + FEED);
+    }
+}
+
+
+/********************************************************************
+** Function: testHandles: Checks that animals only get a handle when
+ *           one is asked for, that handles follow animals as their
+ *           exhibit is reordered, stop finding animals that die even
+ *           once their slot is reused, and all stop when the exhibit
+ *           switches to age cohorts.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void UnitTest::testHandles()
+{
+    const int AGES[] = {5, 3, 1};
+    const int AGES_SIZE = 3;
+    const int NEW_AGE = 4;
+    const int REUSED_AGE = 2;
+
+    Zoo zoo(Zoo::DEFAULT_POLICY, 1);
+    for (int i=0; i<AGES_SIZE; i++)
+    {
+        zoo.addAnimal(TIGER, AGES[i], true);
+    }
+    check(zoo.animal_slots[TIGER].empty()
+            && zoo.getBytesPerAnimal().handles == 0,
+            "animals nobody asked about have no handles");
+
+    //oldest first, so index 1 is the tiger aged 3
+    SlotMap::Handle handles[AGES_SIZE + 1];
+    for (int i=0; i<AGES_SIZE; i++)
+    {
+        handles[i] = zoo.getHandle(TIGER, i);
+    }
+    SlotMap::Handle again = zoo.getHandle(TIGER, 1);
+    check(again.index == handles[1].index
+            && again.generation == handles[1].generation,
+            "asking twice gives the same handle");
+    check(zoo.getHandle(TIGER, AGES_SIZE).index == SlotMap::NO_HANDLE.index
+            && zoo.getHandle(TURTLE, 0).index == SlotMap::NO_HANDLE.index,
+            "there is no handle past the last animal");
+
+    //an older tiger moves the younger ones along
+    zoo.addAnimal(TIGER, NEW_AGE, true);
+    handles[AGES_SIZE] = zoo.getHandle(TIGER, 1);
+    const int HANDLE_AGES[] = {5, 3, 1, NEW_AGE};
+    AnimalRecord animal;
+    bool followed = true;
+    for (int i=0; i<=AGES_SIZE; i++)
+    {
+        followed = followed && zoo.findAnimal(handles[i], animal)
+                    && animal.getAge() == HANDLE_AGES[i];
+    }
+    check(followed, "handles follow animals moved by an older one");
+
+    //one tiger dies, only its handle stops finding it
+    zoo.removeAnimal(TIGER);
+    int dead = -1;
+    int lost = 0;
+    bool kept = true;
+    for (int i=0; i<=AGES_SIZE; i++)
+    {
+        if (!zoo.findAnimal(handles[i], animal))
+        {
+            dead = i;
+            lost++;
+        }
+        else
+        {
+            kept = kept && animal.getAge() == HANDLE_AGES[i];
+        }
+    }
+    check(lost == 1 && kept, "a dead animal's handle stops finding it");
+
+    //a newborn asked about reuses the dead animal's slot
+    zoo.addAnimal(TIGER, REUSED_AGE, true);
+    SlotMap::Handle reused = zoo.getHandle(TIGER,
+                                zoo.countOlderThan(TIGER, REUSED_AGE));
+    check(dead >= 0 && reused.index == handles[dead].index
+            && reused.generation != handles[dead].generation
+            && zoo.findAnimal(reused, animal)
+            && animal.getAge() == REUSED_AGE
+            && !zoo.findAnimal(handles[dead], animal),
+            "a reused slot does not bring back a stale handle");
+
+    //new animals' sub-exhibits close up around a dead animal too
+    const SpeciesId ALPACA = SpeciesRegistry::intern("Alpaca", 500, 2, 35,
+                                                        300);
+    const SpeciesId IBIS = SpeciesRegistry::intern("Ibis", 150, 3, 15, 120);
+    const SpeciesId NEW_ANIMALS[] = {ALPACA, IBIS, ALPACA, IBIS};
+    const int NEW_ANIMALS_SIZE = 4;
+    SlotMap::Handle custom[NEW_ANIMALS_SIZE];
+    SpeciesId species[NEW_ANIMALS_SIZE];
+    for (int i=0; i<NEW_ANIMALS_SIZE; i++)
+    {
+        zoo.addAnimal(NEW_ANIMALS[i], REUSED_AGE, true);
+    }
+    for (int i=0; i<NEW_ANIMALS_SIZE; i++)
+    {
+        custom[i] = zoo.getHandle(CUSTOM, i);
+        zoo.findAnimal(custom[i], animal);
+        species[i] = animal.getSpecies();
+    }
+    zoo.removeAnimal(CUSTOM);
+    int found = 0;
+    bool same = true;
+    for (int i=0; i<NEW_ANIMALS_SIZE; i++)
+    {
+        if (zoo.findAnimal(custom[i], animal))
+        {
+            found++;
+            same = same && animal.getSpecies() == species[i];
+        }
+    }
+    check(found == NEW_ANIMALS_SIZE - 1 && same,
+            "handles follow new animals when their sub-exhibit shrinks");
+
+    //cohorts are not animals, so every tiger handle dies
+    zoo.setCohortThreshold(1);
+    bool invalidated = !zoo.findAnimal(reused, animal);
+    for (int i=0; i<=AGES_SIZE; i++)
+    {
+        invalidated = invalidated && !zoo.findAnimal(handles[i], animal);
+    }
+    check(invalidated && zoo.animal_slots[TIGER].empty()
+            && zoo.getHandle(TIGER, 0).index == SlotMap::NO_HANDLE.index,
+            "switching to age cohorts invalidates every handle");
+}
+
+
+/********************************************************************
+** Function: testAgeOrder: Checks that an exhibit stays oldest first,
+ *           and its age queries agree with counting every animal,
+ *           after animals are bought, born, age, and die, and after
+ *           it switches to age cohorts and back.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void UnitTest::testAgeOrder()
+{
+    const int BOUGHT_AGES[] = {2, 7, 0, 7, 4, 1};
+    const int BOUGHT_AGES_SIZE = 6;
+    const int BIRTHS = 3;
+    const int DEATHS = 3;
+    const int COHORT_AGE = 5;
+
+    Zoo zoo(Zoo::DEFAULT_POLICY, 1);
+    for (int i=0; i<BOUGHT_AGES_SIZE; i++)
+    {
+        zoo.addAnimal(TIGER, BOUGHT_AGES[i]);
+    }
+    checkAgeOrder(zoo, TIGER, "after buying");
+
+    AnimalRecord parent;
+    for (int i=0; i<BIRTHS; i++)
+    {
+        zoo.findOldest(TIGER, parent);
+        zoo.giveBirth(parent);
+    }
+    checkAgeOrder(zoo, TIGER, "after births");
+
+    zoo.increaseAnimalsAge();
+    checkAgeOrder(zoo, TIGER, "after a day");
+
+    for (int i=0; i<DEATHS; i++)
+    {
+        zoo.removeAnimal(TIGER);
+    }
+    checkAgeOrder(zoo, TIGER, "after deaths");
+
+    //just under the exhibit's size, so it switches now
+    zoo.setCohortThreshold(zoo.exhibit_count[TIGER].count - 1);
+    check(zoo.exhibit_count[TIGER].cohorts,
+            "an exhibit over the threshold switches to age cohorts");
+    checkAgeOrder(zoo, TIGER, "after switching to age cohorts");
+
+    zoo.findOldest(TIGER, parent);
+    zoo.giveBirth(parent);
+    zoo.addAnimal(TIGER, COHORT_AGE);
+    zoo.increaseAnimalsAge();
+    zoo.removeAnimal(TIGER);
+    checkAgeOrder(zoo, TIGER, "as age cohorts");
+
+    zoo.setCohortThreshold(Zoo::COHORT_THRESHOLD_DEFAULT);
+    check(!zoo.exhibit_count[TIGER].cohorts,
+            "an exhibit under half the threshold switches back");
+    checkAgeOrder(zoo, TIGER, "after switching back to animals");
+}
+
+
+/********************************************************************
+** Function: testCohortSwitching: Checks that exhibits switch to age
+ *           cohorts once they hold more than the cohort threshold,
+ *           and back below half of it, in the middle of a run, and
+ *           that the run keeps the same animals of the same ages
+ *           every day as one that never switches. Also checks that
+ *           removing an animal from age cohorts by index picks the
+ *           age it would have laid out oldest first.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void UnitTest::testCohortSwitching()
+{
+    //small enough that births and deaths cross it both ways
+    const int THRESHOLD = 6;
+    const unsigned int SEED = 3;
+    const int HORIZON = 60;
+    const Zoo::Policy POLICY = {Zoo::CHEAP, 3, 3, 3, -1, 0};
+    const int AGES[] = {4, 1, 6, 4, 0, 9, 1, 4};
+    const int AGES_SIZE = 8;
+
+    Zoo animals(POLICY, SEED);
+    vector<vector<int> > animal_ages;
+    vector<bool> never_cohorts;
+    runRecordingAges(animals, HORIZON, animal_ages, never_cohorts);
+
+    Zoo cohorts(POLICY, SEED);
+    cohorts.setCohortThreshold(THRESHOLD);
+    vector<vector<int> > cohort_ages;
+    vector<bool> kept_as_cohorts;
+    runRecordingAges(cohorts, HORIZON, cohort_ages, kept_as_cohorts);
+
+    check(cohort_ages == animal_ages
+            && cohorts.bank_account == animals.bank_account,
+            "a run switching to age cohorts keeps the same animals");
+
+    //days start a new row of exhibits, which never switch between
+    int exhibits = cohorts.num_exhibits;
+    bool switched_to = false;
+    bool switched_back = false;
+    bool sizes_match = true;
+    bool ordered = true;
+    for (size_t i=0; i<cohort_ages.size(); i++)
+    {
+        int64_t count = static_cast<int64_t>(cohort_ages[i].size());
+        sizes_match = sizes_match
+                && (count <= THRESHOLD || kept_as_cohorts[i])
+                && (count >= THRESHOLD / 2 || !kept_as_cohorts[i]);
+        if (i >= static_cast<size_t>(exhibits))
+        {
+            switched_to = switched_to
+                    || (!kept_as_cohorts[i - exhibits] && kept_as_cohorts[i]);
+            switched_back = switched_back
+                    || (kept_as_cohorts[i - exhibits] && !kept_as_cohorts[i]);
+        }
+        for (size_t k=1; k<cohort_ages[i].size(); k++)
+        {
+            ordered = ordered && cohort_ages[i][k-1] >= cohort_ages[i][k];
+        }
+    }
+    check(switched_to && switched_back,
+            "an exhibit switches to age cohorts and back mid-run");
+    check(sizes_match,
+            "exhibits are age cohorts over the threshold, animals under half");
+    check(ordered, "exhibits stay oldest first through every switch");
+
+    //removing by index must weight each age by its cohort's size
+    Zoo zoo(Zoo::DEFAULT_POLICY, SEED);
+    zoo.setCohortThreshold(1);
+    for (int i=0; i<AGES_SIZE; i++)
+    {
+        zoo.addAnimal(TURTLE, AGES[i]);
+    }
+    vector<int> laid_out = getAges(zoo, TURTLE);
+    bool weighted = zoo.exhibit_count[TURTLE].cohorts
+                    && static_cast<int>(laid_out.size()) == AGES_SIZE;
+    for (int i=0; i<AGES_SIZE; i++)
+    {
+        AnimalRecord removed = zoo.removeFromCohorts(TURTLE, i);
+        weighted = weighted && removed.getAge() == laid_out[i];
+
+        //put it back, addToCohorts counts it again
+        zoo.addToCohorts(TURTLE, removed.getAge());
+        zoo.exhibit_count[TURTLE].count--;
+    }
+    check(weighted && getAges(zoo, TURTLE) == laid_out,
+            "removing from age cohorts picks the age at that index");
+}
+
+
+/********************************************************************
+** Function: checkParse: Checks that parseInteger accepts input and
+ *           parses it to expected, or rejects it, leaving the
+ *           output alone.
+** Params:   const string &input: text to parse.
+ *           bool valid: true if input should be accepted.
+ *           int expected: value it should parse to, if valid.
+** Returns:  None
+*********************************************************************/
+void UnitTest::checkParse(const string &input, bool valid, int expected)
+{
+    int parsed = UNTOUCHED;
+    bool accepted = ValidateInput::parseInteger(input, parsed);
+
+    if (valid)
+    {
+        check(accepted && parsed == expected,
+                "parseInteger(\"" + input + "\") gives "
+                + std::to_string(expected));
+    }
+    else
+    {
+        check(!accepted && parsed == UNTOUCHED,
+                "parseInteger(\"" + input + "\") is rejected");
+    }
+}
+
+
+/********************************************************************
+** Function: checkAgeOrder: Checks that an exhibit's ages never rise
+ *           from its oldest animal to its youngest, and that
+ *           countAdults, countOlderThan, countInAgeRange, findOldest,
+ *           and findYoungest agree with counting its ages one by one.
+** Params:   const Zoo &zoo: zoo to check.
+ *           SpeciesId type: registered species' exhibit to check.
+ *           const string &when: what just happened to the exhibit.
+** Returns:  None
+*********************************************************************/
+void UnitTest::checkAgeOrder(const Zoo &zoo, SpeciesId type,
+                                const string &when)
+{
+    //same age as AnimalRecord::isAdult
+    const int ADULT_AGE = 3;
+
+    vector<int> ages = getAges(zoo, type);
+    int64_t count = zoo.exhibit_count[type].count;
+    bool ordered = static_cast<int64_t>(ages.size()) == count;
+    for (size_t i=1; i<ages.size(); i++)
+    {
+        ordered = ordered && ages[i-1] >= ages[i];
+    }
+    check(ordered, "exhibit stays oldest first " + when);
+
+    //every age from newborn to past the oldest, one at a time
+    bool agree = true;
+    int oldest_age = ages.empty() ? 0 : ages.front();
+    for (int age=0; age<=oldest_age+1; age++)
+    {
+        int64_t older = 0;
+        int64_t same = 0;
+        for (size_t i=0; i<ages.size(); i++)
+        {
+            older += ages[i] > age ? 1 : 0;
+            same += ages[i] == age ? 1 : 0;
+        }
+        agree = agree && zoo.countOlderThan(type, age) == older
+                && zoo.countInAgeRange(type, age, age) == same
+                && zoo.countInAgeRange(type, 0, age) == count - older;
+    }
+    agree = agree && zoo.countAdults(type) == zoo.countOlderThan(type,
+                                                            ADULT_AGE - 1);
+
+    AnimalRecord oldest;
+    AnimalRecord youngest;
+    if (ages.empty())
+    {
+        agree = agree && !zoo.findOldest(type, oldest)
+                && !zoo.findYoungest(type, youngest);
+    }
+    else
+    {
+        agree = agree && zoo.findOldest(type, oldest)
+                && zoo.findYoungest(type, youngest)
+                && oldest.getAge() == ages.front()
+                && youngest.getAge() == ages.back();
+    }
+    check(agree, "age queries count every animal " + when);
+}
+
+
+/********************************************************************
+** Function: getAges: Lists the ages of an exhibit's animals in the
+ *           order it keeps them, laying age cohorts out oldest first.
+** Params:   const Zoo &zoo: zoo to look in.
+ *           SpeciesId type: exhibit to list.
+** Returns:  vector<int>: one age per animal.
+*********************************************************************/
+vector<int> UnitTest::getAges(const Zoo &zoo, SpeciesId type) const
+{
+    vector<int> ages;
+    if (zoo.exhibit_count[type].cohorts)
+    {
+        const vector<Zoo::AgeCohort> &cohorts = zoo.age_cohorts[type];
+        for (size_t c=0; c<cohorts.size(); c++)
+        {
+            ages.insert(ages.end(), cohorts[c].count, cohorts[c].age);
+        }
+    }
+    else
+    {
+        for (int64_t i=0; i<zoo.exhibit_count[type].count; i++)
+        {
+            ages.push_back(zoo.animal_exhibits[type][i].getAge());
+        }
+    }
+    return ages;
+}
+
+
+/********************************************************************
+** Function: runRecordingAges: Runs a headless zoo one day at a time,
+ *           as simulate does, listing the ages of every exhibit after
+ *           each day, and whether it is kept as age cohorts.
+** Params:   Zoo &zoo: new headless zoo to run.
+ *           int horizon: days to run.
+ *           vector<vector<int> > &ages: set to one list of ages per
+ *              day and exhibit, day by day.
+ *           vector<bool> &cohorts: set to one flag per day and
+ *              exhibit, in the same order.
+** Returns:  None
+*********************************************************************/
+void UnitTest::runRecordingAges(Zoo &zoo, int horizon,
+                                    vector<vector<int> > &ages,
+                                    vector<bool> &cohorts) const
+{
+    //buys the policy's starting animals without running a day
+    zoo.simulate(0);
+    zoo.horizon = horizon;
+
+    while (!zoo.exit_status)
+    {
+        zoo.day_counter++;
+        zoo.beginningOfDay();
+        zoo.midday();
+        zoo.endOfDay();
+
+        for (int i=0; i<zoo.num_exhibits; i++)
+        {
+            ages.push_back(getAges(zoo, i));
+            cohorts.push_back(zoo.exhibit_count[i].cohorts);
+        }
+    }
+}
+
+
+/********************************************************************
+** Function: check: Counts a check, printing it if it failed.
+** Params:   bool passed: true if the check passed.
+ *           const string &what: what was checked.
+** Returns:  None
+*********************************************************************/
+void UnitTest::check(bool passed, const string &what)
+{
+    checks++;
+    if (!passed)
+    {
+        failures++;
+        cout << "FAILED: " << what << endl;
+    }
+}
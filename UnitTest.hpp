@@ -0,0 +1,216 @@
+/*********************************************************************
+** Program name: UnitTest.hpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 11:30 AM
+** Description: Class specification file for UnitTest class. A
+ *              UnitTest runs behavior checks that a game played by
+ *              hand would not notice breaking: which inputs
+ *              ValidateInput::parseInteger accepts, exact sums of
+ *              squares, the limits of a packed animal record, that
+ *              Animal and its species wrap the same records and
+ *              traits the Zoo stores, that the Zoo's per-exhibit
+ *              daily passes add up to what each animal costs and
+ *              earns, how animal handles are given out and
+ *              invalidated, and that exhibits stay in age order,
+ *              also as age cohorts.
+ *              Each check that fails is printed and
+ *              counted, built and run by make test.
+*********************************************************************/
+
+
+#ifndef UNIT_TEST_HPP
+#define UNIT_TEST_HPP
+
+#include "AnimalConstants.hpp"
+#include <string>
+#include <vector>
+
+class Zoo;
+
+class UnitTest
+{
+private:
+    int checks;         //checks run so far
+    int failures;       //checks that failed
+
+public:
+
+    /********************************************************************
+    ** Function: Constructor/default: Sets up a test run with no checks
+     *           run yet.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    UnitTest();
+
+
+    /********************************************************************
+    ** Function: run: Runs every check, printing the ones that fail,
+     *           then a line with the totals.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void run();
+
+
+    /********************************************************************
+    ** Function: getFailureCount: Returns how many checks failed.
+    ** Params:   None
+    ** Returns:  int: failed checks, 0 if every check passed.
+    *********************************************************************/
+    int getFailureCount() const;
+
+private:
+
+    /********************************************************************
+    ** Function: testParseInteger: Checks which strings parseInteger
+     *           accepts and what it parses them to: an optional sign,
+     *           then digits only, within the range of int.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void testParseInteger();
+
+
+    /********************************************************************
+    ** Function: testSquareSums: Checks that CheckedMath::addSquare
+     *           keeps sums of squared cents exact in 128 bits, as sweeps
+     *           add up final bank accounts, and clamps past them.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void testSquareSums();
+
+
+    /********************************************************************
+    ** Function: testRecordLimits: Checks that a record holds its age at
+     *           AnimalRecord::MAX_AGE, and that the species registry
+     *           refuses new traits once its IDs no longer fit a record.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void testRecordLimits();
+
+
+    /********************************************************************
+    ** Function: testAnimalWrappers: Checks that Tiger, Penguin, Turtle,
+     *           and CustomAnimal hold the record a Zoo would store for
+     *           them, and answer the Animal class API from their species'
+     *           registry entry, as they did before records replaced them.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void testAnimalWrappers();
+
+
+    /********************************************************************
+    ** Function: testDailyPassTotals: Checks that feeding the zoo and
+     *           collecting its profits, which look traits up once per
+     *           exhibit or sub-exhibit, move the bank by exactly the
+     *           sum over every animal, for each feed type.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void testDailyPassTotals();
+
+
+    /********************************************************************
+    ** Function: testHandles: Checks that animals only get a handle when
+     *           one is asked for, that handles follow animals as their
+     *           exhibit is reordered, stop finding animals that die even
+     *           once their slot is reused, and all stop when the exhibit
+     *           switches to age cohorts.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void testHandles();
+
+
+    /********************************************************************
+    ** Function: testAgeOrder: Checks that an exhibit stays oldest first,
+     *           and its age queries agree with counting every animal,
+     *           after animals are bought, born, age, and die, and after
+     *           it switches to age cohorts and back.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void testAgeOrder();
+
+
+    /********************************************************************
+    ** Function: testCohortSwitching: Checks that exhibits switch to age
+     *           cohorts once they hold more than the cohort threshold,
+     *           and back below half of it, in the middle of a run, and
+     *           that the run keeps the same animals of the same ages
+     *           every day as one that never switches. Also checks that
+     *           removing an animal from age cohorts by index picks the
+     *           age it would have laid out oldest first.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void testCohortSwitching();
+
+
+    /********************************************************************
+    ** Function: checkParse: Checks that parseInteger accepts input and
+     *           parses it to expected, or rejects it, leaving the
+     *           output alone.
+    ** Params:   const string &input: text to parse.
+     *           bool valid: true if input should be accepted.
+     *           int expected: value it should parse to, if valid.
+    ** Returns:  None
+    *********************************************************************/
+    void checkParse(const std::string &input, bool valid, int expected = 0);
+
+
+    /********************************************************************
+    ** Function: checkAgeOrder: Checks that an exhibit's ages never rise
+     *           from its oldest animal to its youngest, and that
+     *           countAdults, countOlderThan, countInAgeRange, findOldest,
+     *           and findYoungest agree with counting its ages one by one.
+    ** Params:   const Zoo &zoo: zoo to check.
+     *           SpeciesId type: registered species' exhibit to check.
+     *           const string &when: what just happened to the exhibit.
+    ** Returns:  None
+    *********************************************************************/
+    void checkAgeOrder(const Zoo &zoo, SpeciesId type,
+                        const std::string &when);
+
+
+    /********************************************************************
+    ** Function: getAges: Lists the ages of an exhibit's animals in the
+     *           order it keeps them, laying age cohorts out oldest first.
+    ** Params:   const Zoo &zoo: zoo to look in.
+     *           SpeciesId type: exhibit to list.
+    ** Returns:  vector<int>: one age per animal.
+    *********************************************************************/
+    std::vector<int> getAges(const Zoo &zoo, SpeciesId type) const;
+
+
+    /********************************************************************
+    ** Function: runRecordingAges: Runs a headless zoo one day at a time,
+     *           as simulate does, listing the ages of every exhibit after
+     *           each day, and whether it is kept as age cohorts.
+    ** Params:   Zoo &zoo: new headless zoo to run.
+     *           int horizon: days to run.
+     *           vector<vector<int> > &ages: set to one list of ages per
+     *              day and exhibit, day by day.
+     *           vector<bool> &cohorts: set to one flag per day and
+     *              exhibit, in the same order.
+    ** Returns:  None
+    *********************************************************************/
+    void runRecordingAges(Zoo &zoo, int horizon,
+                            std::vector<std::vector<int> > &ages,
+                            std::vector<bool> &cohorts) const;
+
+
+    /********************************************************************
+    ** Function: check: Counts a check, printing it if it failed.
+    ** Params:   bool passed: true if the check passed.
+     *           const string &what: what was checked.
+    ** Returns:  None
+    *********************************************************************/
+    void check(bool passed, const std::string &what);
+};
+
+#endif
@@ -11,16 +11,19 @@
  *              input arguments.
  *              Currently only supports integer validation,
  *              others will be added eventually.
+ *              Each prompt shown and input accepted is reported to
+ *              ResponseTimer, to time how long commands take.
 *********************************************************************/
 
 
 #include "ValidateInput.hpp"
+#include "AllocationTracker.hpp"
+#include "ResponseTimer.hpp"
 
 using std::cout;
 using std::cin;
 using std::flush;
 using std::endl;
-using std::stringstream;
 using std::string;
 
 /********************************************************************
@@ -31,6 +34,8 @@ using std::string;
 *********************************************************************/
 int ValidateInput::validateInteger()
 {
+    AllocationTracker::Scope source(AllocationTracker::VALIDATE_INPUT);
+
     //Initialize with lowest possible int
     int out_num = std::numeric_limits<int>::min();
     string input;
@@ -40,20 +45,12 @@ int ValidateInput::validateInteger()
     {
         valid = true;      //Reset valid flag to true
         cout << "Enter an integer: " << flush;
+        ResponseTimer::promptShown();
 
         if (getline(cin, input))
         {
-            //Put input into a string stream and attempt to
-            // insert into an int variable
-            stringstream ss(input);
-            ss >> std::noskipws >> out_num;
-
-            //If anything remains in the string stream,
-            // then validation failed
-            if (!ss.eof())
-            {
-                valid = false;
-            }
+            //Parse the whole line as an int, anything else fails
+            valid = parseInteger(input, out_num);
         }
         else
         {
@@ -65,6 +62,7 @@ int ValidateInput::validateInteger()
 
     } while (!valid);
 
+    ResponseTimer::inputAccepted();
     return out_num;
 }
 
@@ -79,6 +77,8 @@ int ValidateInput::validateInteger()
 *********************************************************************/
 int ValidateInput::validateInteger(int range_start, int range_end)
 {
+    AllocationTracker::Scope source(AllocationTracker::VALIDATE_INPUT);
+
     //Initialize with lowest possible int
     int out_num = std::numeric_limits<int>::min();
     string input;
@@ -89,20 +89,12 @@ int ValidateInput::validateInteger(int range_start, int range_end)
         valid = true;       //Reset valid flag to true
         cout << "Enter a number between "
             << range_start << " and " << range_end << ": " << flush;
+        ResponseTimer::promptShown();
 
         if (getline(cin, input))
         {
-            //Put input into a string stream and attempt to
-            // insert into an int variable
-            stringstream ss(input);
-            ss >> std::noskipws >> out_num;
-
-            //If anything remains in the string stream,
-            // then validation failed
-            if (!ss.eof())
-            {
-                valid = false;
-            }
+            //Parse the whole line as an int, anything else fails
+            valid = parseInteger(input, out_num);
         }
         else
         {
@@ -114,6 +106,7 @@ int ValidateInput::validateInteger(int range_start, int range_end)
 
     } while (!valid || out_num < range_start || out_num > range_end);
 
+    ResponseTimer::inputAccepted();
     return out_num;
 }
 
@@ -128,44 +121,34 @@ int ValidateInput::validateInteger(int range_start, int range_end)
 *********************************************************************/
 int ValidateInput::validateInteger(const int * choices, int size)
 {
+    AllocationTracker::Scope source(AllocationTracker::VALIDATE_INPUT);
+
     //Initialize with lowest possible int
     int out_num = std::numeric_limits<int>::min();
     string input;
     bool valid;             //Check for valid input type
     bool matched;           //Check if valid selection
+    int choice_base;        //Smallest choice, bit 0 of choice_mask
+    unsigned long long choice_mask = makeChoiceMask(choices, size,
+                                                    choice_base);
 
     do
     {
         valid = true;       //Reset valid flag to true
         matched = false;    //Reset matched flag to false
         cout << "Enter an integer: " << flush;
+        ResponseTimer::promptShown();
 
         if (getline(cin, input))
         {
-            //Put input into a string stream and attempt to
-            // insert into an int variable
-            stringstream ss(input);
-            ss >> std::noskipws >> out_num;
-
-            //If anything remains in the string stream,
-            // then validation failed
-            if (!ss.eof())
-            {
-                valid = false;
-            }
+            //Parse the whole line as an int, anything else fails
+            valid = parseInteger(input, out_num);
 
             //Check if input matches with valid choices
             if (valid)
             {
-                //Loop to compare valid choices with user input
-                for (int i=0; i<size; i++)
-                {
-                    if (choices[i] == out_num)
-                    {
-                        matched = true;
-                        i = size;   //To break out of for loop
-                    }
-                }
+                matched = isChoice(choice_mask, choice_base, choices, size,
+                                   out_num);
 
                 //Loop to inform user of valid choices
                 if (!matched)
@@ -195,5 +178,148 @@ int ValidateInput::validateInteger(const int * choices, int size)
 
     } while (!valid || !matched);
 
+    ResponseTimer::inputAccepted();
     return out_num;
-}
\ No newline at end of file
+}
+
+/********************************************************************
+** Function: parseInteger: parses a whole string as a base 10 int
+ *           without allocating. Follows the same rules as reading
+ *           with noskipws from a stringstream: an optional leading
+ *           '+' or '-', then digits only. Leading whitespace,
+ *           trailing characters, an empty string, and values out of
+ *           range of int are all rejected.
+** Params:   const string &input: text to parse.
+ *           int &out_num: set to the parsed value on success.
+** Returns:  bool: true if input was a valid integer, false otherwise.
+*********************************************************************/
+bool ValidateInput::parseInteger(const string &input, int &out_num)
+{
+    const char *pos = input.data();
+    const char *end = pos + input.size();
+    bool negative = false;
+
+    //Optional sign
+    if (pos != end && (*pos == '-' || *pos == '+'))
+    {
+        negative = (*pos == '-');
+        pos++;
+    }
+
+    //Need at least one digit
+    if (pos == end)
+    {
+        return false;
+    }
+
+    //Accumulate as a negative number so INT_MIN fits
+    const int limit = std::numeric_limits<int>::min();
+    int value = 0;
+    for (; pos != end; pos++)
+    {
+        if (*pos < '0' || *pos > '9')
+        {
+            return false;       //Trailing junk or non-digit
+        }
+
+        int digit = *pos - '0';
+        if (value < (limit + digit) / 10)
+        {
+            return false;       //Would overflow
+        }
+        value = value * 10 - digit;
+    }
+
+    if (!negative)
+    {
+        if (value == limit)
+        {
+            return false;       //-INT_MIN does not fit in an int
+        }
+        value = -value;
+    }
+
+    out_num = value;
+    return true;
+}
+
+
+/********************************************************************
+** Function: makeChoiceMask: builds a bit mask of valid choices so
+ *           that a choice can be checked in constant time. Bit i is
+ *           set if (choice_base + i) is a valid choice. Only works
+ *           when all choices are within 64 of the smallest choice.
+** Params:   const int * choices: pointer to array of valid choices
+ *           int size: size of array
+ *           int &choice_base: set to the smallest choice
+** Returns:  unsigned long long: the mask, or 0 if choices are too
+ *           spread out (or empty) to fit in one.
+*********************************************************************/
+unsigned long long ValidateInput::makeChoiceMask(const int * choices,
+                                                 int size, int &choice_base)
+{
+    const long long MASK_BITS = 64;
+    unsigned long long mask = 0;
+
+    choice_base = 0;
+    if (size < 1)
+    {
+        return mask;
+    }
+
+    //Find the smallest and largest choice
+    int lowest = choices[0];
+    int highest = choices[0];
+    for (int i=1; i<size; i++)
+    {
+        lowest = std::min(lowest, choices[i]);
+        highest = std::max(highest, choices[i]);
+    }
+
+    if (static_cast<long long>(highest) - lowest >= MASK_BITS)
+    {
+        return mask;
+    }
+
+    choice_base = lowest;
+    for (int i=0; i<size; i++)
+    {
+        mask |= 1ULL << (choices[i] - lowest);
+    }
+
+    return mask;
+}
+
+
+/********************************************************************
+** Function: isChoice: checks if a number is one of the valid choices.
+ *           Uses the mask from makeChoiceMask when there is one,
+ *           otherwise falls back to comparing against each choice.
+** Params:   unsigned long long mask: mask from makeChoiceMask
+ *           int choice_base: smallest choice from makeChoiceMask
+ *           const int * choices: pointer to array of valid choices
+ *           int size: size of array
+ *           int num: number to check
+** Returns:  bool: true if num is a valid choice, false otherwise.
+*********************************************************************/
+bool ValidateInput::isChoice(unsigned long long mask, int choice_base,
+                             const int * choices, int size, int num)
+{
+    const long long MASK_BITS = 64;
+
+    if (mask != 0)
+    {
+        long long offset = static_cast<long long>(num) - choice_base;
+        return offset >= 0 && offset < MASK_BITS && ((mask >> offset) & 1ULL);
+    }
+
+    //Choices too spread out for a mask
+    for (int i=0; i<size; i++)
+    {
+        if (choices[i] == num)
+        {
+            return true;
+        }
+    }
+    return false;
+}
@@ -11,6 +11,8 @@
  *              input arguments.
  *              Currently only supports integer validation,
  *              others will be added eventually.
+ *              Each prompt shown and input accepted is reported to
+ *              ResponseTimer, to time how long commands take.
 *********************************************************************/
 
 
@@ -18,9 +20,9 @@
 #define VALIDATE_INPUT_HPP
 
 #include <iostream>
-#include <sstream>
 #include <string>
 #include <limits>
+#include <algorithm>
 
 class ValidateInput
 {
@@ -55,6 +57,45 @@ public:
     ** Returns:  int: valid user integer input
     *********************************************************************/
     static int validateInteger(const int *, int size);
+
+
+    /********************************************************************
+    ** Function: parseInteger: parses a whole string as a base 10 int
+     *           without allocating. Optional leading sign, then digits
+     *           only. Rejects whitespace, trailing characters, empty
+     *           strings, and values out of range of int.
+    ** Params:   const string &input: text to parse.
+     *           int &out_num: set to the parsed value on success.
+    ** Returns:  bool: true if input was a valid integer, false otherwise.
+    *********************************************************************/
+    static bool parseInteger(const std::string &input, int &out_num);
+
+private:
+
+    /********************************************************************
+    ** Function: makeChoiceMask: builds a bit mask of valid choices for
+     *           constant time lookups. Bit i is set if
+     *           (choice_base + i) is a valid choice.
+    ** Params:   const int * choices: pointer to array of valid choices
+     *           int size: size of array
+     *           int &choice_base: set to the smallest choice
+    ** Returns:  unsigned long long: the mask, or 0 if choices do not fit.
+    *********************************************************************/
+    static unsigned long long makeChoiceMask(const int *, int size,
+                                             int &choice_base);
+
+
+    /********************************************************************
+    ** Function: isChoice: checks if a number is one of the valid choices.
+    ** Params:   unsigned long long mask: mask from makeChoiceMask
+     *           int choice_base: smallest choice from makeChoiceMask
+     *           const int * choices: pointer to array of valid choices
+     *           int size: size of array
+     *           int num: number to check
+    ** Returns:  bool: true if num is a valid choice, false otherwise.
+    *********************************************************************/
+    static bool isChoice(unsigned long long mask, int choice_base,
+                         const int *, int size, int num);
 };
 
 #endif
\ No newline at end of file
@@ -21,6 +21,10 @@
 
 
 #include "Zoo.hpp"
+#include "CheckedMath.hpp"
+#include <algorithm>
+#include <fcntl.h>
+#include <unistd.h>
 
 using std::cout;
 using std::cin;
@@ -30,12 +34,15 @@ using std::vector;
 
 //Initialize constants
 const int Zoo::START_EXHIBIT_SIZE = 10;
+const int Zoo::EXHIBIT_GROWTH_FACTOR = 2;
 const int Zoo::START_BANK_ACCOUNT = 100000;
 const int Zoo::FEED_MULTIPLIER_SIZE = 3;
 const double Zoo::CHEAP_MULTIPLIER = 0.5;
 const double Zoo::GENERIC_MULTIPLIER = 1.0;
 const double Zoo::PREMIUM_MULTIPLIER = 2.0;
 const std::string Zoo::EVENT_FILE = "event_file.txt";
+const Zoo::Policy Zoo::DEFAULT_POLICY = {GENERIC, 1, 1, 1, -1, 0};
+const int Zoo::COHORT_THRESHOLD_DEFAULT = 100000;
 
 /********************************************************************
 ** Function: Constructor/default: Seeds the random number generator,
@@ -46,12 +53,59 @@ const std::string Zoo::EVENT_FILE = "event_file.txt";
 ** Params:  None
 ** Returns: None
 *********************************************************************/
-Zoo::Zoo() : bank_account(START_BANK_ACCOUNT), tiger_bonus(ZERO),
-                exit_status(false), todays_feed_type(GENERIC)
+Zoo::Zoo() : bank_account(Money::fromDollars(START_BANK_ACCOUNT)),
+                overflowed(false), exit_status(false),
+                todays_feed_type(GENERIC), day_counter(ZERO),
+                headless(false), policy(DEFAULT_POLICY),
+                horizon(ZERO), exit_reason(QUIT), autosaver(nullptr)
 {
+    exhibit_arenas = nullptr;
+
     //Seed random number generator
     MyRandom::seed();
 
+    initialize();
+}
+
+
+/********************************************************************
+** Function: Constructor: Headless zoo. Seeds the random number
+ *          generator with the_seed so runs can be repeated, and
+ *          answers all prompts from the policy instead of asking
+ *          the user. Nothing is printed or written to file.
+** Params:  const Policy &policy: automatic answers to prompts.
+ *          unsigned int the_seed: seed for the random generator.
+** Returns: None
+*********************************************************************/
+Zoo::Zoo(const Policy &policy, unsigned int the_seed)
+        : bank_account(Money::fromDollars(START_BANK_ACCOUNT)),
+            overflowed(false), exit_status(false),
+            todays_feed_type(policy.feed_type), day_counter(ZERO),
+            headless(true), policy(policy),
+            horizon(ZERO), exit_reason(QUIT), autosaver(nullptr)
+{
+    exhibit_arenas = nullptr;
+
+    //Seed random number generator so the run is repeatable
+    MyRandom::seed(the_seed);
+
+    initialize();
+}
+
+
+/********************************************************************
+** Function: initialize: Shared constructor setup. Initializes
+ *          feed_multiplier_lookup, food_cost_multiplier,
+ *          animal_exhibits, and exhibit_count, with one exhibit for
+ *          every registered species.
+** Params:  None
+** Returns: None
+*********************************************************************/
+void Zoo::initialize()
+{
+    num_exhibits = SpeciesRegistry::size();
+    exhibits_checked.assign(num_exhibits, false);
+
     //Initialize feed_multiplier_lookup array
     feed_multiplier_lookup = new double[FEED_MULTIPLIER_SIZE]
             {CHEAP_MULTIPLIER, GENERIC_MULTIPLIER, PREMIUM_MULTIPLIER};
@@ -60,25 +114,25 @@ Zoo::Zoo() : bank_account(START_BANK_ACCOUNT), tiger_bonus(ZERO),
     changeFoodCostMultiplier(todays_feed_type);
 
     //Create all the animal exhibit arrays of size START_EXHIBIT_SIZE
-    animal_exhibits = new Animal**[EXHIBITS_SIZE];
-    for (int i=ZERO; i<EXHIBITS_SIZE; i++)
+    animal_exhibits = new AnimalRecord*[num_exhibits];
+    for (int i=ZERO; i<num_exhibits; i++)
     {
-        animal_exhibits[i] = new Animal*[START_EXHIBIT_SIZE];
-
-        //Point the pointers to nullptr
-        for (int k=ZERO; k<START_EXHIBIT_SIZE; k++)
-        {
-            animal_exhibits[i][k] = nullptr;
-        }
+        animal_exhibits[i] = new AnimalRecord[START_EXHIBIT_SIZE];
     }
 
+    //No animals yet, so no handles and no age cohorts
+    animal_slots.assign(num_exhibits, vector<uint32_t>());
+    age_cohorts.assign(num_exhibits, vector<AgeCohort>());
+    cohort_threshold = COHORT_THRESHOLD_DEFAULT;
+
     //Set up exhibit_count array to starting values,
     // all animal counts = 0, capacity = START_EXHIBIT_SIZE = 10
-    exhibit_count = new Exhibit[EXHIBITS_SIZE];
-    for (int i=ZERO; i<EXHIBITS_SIZE; i++)
+    exhibit_count = new Exhibit[num_exhibits];
+    for (int i=ZERO; i<num_exhibits; i++)
     {
         exhibit_count[i].capacity = START_EXHIBIT_SIZE;
         exhibit_count[i].count = ZERO;
+        exhibit_count[i].cohorts = false;
     }
 }
 
@@ -92,15 +146,13 @@ Zoo::Zoo() : bank_account(START_BANK_ACCOUNT), tiger_bonus(ZERO),
 *********************************************************************/
 Zoo::~Zoo()
 {
-    //Delete all animal exhibits
-    for (int i=ZERO, p=EXHIBITS_SIZE; i<p; i++)
+    //Delete all animal exhibits, mapped ones go with their arena
+    for (int i=ZERO, p=num_exhibits; i<p; i++)
     {
-        for (int k=ZERO, j=exhibit_count[i].count; k<j; k++)
+        if (!isMapped(i))
         {
-            delete animal_exhibits[i][k];
-            animal_exhibits[i][k] = nullptr;
+            delete [] animal_exhibits[i];
         }
-        delete [] animal_exhibits[i];
         animal_exhibits[i] = nullptr;
     }
     delete [] animal_exhibits;
@@ -110,6 +162,18 @@ Zoo::~Zoo()
     delete [] exhibit_count;
     exhibit_count = nullptr;
 
+    //Delete mapped arenas now that nothing points into them
+    if (exhibit_arenas)
+    {
+        for (int i=ZERO; i<num_exhibits; i++)
+        {
+            delete exhibit_arenas[i];
+            exhibit_arenas[i] = nullptr;
+        }
+        delete [] exhibit_arenas;
+        exhibit_arenas = nullptr;
+    }
+
     //Delete feed_multiplier_lookup array
     delete [] feed_multiplier_lookup;
     feed_multiplier_lookup = nullptr;
@@ -208,21 +272,733 @@ void Zoo::runTycoon()
     //initialize day counter
     day_counter = 0;
     const string FAREWELL_MSG = "Goodbye!";
+    const string OVERFLOW_MSG = "Note: the zoo outgrew 64-bit totals, "
+            "so its counts and bank account stopped at their limits.";
     while (!exit_status)
     {
         day_counter++;
+        //outside the phases, so recording the day's spans does not
+        // allocate in them
+        Tracer::reserveDay();
+        Tracer::Scope day_span("day", *this);
 
         //print day number
-        string day_string = "Day # " + std::to_string(day_counter);
-        menu.formatPrompt(day_string);
+        if (!headless)
+        {
+            PhaseTimer::Scope timer(PhaseTimer::DAY_HEADER);
+            string day_string = "Day # " + std::to_string(day_counter);
+            menu.formatPrompt(day_string);
+        }
 
         //the day beings
         beginningOfDay();
         midday();
         endOfDay();
+
+        if (autosaver)
+        {
+            PhaseTimer::Scope timer(PhaseTimer::AUTOSAVE);
+            Tracer::Scope span("autosave", *this);
+            autosaver->dayEnded(*this, day_counter);
+        }
+
+        //counting the population costs a pass over the exhibits
+        if (headless && ProgressReporter::isRunning())
+        {
+            ProgressReporter::dayEnded(day_counter, getPopulation());
+        }
+
+        //print phase times if SIGUSR1 asked for them today
+        PhaseTimer::dumpIfRequested();
+        AllocationTracker::dayEnded();
+    }
+
+    if (!headless)
+    {
+        if (hasOverflowed())
+        {
+            cout << endl << OVERFLOW_MSG;
+        }
+        cout << endl << endl << FAREWELL_MSG << endl << endl;
+    }
+}
+
+
+/********************************************************************
+** Function: simulate: Driver function for headless zoos. Buys the
+ *              policy's starting animals, then runs days until the
+ *              zoo goes bankrupt or the horizon is reached.
+** Params:  int horizon: maximum number of days to run.
+** Returns: Outcome: summary of how the run ended.
+*********************************************************************/
+Zoo::Outcome Zoo::simulate(int horizon)
+{
+    const int START_AGE = 1;
+    const int START_COUNTS[] = {policy.start_tigers,
+                                policy.start_penguins,
+                                policy.start_turtles};
+    const SpeciesId START_TYPES[] = {TIGER, PENGUIN, TURTLE};
+    const int START_TYPES_SIZE = 3;
+
+    this->horizon = horizon;
+
+    //buy starting animals
+    for (int i=ZERO; i<START_TYPES_SIZE; i++)
+    {
+        for (int k=ZERO; k<START_COUNTS[i]; k++)
+        {
+            addAnimal(START_TYPES[i], START_AGE);
+        }
+    }
+
+    //run until bankrupt or out of days
+    if (horizon > ZERO)
+    {
+        runTycoon();
+    }
+
+    Outcome outcome;
+    outcome.days = day_counter;
+    outcome.bankrupt = exit_status && exit_reason == BANKRUPT;
+    outcome.bank_account = bank_account;
+    outcome.population = getPopulation();
+    outcome.overflowed = hasOverflowed();
+    return outcome;
+}
+
+
+/********************************************************************
+** Function: describePolicy: Formats every field of a policy on one
+ *              line, separated by spaces.
+** Params:  const Policy &policy: policy to describe.
+** Returns: string: the formatted policy.
+*********************************************************************/
+string Zoo::describePolicy(const Policy &policy)
+{
+    std::ostringstream description;
+    description << policy.feed_type << " " << policy.start_tigers << " "
+            << policy.start_penguins << " " << policy.start_turtles << " "
+            << policy.buy_type << " " << policy.buy_min_bank;
+    return description.str();
+}
+
+
+/********************************************************************
+** Function: describeConstants: Formats every game constant that
+ *              can change the outcome of a run: every registered
+ *              species, starting bank account, and feed multipliers.
+ *              Two builds with the same string play out the same
+ *              seed and policy the same way.
+** Params:  None
+** Returns: string: the formatted constants.
+*********************************************************************/
+string Zoo::describeConstants()
+{
+    const int DOUBLE_DIGITS = 17;    //enough to round trip a double
+
+    std::ostringstream description;
+    description << std::setprecision(DOUBLE_DIGITS);
+
+    for (int i=ZERO, k=SpeciesRegistry::size(); i<k; i++)
+    {
+        const SpeciesRegistry::Species &species = SpeciesRegistry::get(i);
+        description << species.name << " " << species.cost << " "
+                << species.num_babies << " " << species.feeding_cost << " "
+                << species.payoff << ";";
+    }
+
+    description << START_BANK_ACCOUNT
+            << " " << CHEAP_MULTIPLIER << " " << GENERIC_MULTIPLIER
+            << " " << PREMIUM_MULTIPLIER;
+    return description.str();
+}
+
+
+/********************************************************************
+** Function: setAutosaver: Has autosaver save this zoo at the end
+ *              of every day it chooses to. The zoo does not own it.
+** Params:  Autosaver *autosaver: autosaver to use, or nullptr.
+** Returns: None
+*********************************************************************/
+void Zoo::setAutosaver(Autosaver *autosaver)
+{
+    this->autosaver = autosaver;
+}
+
+
+/********************************************************************
+** Function: setCohortThreshold: Sets how many animals a registered
+ *              species' exhibit can hold before it is kept as age
+ *              cohorts instead. It goes back to single animals
+ *              below half as many. Outcomes are the same either way.
+** Params:  int animals: exhibit size to switch above.
+** Returns: None
+*********************************************************************/
+void Zoo::setCohortThreshold(int animals)
+{
+    cohort_threshold = animals;
+
+    for (int i=ZERO; i<num_exhibits; i++)
+    {
+        adaptExhibit(i);
+    }
+}
+
+
+/********************************************************************
+** Function: saveSnapshot: Writes the day, bank account, and every
+ *              animal in every exhibit to a file. New animals'
+ *              traits are written once per sub-exhibit. Standard animals
+ *              are saved as their age, custom animals also save
+ *              their name and traits. Exhibits kept as age cohorts
+ *              save one line per cohort.
+** Params:  const string &path: file to write.
+** Returns: long long: number of bytes written, or -1 on failure.
+*********************************************************************/
+long long Zoo::saveSnapshot(const std::string &path) const
+{
+    const mode_t SNAPSHOT_MODE = 0644;
+
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, SNAPSHOT_MODE);
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    SnapshotWriter snapshot;
+    snapshot.start(fd);
+    writeSnapshot(snapshot);
+    long long bytes = snapshot.finish();
+
+    return close(fd) == 0 ? bytes : -1;
+}
+
+
+/********************************************************************
+** Function: writeSnapshot: Writes what saveSnapshot saves with a
+ *              snapshot writer, without allocating, so a forked
+ *              child can write its copy of the zoo.
+** Params:  SnapshotWriter &snapshot: writer already started.
+** Returns: None
+*********************************************************************/
+void Zoo::writeSnapshot(SnapshotWriter &snapshot) const
+{
+    snapshot << "zoo-snapshot 3" << '\n';
+    snapshot << "day " << day_counter << '\n';
+    snapshot << "bank " << bank_account << '\n';
+
+    for (int i=ZERO; i<num_exhibits; i++)
+    {
+        snapshot << "exhibit " << i << " " << exhibit_count[i].count << '\n';
+
+        //new animals' traits are written once per sub-exhibit
+        for (size_t g=ZERO; SpeciesRegistry::get(i).custom
+                                && g<custom_groups.size(); g++)
+        {
+            const SpeciesRegistry::Species &traits =
+                    SpeciesRegistry::get(custom_groups[g].species);
+            snapshot << "group " << custom_groups[g].count << " "
+                    << traits.cost << " " << traits.num_babies << " "
+                    << traits.feeding_cost << " " << traits.payoff << " "
+                    << traits.name << '\n';
+        }
+
+        for (size_t c=ZERO; c<age_cohorts[i].size(); c++)
+        {
+            snapshot << "cohort " << age_cohorts[i][c].age << " "
+                    << age_cohorts[i][c].count << '\n';
+        }
+
+        for (int64_t k=ZERO, p=exhibit_count[i].count;
+                !exhibit_count[i].cohorts && k<p; k++)
+        {
+            snapshot << animal_exhibits[i][k].getAge() << '\n';
+        }
+    }
+}
+
+
+/********************************************************************
+** Function: enableOutOfCore: Stores exhibits in memory-mapped files
+ *              in directory instead of on the heap, one file per
+ *              exhibit, so the zoo can grow past physical memory.
+ *              Must be called before any animals are added.
+** Params:  const string &directory: directory for exhibit files.
+** Returns: bool: true if every exhibit file was mapped.
+*********************************************************************/
+bool Zoo::enableOutOfCore(const std::string &directory)
+{
+    if (exhibit_arenas || getPopulation() > ZERO)
+    {
+        return false;
+    }
+
+    exhibit_arenas = new MappedArena*[num_exhibits];
+    bool mapped = true;
+
+    for (int i=ZERO; i<num_exhibits; i++)
+    {
+        string path = directory + "/exhibit_" + std::to_string(i) + ".bin";
+        exhibit_arenas[i] = new MappedArena(path);
+        mapped = mapped && exhibit_arenas[i]->grow(
+                    exhibit_count[i].capacity * sizeof(AnimalRecord));
+    }
+
+    //go back to the heap if any exhibit could not be mapped
+    if (!mapped)
+    {
+        for (int i=ZERO; i<num_exhibits; i++)
+        {
+            delete exhibit_arenas[i];
+            exhibit_arenas[i] = nullptr;
+        }
+        delete [] exhibit_arenas;
+        exhibit_arenas = nullptr;
+        return false;
+    }
+
+    //exhibits are empty, so their heap arrays are swapped, not copied
+    for (int i=ZERO; i<num_exhibits; i++)
+    {
+        delete [] animal_exhibits[i];
+        animal_exhibits[i] =
+                static_cast<AnimalRecord *>(exhibit_arenas[i]->getBase());
+    }
+
+    return true;
+}
+
+
+/********************************************************************
+** Function: isOutOfCore: Returns true if animals are stored in
+ *              memory-mapped files.
+** Params:  None
+** Returns: bool: true if out-of-core storage is enabled.
+*********************************************************************/
+bool Zoo::isOutOfCore() const
+{
+    return exhibit_arenas != nullptr;
+}
+
+
+/********************************************************************
+** Function: getBytesPerAnimal: Returns bytes of exhibit storage
+ *              and age cohorts, counting unused capacity, for each
+ *              animal in the zoo, and bytes of animal handles apart
+ *              from them.
+** Params:  None
+** Returns: BytesPerAnimal: storage bytes per animal, split by
+ *              what they are for, all 0 if there are no animals.
+*********************************************************************/
+Zoo::BytesPerAnimal Zoo::getBytesPerAnimal() const
+{
+    BytesPerAnimal bytes = {0, 0, 0, 0, 0};
+
+    int64_t population = getPopulation();
+    if (population == ZERO)
+    {
+        return bytes;
+    }
+
+    for (int i=ZERO; i<num_exhibits; i++)
+    {
+        ExhibitBytes exhibit = getExhibitBytes(i);
+        bytes.records += static_cast<double>(exhibit.animals);
+        bytes.unused += static_cast<double>(exhibit.unused);
+        bytes.index += static_cast<double>(exhibit.index);
+        bytes.handles += static_cast<double>(exhibit.slots);
+    }
+    bytes.handles += static_cast<double>(animal_handles.getBytes());
+
+    bytes.records /= population;
+    bytes.unused /= population;
+    bytes.index /= population;
+    bytes.handles /= population;
+    bytes.total = bytes.records + bytes.unused + bytes.index;
+    return bytes;
+}
+
+
+/********************************************************************
+** Function: printMemoryReport: Prints the bytes each exhibit
+ *              holds for animal records in use, unused capacity,
+ *              indexes, and species names, the zoo's shared
+ *              tables, and the process's resident memory now and
+ *              at its peak. Prints even for headless zoos.
+** Params:  std::ostream &out: stream to print to.
+** Returns: None
+*********************************************************************/
+void Zoo::printMemoryReport(std::ostream &out) const
+{
+    const int NAME_WIDTH = 16;
+    const int NUMBER_WIDTH = 12;
+    const int COLUMNS = 8;
+    const char *HEADINGS[COLUMNS] = {"count", "capacity", "animals",
+                                    "unused", "index", "strings",
+                                    "total", "B/animal"};
+
+    std::ios_base::fmtflags flags = out.flags();
+    std::streamsize precision = out.precision();
+
+    out << "Memory footprint (bytes"
+            << (isOutOfCore() ? ", animal records memory-mapped" : "")
+            << "):" << endl;
+    out << std::left << std::setw(NAME_WIDTH) << "exhibit" << std::right;
+    for (int c=ZERO; c<COLUMNS; c++)
+    {
+        out << std::setw(NUMBER_WIDTH) << HEADINGS[c];
+    }
+    out << endl;
+
+    out << std::fixed << std::setprecision(1);
+    ExhibitBytes sum = {ZERO, ZERO, ZERO, ZERO, ZERO};
+    for (int i=ZERO; i<num_exhibits; i++)
+    {
+        //the footprint counts handles' slot indexes as index
+        ExhibitBytes exhibit = getExhibitBytes(i);
+        exhibit.index += exhibit.slots;
+        int64_t total = exhibit.animals + exhibit.unused + exhibit.index
+                        + exhibit.strings;
+        sum.animals += exhibit.animals;
+        sum.unused += exhibit.unused;
+        sum.index += exhibit.index;
+        sum.strings += exhibit.strings;
+
+        //long names are cut short to keep the columns lined up
+        out << std::left << std::setw(NAME_WIDTH)
+                << SpeciesRegistry::get(i).name.substr(ZERO, NAME_WIDTH - 1)
+                << std::right
+                << std::setw(NUMBER_WIDTH) << exhibit_count[i].count
+                << std::setw(NUMBER_WIDTH) << exhibit_count[i].capacity
+                << std::setw(NUMBER_WIDTH) << exhibit.animals
+                << std::setw(NUMBER_WIDTH) << exhibit.unused
+                << std::setw(NUMBER_WIDTH) << exhibit.index
+                << std::setw(NUMBER_WIDTH) << exhibit.strings
+                << std::setw(NUMBER_WIDTH) << total
+                << std::setw(NUMBER_WIDTH);
+        if (exhibit_count[i].count > ZERO)
+        {
+            out << static_cast<double>(total) / exhibit_count[i].count;
+        }
+        else
+        {
+            out << "-";
+        }
+        out << endl;
+    }
+
+    //handles and the per-exhibit pointer and count arrays are shared
+    int64_t shared = static_cast<int64_t>(animal_handles.getBytes())
+            + num_exhibits * static_cast<int64_t>(sizeof(AnimalRecord *)
+                                                    + sizeof(Exhibit))
+            + static_cast<int64_t>(animal_slots.capacity()
+                                    * sizeof(std::vector<uint32_t>))
+            + static_cast<int64_t>(age_cohorts.capacity()
+                                    * sizeof(std::vector<AgeCohort>));
+    int64_t total = sum.animals + sum.unused + sum.index + sum.strings
+                    + shared;
+    int64_t population = getPopulation();
+
+    out << std::left << std::setw(NAME_WIDTH) << "shared tables"
+            << std::right << std::setw(NUMBER_WIDTH * (COLUMNS - 1))
+            << shared << endl;
+    out << std::left << std::setw(NAME_WIDTH) << "total" << std::right
+            << std::setw(NUMBER_WIDTH) << population
+            << std::setw(NUMBER_WIDTH) << ""
+            << std::setw(NUMBER_WIDTH) << sum.animals
+            << std::setw(NUMBER_WIDTH) << sum.unused
+            << std::setw(NUMBER_WIDTH) << sum.index
+            << std::setw(NUMBER_WIDTH) << sum.strings
+            << std::setw(NUMBER_WIDTH) << total
+            << std::setw(NUMBER_WIDTH);
+    if (population > ZERO)
+    {
+        out << static_cast<double>(total) / population;
+    }
+    else
+    {
+        out << "-";
+    }
+    out << endl;
+
+    out.flags(flags);
+    out.precision(precision);
+
+    MemoryUsage::print(out);
+}
+
+
+/********************************************************************
+** Function: printAgeReport: Prints how many animals each exhibit
+ *              holds, how many are young, adults, and over a year
+ *              old, and the ages of its youngest and oldest
+ *              animals, from the age queries below.
+** Params:  std::ostream &out: stream to print to.
+** Returns: None
+*********************************************************************/
+void Zoo::printAgeReport(std::ostream &out) const
+{
+    const int NAME_WIDTH = 16;
+    const int NUMBER_WIDTH = 12;
+    const int COLUMNS = 6;
+    const char *HEADINGS[COLUMNS] = {"count", "young", "adults",
+                                    "over 1 year", "youngest", "oldest"};
+    //one day short of AnimalRecord::isAdult
+    const int YOUNG_MAX_AGE = 2;
+    const int DAYS_PER_YEAR = 365;
+
+    out << "Ages (days):" << endl;
+    out << std::left << std::setw(NAME_WIDTH) << "exhibit" << std::right;
+    for (int c=ZERO; c<COLUMNS; c++)
+    {
+        out << std::setw(NUMBER_WIDTH) << HEADINGS[c];
+    }
+    out << endl;
+
+    for (int i=ZERO; i<num_exhibits; i++)
+    {
+        out << std::left << std::setw(NAME_WIDTH)
+                << SpeciesRegistry::get(i).name.substr(ZERO, NAME_WIDTH - 1)
+                << std::right
+                << std::setw(NUMBER_WIDTH) << exhibit_count[i].count
+                << std::setw(NUMBER_WIDTH)
+                << countInAgeRange(i, ZERO, YOUNG_MAX_AGE)
+                << std::setw(NUMBER_WIDTH) << countAdults(i)
+                << std::setw(NUMBER_WIDTH)
+                << countOlderThan(i, DAYS_PER_YEAR);
+
+        AnimalRecord youngest;
+        AnimalRecord oldest;
+        if (findYoungest(i, youngest) && findOldest(i, oldest))
+        {
+            out << std::setw(NUMBER_WIDTH) << youngest.getAge()
+                    << std::setw(NUMBER_WIDTH) << oldest.getAge();
+        }
+        else
+        {
+            out << std::setw(NUMBER_WIDTH) << "-"
+                    << std::setw(NUMBER_WIDTH) << "-";
+        }
+        out << endl;
+    }
+}
+
+
+/********************************************************************
+** Function: getHandle: Returns a stable handle to the animal at
+ *              index in an exhibit, oldest first for registered
+ *              species, giving it one the first time it is asked
+ *              for. Animals nobody asks about never cost a handle.
+ *              Switching the exhibit to age cohorts invalidates
+ *              every handle to its animals.
+** Params:  SpeciesId type: exhibit of the animal.
+ *          int64_t index: index of the animal in the exhibit.
+** Returns: SlotMap::Handle: handle to the animal, or NO_HANDLE if
+ *              there is no such animal or the exhibit is kept as
+ *              age cohorts.
+*********************************************************************/
+SlotMap::Handle Zoo::getHandle(SpeciesId type, int64_t index)
+{
+    if (type < ZERO || type >= num_exhibits || exhibit_count[type].cohorts
+            || index < ZERO || index >= exhibit_count[type].count)
+    {
+        return SlotMap::NO_HANDLE;
+    }
+
+    //the first handle in an exhibit starts its slot indexes
+    vector<uint32_t> &slots = animal_slots[type];
+    if (slots.empty())
+    {
+        slots.assign(exhibit_count[type].count, SlotMap::NO_HANDLE.index);
+    }
+
+    if (slots[index] == SlotMap::NO_HANDLE.index)
+    {
+        slots[index] = animal_handles.insert(type, index).index;
+    }
+    return animal_handles.getHandle(slots[index]);
+}
+
+
+/********************************************************************
+** Function: findAnimal: Looks up an animal by handle, wherever it
+ *              has moved to in its exhibit.
+** Params:  SlotMap::Handle handle: handle from getHandle.
+ *          AnimalRecord &animal: set to a copy of the animal.
+** Returns: bool: false if the animal has died, or its exhibit has
+ *              been kept as age cohorts since the handle was given.
+*********************************************************************/
+bool Zoo::findAnimal(SlotMap::Handle handle, AnimalRecord &animal) const
+{
+    int exhibit;
+    int64_t position;
+    if (!animal_handles.find(handle, exhibit, position))
+    {
+        return false;
+    }
+
+    animal = animal_exhibits[exhibit][position];
+    return true;
+}
+
+
+/********************************************************************
+** Function: countAdults: Counts the adults in an exhibit, with a
+ *              binary search for registered species' exhibits.
+** Params:  SpeciesId type: exhibit to count.
+** Returns: int64_t: number of animals 3 days old or older.
+*********************************************************************/
+int64_t Zoo::countAdults(SpeciesId type) const
+{
+    //same age as AnimalRecord::isAdult
+    const int ADULT_AGE = 3;
+
+    return countAtLeast(type, ADULT_AGE, exhibit_count[type].count);
+}
+
+
+/********************************************************************
+** Function: countOlderThan: Counts the animals in an exhibit older
+ *              than age, with a binary search for registered
+ *              species' exhibits.
+** Params:  SpeciesId type: exhibit to count.
+ *          int age: age in days the animals must be older than.
+** Returns: int64_t: number of animals older than age.
+*********************************************************************/
+int64_t Zoo::countOlderThan(SpeciesId type, int age) const
+{
+    return countAtLeast(type, age + 1, exhibit_count[type].count);
+}
+
+
+/********************************************************************
+** Function: countInAgeRange: Counts the animals in an exhibit from
+ *              min_age to max_age days old, inclusive.
+** Params:  SpeciesId type: exhibit to count.
+ *          int min_age: youngest age counted.
+ *          int max_age: oldest age counted.
+** Returns: int64_t: number of animals in the range.
+*********************************************************************/
+int64_t Zoo::countInAgeRange(SpeciesId type, int min_age, int max_age) const
+{
+    if (min_age > max_age)
+    {
+        return ZERO;
+    }
+
+    return countAtLeast(type, min_age, exhibit_count[type].count)
+            - countOlderThan(type, max_age);
+}
+
+
+/********************************************************************
+** Function: findOldest: Finds the oldest animal in an exhibit. It is
+ *              first in registered species' exhibits.
+** Params:  SpeciesId type: exhibit to search.
+ *          AnimalRecord &animal: set to a copy of the animal.
+** Returns: bool: false if the exhibit is empty.
+*********************************************************************/
+bool Zoo::findOldest(SpeciesId type, AnimalRecord &animal) const
+{
+    int64_t count = exhibit_count[type].count;
+    if (count == ZERO)
+    {
+        return false;
+    }
+
+    if (exhibit_count[type].cohorts)
+    {
+        animal = AnimalRecord(type, age_cohorts[type].front().age);
+        return true;
+    }
+
+    int64_t oldest = ZERO;
+    if (!isAgeSorted(type))
+    {
+        for (int64_t i=1; i<count; i++)
+        {
+            if (animal_exhibits[type][i].getAge()
+                    > animal_exhibits[type][oldest].getAge())
+            {
+                oldest = i;
+            }
+        }
     }
 
-    cout << endl << endl << FAREWELL_MSG << endl << endl;
+    animal = animal_exhibits[type][oldest];
+    return true;
+}
+
+
+/********************************************************************
+** Function: findYoungest: Finds the youngest animal in an exhibit.
+ *              It is last in registered species' exhibits.
+** Params:  SpeciesId type: exhibit to search.
+ *          AnimalRecord &animal: set to a copy of the animal.
+** Returns: bool: false if the exhibit is empty.
+*********************************************************************/
+bool Zoo::findYoungest(SpeciesId type, AnimalRecord &animal) const
+{
+    int64_t count = exhibit_count[type].count;
+    if (count == ZERO)
+    {
+        return false;
+    }
+
+    if (exhibit_count[type].cohorts)
+    {
+        animal = AnimalRecord(type, age_cohorts[type].back().age);
+        return true;
+    }
+
+    int64_t youngest = count - 1;
+    if (!isAgeSorted(type))
+    {
+        for (int64_t i=ZERO; i<count-1; i++)
+        {
+            if (animal_exhibits[type][i].getAge()
+                    < animal_exhibits[type][youngest].getAge())
+            {
+                youngest = i;
+            }
+        }
+    }
+
+    animal = animal_exhibits[type][youngest];
+    return true;
+}
+
+
+/********************************************************************
+** Function: getPopulation: Counts all animals in every exhibit.
+** Params:  None
+** Returns: int64_t: total number of animals in the zoo.
+*********************************************************************/
+int64_t Zoo::getPopulation() const
+{
+    int64_t population = ZERO;
+    for (int i=ZERO; i<num_exhibits; i++)
+    {
+        if (!CheckedMath::add(population, exhibit_count[i].count,
+                                population))
+        {
+            overflowed = true;
+        }
+    }
+    return population;
+}
+
+
+/********************************************************************
+** Function: hasOverflowed: Returns true if an animal count or the
+ *              bank account was clamped at a 64-bit limit, so the
+ *              zoo's totals are no longer exact.
+** Params:  None
+** Returns: bool: true if anything overflowed.
+*********************************************************************/
+bool Zoo::hasOverflowed() const
+{
+    return overflowed || bank_account.wasClamped();
 }
 
 
@@ -239,8 +1015,10 @@ void Zoo::runTycoon()
 *********************************************************************/
 void Zoo::beginningOfDay()
 {
+    PhaseTimer::Scope timer(PhaseTimer::BEGINNING_OF_DAY);
+
     //reset tiger bonus
-    tiger_bonus = ZERO;
+    tiger_bonus = Money();
 
     increaseAnimalsAge();
     printAnimalsAgeIncreased();
@@ -271,8 +1049,13 @@ void Zoo::beginningOfDay()
 *********************************************************************/
 void Zoo::midday()
 {
-    //random event occurs
-    randomEvent();
+    PhaseTimer::Scope timer(PhaseTimer::MIDDAY);
+
+    //random event occurs, timed once however many times it rerolls
+    {
+        PhaseTimer::Scope event_timer(PhaseTimer::RANDOM_EVENT);
+        randomEvent();
+    }
     //profits are calculated
     calculateAnimalProfits();
     //show current bank account
@@ -294,6 +1077,8 @@ void Zoo::midday()
 *********************************************************************/
 void Zoo::endOfDay()
 {
+    PhaseTimer::Scope timer(PhaseTimer::END_OF_DAY);
+
     //show state of all exhibits
     printExhibitCount();
     //show bank account
@@ -386,11 +1171,12 @@ void Zoo::nothingHappens()
 *********************************************************************/
 void Zoo::boomInAttendance()
 {
+    Tracer::Scope span("boomInAttendance", *this);
     const int LOWER_BOUND = 250;
     const int UPPER_BOUND = 500;
     int todays_bonus = MyRandom::randomInteger(LOWER_BOUND, UPPER_BOUND);
-    int total_tigers = exhibit_count[TIGER].count;
-    tiger_bonus = todays_bonus * total_tigers;
+    int64_t total_tigers = exhibit_count[TIGER].count;
+    tiger_bonus = Money::fromDollars(todays_bonus) * total_tigers;
     writeRead(BOOM, nullptr, todays_bonus);
 }
 
@@ -406,18 +1192,23 @@ void Zoo::boomInAttendance()
 *********************************************************************/
 void Zoo::babyIsBorn()
 {
+    Tracer::Scope span("babyIsBorn", *this);
+
     //passing these variables by reference
-    AnimalType selected_type;
-    Animal *selected_animal = nullptr;
-    vector<AnimalType> animals_checked;
+    SpeciesId selected_type;
+    AnimalRecord selected_animal;
+    int num_checked = ZERO;
     bool animal_chosen = false;
 
+    //no exhibit is tried yet
+    exhibits_checked.assign(num_exhibits, false);
+
     //pick random animal and check for quantity and age
-    if (pickAnimalToHaveBaby(animals_checked,
+    if (pickAnimalToHaveBaby(exhibits_checked, num_checked,
             selected_animal, selected_type, animal_chosen))
     {
         //if successfully found animal that is old enough
-        giveBirth(selected_type, selected_animal);
+        giveBirth(selected_animal);
     }
     else
     {
@@ -432,21 +1223,24 @@ void Zoo::babyIsBorn()
  *              birth, while keeping track of which animal exhibits
  *              are not able to give birth. Recursively calls itself
  *              until it has checked all animals for eligibility.
-** Params:  vector<AnimalType> &animals_checked: vector of animal
- *              types to keep track of which exhibits have already
- *              been checked.
- *          Animal *& selected_animal: Reference to pointer to an
- *              Animal instance to store the selected animal.
- *          AnimalType &selected_type: Reference to AnimalType
+** Params:  vector<bool> &animals_checked: one flag per exhibit to
+ *              keep track of which exhibits have already been
+ *              checked.
+ *          int &num_checked: Reference to number of exhibits
+ *              already checked.
+ *          AnimalRecord &selected_animal: Reference to record to
+ *              store a copy of the selected animal.
+ *          SpeciesId &selected_type: Reference to SpeciesId
  *              variable to keep track of the type of animal selected.
  *          bool &animal_chosen: Reference to boolean to keep track
  *              if animal has been chosen.
 ** Returns: bool: true if eligible animal was selected, false if no
  *              animals were able to be selected.
 *********************************************************************/
-bool Zoo::pickAnimalToHaveBaby(vector<AnimalType> &animals_checked,
-                                  Animal *&selected_animal,
-                                  AnimalType &selected_type,
+bool Zoo::pickAnimalToHaveBaby(vector<bool> &animals_checked,
+                                  int &num_checked,
+                                  AnimalRecord &selected_animal,
+                                  SpeciesId &selected_type,
                                   bool &animal_chosen)
 {
     //reset animal_chosen flag
@@ -454,31 +1248,47 @@ bool Zoo::pickAnimalToHaveBaby(vector<AnimalType> &animals_checked,
 
     //base case, if all animals already checked return false
     // for no eligible animals found
-    if (animals_checked.size() == static_cast<unsigned>(EXHIBITS_SIZE))
+    if (num_checked == num_exhibits)
     {
         return animal_chosen;
     }
 
     //pick random animal and check quantity of exhibit
-    checkAnimalsCount(animals_checked, selected_type, animal_chosen);
+    checkAnimalsCount(animals_checked, num_checked, selected_type,
+            animal_chosen);
 
     if (animal_chosen)
     {
         //random exhibit chosen that has at least 1 animal
-        //check if any animals in exhibit are old enough
-        for (int i=ZERO, k=exhibit_count[selected_type].count; i<k; i++)
+        //check if any animals in exhibit are old enough, the oldest
+        // is enough to check in age sorted exhibits
+        AnimalRecord oldest;
+        if (isAgeSorted(selected_type))
         {
-            if (animal_exhibits[selected_type][i]->isAdult())
+            if (findOldest(selected_type, oldest) && oldest.isAdult())
             {
                 //found an adult animal in selected exhibit
-                // return the pointer of that animal
-                selected_animal = animal_exhibits[selected_type][i];
+                // return a copy of that animal
+                selected_animal = oldest;
                 return animal_chosen;
             }
         }
+        else
+        {
+            for (int64_t i=ZERO, k=exhibit_count[selected_type].count; i<k; i++)
+            {
+                if (animal_exhibits[selected_type][i].isAdult())
+                {
+                    //found an adult animal in selected exhibit
+                    // return a copy of that animal
+                    selected_animal = animal_exhibits[selected_type][i];
+                    return animal_chosen;
+                }
+            }
+        }
         //no animals were old enough, recursively call pick animal
         // to have baby to pick another animal
-        pickAnimalToHaveBaby(animals_checked, selected_animal,
+        pickAnimalToHaveBaby(animals_checked, num_checked, selected_animal,
                 selected_type, animal_chosen);
     }
 
@@ -488,35 +1298,24 @@ bool Zoo::pickAnimalToHaveBaby(vector<AnimalType> &animals_checked,
 
 
 /********************************************************************
-** Function: giveBirth: An animal of specified type gives birth
- *              according to how many babies their species produces
- *              at a time. Write to file the event and read from
+** Function: giveBirth: An animal gives birth according to how many
+ *              babies their species produces at a time. Babies share
+ *              their parent's species ID, so custom traits are not
+ *              copied. Write to file the event and read from
  *              file the event, then print the event to the user.
-** Params:   AnimalType type: Type of animal to give birth.
- *           const Animal *animal: Pointer to constant eligible
- *           animal object to give birth.
+** Params:   AnimalRecord animal: copy of eligible animal to give
+ *           birth, since adding babies can move the exhibit array.
 ** Returns:  None
 *********************************************************************/
-void Zoo::giveBirth(AnimalType type, const Animal *animal)
+void Zoo::giveBirth(AnimalRecord animal)
 {
     //write/read status message that animal has given birth
-    writeRead(BIRTH, animal);
+    writeRead(BIRTH, &animal);
 
     //loop for how many babies this animal produces
-    for (int i=ZERO, k=animal->getNumBabies(); i<k; i++)
+    for (int i=ZERO, k=animal.getNumBabies(); i<k; i++)
     {
-        if (type == CUSTOM)
-        {
-            //make custom animal babies, passing in custom traits
-            addAnimal(type, ZERO, animal->getName(),
-                    animal->getCost(), animal->getNumBabies(),
-                    animal->getFeedingCost(), animal->getPayoff(), true);
-        }
-        else
-        {
-            //make normal animal
-            addAnimal(type, ZERO, true);
-        }
+        addAnimal(animal.getSpecies(), ZERO, true);
     }
 }
 
@@ -570,13 +1369,19 @@ void Zoo::animalGetsSick()
 *********************************************************************/
 void Zoo::animalDies()
 {
+    Tracer::Scope span("animalDies", *this);
+
     //passing these variables by reference
-    vector<AnimalType> animals_checked;
-    AnimalType selected_type;
+    int num_checked = ZERO;
+    SpeciesId selected_type;
     bool animal_chosen = false;
 
+    //no exhibit is tried yet
+    exhibits_checked.assign(num_exhibits, false);
+
     //pick a random animal, and check if exhibit has any of that type
-    checkAnimalsCount(animals_checked, selected_type, animal_chosen);
+    checkAnimalsCount(exhibits_checked, num_checked, selected_type,
+            animal_chosen);
 
     if (animal_chosen)
     {
@@ -597,310 +1402,795 @@ void Zoo::animalDies()
  *              either give birth or get sick and die. Keeps track of
  *              which exhibits have been checked, and if an eligible
  *              animal has been found.
-** Params:  vector<AnimalType> &animals_checked: Reference to vector
- *              of animal types to keep track of which animal
+** Params:  vector<bool> &animals_checked: Reference to vector
+ *              of one flag per exhibit to keep track of which animal
  *              exhibits have already been checked, as to prevent
  *              infinite loops due to random selection of animals.
- *          AnimalType &selected_type: Reference to AnimalType
+ *          int &num_checked: Reference to number of exhibits
+ *              already checked.
+ *          SpeciesId &selected_type: Reference to SpeciesId
  *              variable denoting which animal type was randomly
  *              selected.
  *          bool &animal_chosen: Reference to boolean variable
  *              denoting if an eligible animal has been chosen.
 ** Returns: None
 *********************************************************************/
-void Zoo::checkAnimalsCount(vector<AnimalType> &animals_checked,
-                               AnimalType &selected_type,
-                               bool &animal_chosen)
+void Zoo::checkAnimalsCount(vector<bool> &animals_checked,
+                               int &num_checked,
+                               SpeciesId &selected_type,
+                               bool &animal_chosen)
+{
+    do
+    {
+        selected_type = pickRandomAnimal();
+
+        //if exhibit has any animals, that exhibit is eligible
+        if (exhibit_count[selected_type].count > 0)
+        {
+            animal_chosen = true;
+        }
+
+        //check if randomly selected animal exhibit has already been
+        // checked. Flags are indexed by species, so this does not
+        // grow with the number of species.
+        if (!animals_checked[selected_type])
+        {
+            //selected animal has not been checked yet, update
+            // animals_checked flags
+            animals_checked[selected_type] = true;
+            num_checked++;
+        }
+
+    } while (!animal_chosen && num_checked != num_exhibits);
+}
+
+
+/********************************************************************
+** Function: pickRandomAnimal: Helper function that randomly picks
+ *              an animal type. Pick a random number
+ *              between 0 to animal exhibit count - 1.
+** Params:  None
+** Returns: SpeciesId: randomly chosen exhibit.
+ *              i.e. randomly chosen animal type.
+*********************************************************************/
+SpeciesId Zoo::pickRandomAnimal() const
+{
+    return MyRandom::randomInteger(ZERO, num_exhibits-1);
+}
+
+
+/********************************************************************
+** Function: removeAnimal: Randomly selects an animal from a specific
+ *              exhibit passed as an argument. Removes randomly
+ *              selected animal in the exhibit and frees its handle.
+ *              One animal per younger age run (or per later new
+ *              animals sub-exhibit) moves to close the gap, so
+ *              nothing else shifts. Decreases exhibit count of that animal
+ *              by 1. Write to file the event and read from
+ *              file the event, then print the event to the user.
+** Params:  SpeciesId selected_type: Type of animal to remove.
+** Returns: None
+*********************************************************************/
+void Zoo::removeAnimal(SpeciesId selected_type)
+{
+    //randomly select an animal from exhibit
+    int64_t animal_index =
+            MyRandom::randomLong(ZERO, exhibit_count[selected_type].count-1);
+
+    AnimalRecord temp_animal;
+    if (exhibit_count[selected_type].cohorts)
+    {
+        temp_animal = removeFromCohorts(selected_type, animal_index);
+    }
+    else
+    {
+        int64_t index = animal_index;
+
+        //copy selected animal before it is overwritten
+        temp_animal = animal_exhibits[selected_type][index];
+
+        //handles to the dead animal stop finding it
+        vector<uint32_t> &slots = animal_slots[selected_type];
+        if (!slots.empty())
+        {
+            animal_handles.remove(slots[index]);
+        }
+
+        //close the gap, keeping age order or new animals' groups
+        if (isAgeSorted(selected_type))
+        {
+            closeAgeGap(selected_type, index);
+        }
+        else
+        {
+            removeFromGroup(index);
+        }
+        if (!slots.empty())
+        {
+            slots.pop_back();
+        }
+    }
+
+    //decrease exhibit count of animal type by 1
+    exhibit_count[selected_type].count--;
+    adaptExhibit(selected_type);
+
+    //write/read status message that an animal got sick and died
+    writeRead(SICKNESS, &temp_animal);
+}
+
+
+/********************************************************************
+** Function: addAnimal: Adds a new animal to the exhibit by creating
+ *              a new animal, adds them to the exhibit, subtracts
+ *              their cost from the bank, then prints out a message
+ *              saying that a new animal has been added. The exhibit
+ *              is the one the species lives in.
+** Params:   SpeciesId type: type of animal to add, or interned
+ *              traits of a new animal.
+ *           Int age: age of animal to be added.
+ *              Default = 0;
+ *           Bool isBirth: boolean to denote if animal was added
+ *              by birth, if true, does not subtract the animal's
+ *              cost from the bank.
+ *              Default = false.
+** Returns: None
+*********************************************************************/
+void Zoo::addAnimal(SpeciesId type, int age, bool isBirth)
+{
+    //make a new animal
+    AnimalRecord new_animal = makeAnimal(type, age);
+
+    //add animal to the exhibit, or just count it in its age cohort
+    SpeciesId exhibit = SpeciesRegistry::get(type).exhibit;
+    if (exhibit_count[exhibit].cohorts)
+    {
+        addToCohorts(exhibit, age);
+    }
+    else
+    {
+        addToExhibit(exhibit, new_animal);
+        adaptExhibit(exhibit);
+    }
+
+    //If animal was bought, and not birthed
+    //subtract cost of animal from bank
+    if (!isBirth)
+    {
+        subFromBank(Money::fromDollars(new_animal.getCost()));
+    }
+
+    //print to screen that a new animal was added
+    printAnimalAdded(new_animal);
+}
+
+
+/********************************************************************
+** Function: makeAnimal: Creates a new animal record of specified
+ *              type at specified age.
+** Params:   SpeciesId type: type of animal to be created, or
+ *              interned traits of a new animal.
+ *           Int age: age of animal to be created.
+** Returns:  AnimalRecord: new animal created.
+*********************************************************************/
+AnimalRecord Zoo::makeAnimal(SpeciesId type, int age) const
+{
+    AllocationTracker::Scope source(AllocationTracker::MAKE_ANIMAL);
+    return AnimalRecord(type, age);
+}
+
+
+/********************************************************************
+** Function: getExhibitBytes: Measures the memory an exhibit holds.
+ *              Unused capacity is what increaseExhibit grew it by
+ *              beyond its animals, or all of it for an exhibit kept
+ *              as age cohorts.
+** Params:   int exhibit: exhibit to measure.
+** Returns:  ExhibitBytes: its bytes, split by what they are for.
+*********************************************************************/
+Zoo::ExhibitBytes Zoo::getExhibitBytes(int exhibit) const
+{
+    const int64_t RECORD_BYTES = sizeof(AnimalRecord);
+
+    const Exhibit &counts = exhibit_count[exhibit];
+    int64_t in_use = counts.cohorts ? ZERO
+                        : std::min(counts.count, counts.capacity);
+
+    ExhibitBytes bytes;
+    bytes.animals = in_use * RECORD_BYTES;
+    bytes.unused = (counts.capacity - in_use) * RECORD_BYTES;
+    bytes.index = static_cast<int64_t>(
+            age_cohorts[exhibit].capacity() * sizeof(AgeCohort));
+    bytes.slots = static_cast<int64_t>(
+            animal_slots[exhibit].capacity() * sizeof(uint32_t));
+    if (exhibit == CUSTOM)
+    {
+        bytes.index += static_cast<int64_t>(
+                custom_groups.capacity() * sizeof(CustomGroup));
+    }
+    bytes.strings = static_cast<int64_t>(
+            SpeciesRegistry::getNameBytes(exhibit));
+    return bytes;
+}
+
+
+/********************************************************************
+** Function: isMapped: Returns true if an exhibit's array lives in
+ *              its mapped arena rather than on the heap.
+** Params:   SpeciesId type: exhibit to check.
+** Returns:  bool: true if the array is in the arena.
+*********************************************************************/
+bool Zoo::isMapped(SpeciesId type) const
+{
+    return exhibit_arenas
+            && animal_exhibits[type] == exhibit_arenas[type]->getBase();
+}
+
+
+/********************************************************************
+** Function: adviseSequentialScan: Hints to the kernel that every
+ *              mapped exhibit is about to be scanned front to back.
+** Params:   None
+** Returns:  None
+*********************************************************************/
+void Zoo::adviseSequentialScan() const
+{
+    if (exhibit_arenas)
+    {
+        for (int i=ZERO; i<num_exhibits; i++)
+        {
+            if (isMapped(i))
+            {
+                exhibit_arenas[i]->adviseSequential();
+            }
+        }
+    }
+}
+
+
+/********************************************************************
+** Function: addToExhibit: Copies new animal record into their
+ *              exhibit array, after every animal at least as old.
+ *              If exhibit is at capacity, increase the exhibit
+ *              size. Increase exhibit animal count by 1.
+** Params:   SpeciesId type: type of animal.
+ *           const AnimalRecord &animal: Reference to constant
+ *              record to be added to exhibit.
+** Returns:  None
+*********************************************************************/
+void Zoo::addToExhibit(SpeciesId type, const AnimalRecord &animal)
+{
+    //growing the array, slots, and groups all count as exhibit growth
+    AllocationTracker::Scope source(AllocationTracker::INCREASE_EXHIBIT);
+
+    //check if exhibit is at capacity, if so increase capacity
+    if (exhibit_count[type].count == exhibit_count[type].capacity)
+    {
+        increaseExhibit(type);
+    }
+
+    //add animal record to animal exhibit in age order,
+    // new animals go at the end of their sub-exhibit instead
+    //a new animal has no handle, but keeps its place if others do
+    int64_t index;
+    bool has_slots = !animal_slots[type].empty();
+    if (has_slots)
+    {
+        animal_slots[type].push_back(SlotMap::NO_HANDLE.index);
+    }
+    if (isAgeSorted(type))
+    {
+        index = makeRoomForAge(type, animal.getAge());
+    }
+    else
+    {
+        index = makeRoomInGroup(animal.getSpecies());
+    }
+    animal_exhibits[type][index] = animal;
+    if (has_slots)
+    {
+        animal_slots[type][index] = SlotMap::NO_HANDLE.index;
+    }
+
+    //increase exhibit count by 1
+    exhibit_count[type].count++;
+}
+
+
+/********************************************************************
+** Function: moveAnimal: Moves an animal to another index in its
+ *              exhibit, keeping its handle pointed at it if it
+ *              has one.
+** Params:   SpeciesId type: exhibit of the animal.
+ *           int64_t from: index the animal is at.
+ *           int64_t to: index to move it to, overwriting what is there.
+** Returns:  None
+*********************************************************************/
+void Zoo::moveAnimal(SpeciesId type, int64_t from, int64_t to)
+{
+    animal_exhibits[type][to] = animal_exhibits[type][from];
+
+    //only exhibits with a handle handed out keep slot indexes
+    vector<uint32_t> &slots = animal_slots[type];
+    if (!slots.empty())
+    {
+        slots[to] = slots[from];
+        animal_handles.move(slots[to], to);
+    }
+}
+
+
+/********************************************************************
+** Function: isAgeSorted: Returns true if an exhibit is kept oldest
+ *              first. Every exhibit is, except new animals, which
+ *              are kept in sub-exhibits instead.
+** Params:   SpeciesId type: exhibit to check.
+** Returns:  bool: true if the exhibit is in age order.
+*********************************************************************/
+bool Zoo::isAgeSorted(SpeciesId type) const
+{
+    return !SpeciesRegistry::get(type).custom;
+}
+
+
+/********************************************************************
+** Function: countAtLeast: Counts the animals at least age days old
+ *              among the first end animals of an exhibit. In an age
+ *              sorted exhibit that is also the index of the first
+ *              younger animal, found with a binary search. Age
+ *              cohorts are summed oldest first.
+** Params:   SpeciesId type: exhibit to count.
+ *           int age: youngest age counted.
+ *           int64_t end: number of animals at the front to look at.
+** Returns:  int64_t: number of animals at least age days old.
+*********************************************************************/
+int64_t Zoo::countAtLeast(SpeciesId type, int age, int64_t end) const
+{
+    const AnimalRecord *exhibit = animal_exhibits[type];
+
+    if (exhibit_count[type].cohorts)
+    {
+        int64_t count = ZERO;
+        for (size_t c=ZERO; c<age_cohorts[type].size()
+                                && age_cohorts[type][c].age >= age; c++)
+        {
+            count += age_cohorts[type][c].count;
+        }
+        return count < end ? count : end;
+    }
+
+    if (!isAgeSorted(type))
+    {
+        int64_t count = ZERO;
+        for (int64_t i=ZERO; i<end; i++)
+        {
+            if (exhibit[i].getAge() >= age)
+            {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    //animals before low are old enough, animals from high on are not
+    int64_t low = ZERO;
+    int64_t high = end;
+    while (low < high)
+    {
+        int64_t middle = low + (high - low) / 2;
+        if (exhibit[middle].getAge() >= age)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+
+/********************************************************************
+** Function: makeRoomForAge: Opens a space in an age sorted exhibit
+ *              after every animal at least age days old. Each run
+ *              of younger animals of one age moves its first animal
+ *              to its end, so a newborn moves nothing. The exhibit
+ *              must have room for one more animal.
+** Params:   SpeciesId type: exhibit to add to.
+ *           int age: age of the new animal.
+** Returns:  int64_t: index to put the new animal.
+*********************************************************************/
+int64_t Zoo::makeRoomForAge(SpeciesId type, int age)
+{
+    int64_t hole = exhibit_count[type].count;
+
+    //walk back from the youngest run, each one rotating by one animal
+    // into the space the run after it left open
+    while (hole > ZERO && animal_exhibits[type][hole-1].getAge() < age)
+    {
+        int run_age = animal_exhibits[type][hole-1].getAge();
+        int64_t run_start = countAtLeast(type, run_age + 1, hole);
+        moveAnimal(type, run_start, hole);
+        hole = run_start;
+    }
+
+    return hole;
+}
+
+
+/********************************************************************
+** Function: closeAgeGap: Fills the gap left by the animal at index
+ *              in an age sorted exhibit. The last animal of its age
+ *              moves into the gap, then each younger run moves its
+ *              last animal into the gap before it, keeping the
+ *              exhibit in order. The exhibit count is not changed.
+** Params:   SpeciesId type: exhibit the animal is removed from.
+ *           int64_t index: index of the removed animal.
+** Returns:  None
+*********************************************************************/
+void Zoo::closeAgeGap(SpeciesId type, int64_t index)
+{
+    int64_t last = exhibit_count[type].count - 1;
+    int64_t gap = index;
+    int run_age = animal_exhibits[type][index].getAge();
+
+    while (true)
+    {
+        //last animal of this run fills the gap, leaving one at its end
+        int64_t run_last = countAtLeast(type, run_age, last + 1) - 1;
+        if (run_last != gap)
+        {
+            moveAnimal(type, run_last, gap);
+        }
+        gap = run_last;
+
+        if (gap == last)
+        {
+            break;
+        }
+        run_age = animal_exhibits[type][gap+1].getAge();
+    }
+}
+
+
+/********************************************************************
+** Function: makeRoomInGroup: Opens a space at the end of the new
+ *              animals sub-exhibit for traits, making the group if
+ *              it is the first of its kind. Each later group moves
+ *              its first animal to its end to make room, so only
+ *              one animal per group moves. The exhibit must have
+ *              room for one more animal.
+** Params:   SpeciesId traits: interned traits of the new animal.
+** Returns:  int64_t: index in the new animals exhibit to put it.
+*********************************************************************/
+int64_t Zoo::makeRoomInGroup(SpeciesId traits)
+{
+    size_t group = ZERO;
+    while (group < custom_groups.size()
+            && custom_groups[group].species != traits)
+    {
+        group++;
+    }
+
+    //first animal with these traits starts a group at the end
+    if (group == custom_groups.size())
+    {
+        CustomGroup new_group = {traits, exhibit_count[CUSTOM].count, ZERO};
+        custom_groups.push_back(new_group);
+    }
+
+    //walk back from the last group, each one rotating by one animal
+    // into the space the group after it left open
+    for (size_t i=custom_groups.size()-1; i>group; i--)
+    {
+        CustomGroup &later = custom_groups[i];
+        moveAnimal(CUSTOM, later.start, later.start + later.count);
+        later.start++;
+    }
+
+    CustomGroup &matching = custom_groups[group];
+    matching.count++;
+    return matching.start + matching.count - 1;
+}
+
+
+/********************************************************************
+** Function: removeFromGroup: Fills the gap left by the animal at
+ *              index with the last animal of its sub-exhibit, then
+ *              each later group moves its last animal into the gap
+ *              before it, so only one animal per group moves.
+ *              Empty groups are dropped.
+** Params:   int64_t index: index of the removed animal.
+** Returns:  None
+*********************************************************************/
+void Zoo::removeFromGroup(int64_t index)
 {
-    do
+    size_t group = ZERO;
+    while (index >= custom_groups[group].start + custom_groups[group].count)
     {
-        selected_type = pickRandomAnimal();
+        group++;
+    }
 
-        //if exhibit has any animals, that exhibit is eligible
-        if (exhibit_count[selected_type].count > 0)
-        {
-            animal_chosen = true;
-        }
+    //the group's last animal fills the gap, leaving one at its end
+    int64_t gap = custom_groups[group].start + custom_groups[group].count - 1;
+    if (index != gap)
+    {
+        moveAnimal(CUSTOM, gap, index);
+    }
+    custom_groups[group].count--;
 
-        //check if randomly selected animal exhibit has already been
-        // checked.
-        // Search for selected animal in vector.
-        if (std::find(animals_checked.begin(), animals_checked.end(),
-                selected_type) == animals_checked.end())
-        {
-            //selected animal has not been checked yet, update
-            // animals_checked vector
-            animals_checked.push_back(selected_type);
-        }
+    //each later group slides down one by moving its last animal
+    for (size_t i=group+1; i<custom_groups.size(); i++)
+    {
+        CustomGroup &later = custom_groups[i];
+        int64_t last = later.start + later.count - 1;
+        moveAnimal(CUSTOM, last, gap);
+        gap = last;
+        later.start--;
+    }
 
-    } while (!animal_chosen && animals_checked.size() != static_cast<unsigned>(EXHIBITS_SIZE));
+    if (custom_groups[group].count == ZERO)
+    {
+        custom_groups.erase(custom_groups.begin() + group);
+    }
 }
 
 
 /********************************************************************
-** Function: pickRandomAnimal: Helper function that randomly picks
- *              an animal type. Pick a random number
- *              between 0 to animal exhibit count - 1.
-** Params:  None
-** Returns: int: randomly chosen number static_casted into AnimalType.
- *              i.e. randomly chosen animal type.
+** Function: increaseExhibit: Doubles exhibit capacity, or sets it
+ *              to START_EXHIBIT_SIZE if it is empty, so filling an
+ *              exhibit copies each animal a constant number of times
+ *              on average. Creates a new dynamically
+ *              allocated array of animal records, copies the old
+ *              array over, deletes the old array, and points the
+ *              old array pointer to the new array. A mapped exhibit
+ *              grows its arena in place instead. Sets the exhibit
+ *              capacity to the new value.
+** Params:   SpeciesId type: type of exhibit to increase capacity.
+** Returns:  None
 *********************************************************************/
-AnimalType Zoo::pickRandomAnimal() const
+void Zoo::increaseExhibit(SpeciesId type)
 {
-    return static_cast<AnimalType>
-            (MyRandom::randomInteger(ZERO, EXHIBITS_SIZE-1));
+    resizeExhibit(type, std::max(exhibit_count[type].capacity
+                                    * EXHIBIT_GROWTH_FACTOR,
+                                 static_cast<int64_t>(START_EXHIBIT_SIZE)));
 }
 
 
 /********************************************************************
-** Function: removeAnimal: Randomly selects an animal from a specific
- *              exhibit passed as an argument. Deletes randomly
- *              selected animal in the exhibit. Shifts the rest of
- *              the animal pointers in the animal's exhibit array
- *              down to fill in the space of the deleted animal.
- *              Deletes the pointer of the last animal in the exhibit,
- *              because it is now duplicated (set the last pointer
- *              to nullptr). Decreases exhibit count of that animal
- *              by 1. Write to file the event and read from
- *              file the event, then print the event to the user.
-** Params:  AnimalType selected_type: Type of animal to remove.
-** Returns: None
+** Function: resizeExhibit: Sets an exhibit's capacity, growing a
+ *              mapped arena in place or copying the animals into a
+ *              new heap array. A capacity of 0 frees a heap array.
+** Params:   SpeciesId type: type of exhibit to resize.
+ *           int64_t new_capacity: animals it must hold, at least
+ *              its animal count.
+** Returns:  None
 *********************************************************************/
-void Zoo::removeAnimal(AnimalType selected_type)
+void Zoo::resizeExhibit(SpeciesId type, int64_t new_capacity)
 {
-    //temporary animal pointer
-    Animal *temp_animal;
+    Tracer::Scope span("resizeExhibit", *this);
 
-    //randomly select an animal from exhibit
-    int animal_index =
-            MyRandom::randomInteger(ZERO, exhibit_count[selected_type].count-1);
+    int64_t new_array_size = new_capacity;
 
-    //point temp animal pointer to selected animal
-    temp_animal = animal_exhibits[selected_type][animal_index];
+    //a mapped exhibit never moves, its file just gets longer
+    if (isMapped(type))
+    {
+        if (new_array_size <= exhibit_count[type].capacity)
+        {
+            return;
+        }
+        if (exhibit_arenas[type]->grow(
+                static_cast<size_t>(new_array_size) * sizeof(AnimalRecord)))
+        {
+            exhibit_count[type].capacity = new_array_size;
+            return;
+        }
+    }
 
-    //shift all animals in exhibit array from selected animal
-    // down one except for last one, this removes them from the exhibit,
-    // and fills the gap
-    for (int i=animal_index, k=exhibit_count[selected_type].count-1; i<k; i++)
+    //create new array for exhibit with new size, a full arena
+    // falls back to the heap
+    AnimalRecord *new_array = nullptr;
+    if (new_array_size > ZERO)
     {
-        //copy the pointer to the right over to current pointer
-        animal_exhibits[selected_type][i] = animal_exhibits[selected_type][i+1];
+        new_array = new AnimalRecord[new_array_size];
     }
 
-    //delete pointer at the end of exhibit array because it is now
-    // a duplicate. point to nullptr
-    animal_exhibits[selected_type][exhibit_count[selected_type].count-1] = nullptr;
+    //copy animal records of old array into new array
+    for (int64_t i=ZERO, k=exhibit_count[type].count;
+            i<k && i<new_array_size; i++)
+    {
+        new_array[i] = animal_exhibits[type][i];
+    }
 
-    //decrease exhibit count of animal type by 1
-    exhibit_count[selected_type].count--;
+    //delete old animal exhibit array, unless it is in the arena
+    if (!isMapped(type))
+    {
+        delete [] animal_exhibits[type];
+    }
 
-    //write/read status message that an animal got sick and died
-    writeRead(SICKNESS, temp_animal);
+    //set animal exhibit pointer to new array
+    animal_exhibits[type] = new_array;
+
+    //pointer new array to nullptr
+    new_array = nullptr;
 
-    //deallocate dead animal
-    delete temp_animal;
-    temp_animal = nullptr;
+    //set new exhibit capacity
+    exhibit_count[type].capacity = new_array_size;
 }
 
 
 /********************************************************************
-** Function: addAnimal: Adds a new animal to the exhibit by creating
- *              a new animal, adds them to the exhibit, subtracts
- *              their cost from the bank, then prints out a message
- *              saying that a new animal has been added.
-** Params:   AnimalType type: type of animal to add.
- *           Int age: age of animal to be added.
- *              Default = 0;
- *           Bool isBirth: boolean to denote if animal was added
- *              by birth, if true, does not subtract the animal's
- *              cost from the bank.
- *              Default = false.
-** Returns: None
+** Function: adaptExhibit: Switches a registered species' exhibit
+ *              to age cohorts once it holds more than the cohort
+ *              threshold, and back to single animals below half of
+ *              it. The new animals exhibit never switches.
+** Params:   SpeciesId type: exhibit that just changed size.
+** Returns:  None
 *********************************************************************/
-void Zoo::addAnimal(AnimalType type, int age, bool isBirth)
+void Zoo::adaptExhibit(SpeciesId type)
 {
-    //make a new animal
-    Animal *new_animal = makeAnimal(type, age);
+    AllocationTracker::Scope source(AllocationTracker::INCREASE_EXHIBIT);
 
-    //add animal to the exhibit
-    addToExhibit(type, new_animal);
-
-    //If animal was bought, and not birthed
-    //subtract cost of animal from bank
-    if (!isBirth)
+    if (!isAgeSorted(type))
     {
-        subFromBank(new_animal->getCost());
+        return;
     }
 
-    //print to screen that a new animal was added
-    printAnimalAdded(new_animal);
+    //half the threshold to switch back, so an exhibit near it does
+    // not switch back and forth every day
+    if (!exhibit_count[type].cohorts
+            && exhibit_count[type].count > cohort_threshold)
+    {
+        switchToCohorts(type);
+    }
+    else if (exhibit_count[type].cohorts
+            && exhibit_count[type].count < cohort_threshold / 2)
+    {
+        switchToAnimals(type);
+    }
 }
 
+
 /********************************************************************
-** Function: addAnimal(overloaded): Overloaded version of addAnimal
- *              specifically for creating new custom animals. Adds a
- *              new animal to the exhibit by creating a new animal,
- *              adds them to the exhibit, subtracts their cost from
- *              the bank, then prints out a message saying a new
- *              animal has been added.
-** Params:  AnimalType type: type of animal to add.
- *          Int age: age of animal to be added.
- *          const string& name: name of animal.
- *          Int cost: cost of animal.
- *          Int num_babies: number of babies the animal produces.
- *          Int feeding_cost: cost to feed animal.
- *          Int payoff: profit generated by animal.
- *          Bool isBirth: boolean to denote if animal was added
- *              by birth, if true, does not subtract the animal's
- *              cost from the bank.
- *              Default = false.
-** Returns: None
+** Function: switchToCohorts: Counts an age sorted exhibit's
+ *              animals by age, frees the heap array, and frees
+ *              the handles of any of its animals, which stop
+ *              finding them.
+** Params:   SpeciesId type: exhibit to switch.
+** Returns:  None
 *********************************************************************/
-void Zoo::addAnimal(AnimalType type, int age, const std::string &name,
-                       int cost, int num_babies, int feeding_cost,
-                       int payoff, bool isBirth)
+void Zoo::switchToCohorts(SpeciesId type)
 {
-    //make new custom animal
-    Animal *new_animal =
-            makeAnimal(type, age, name, cost, num_babies, feeding_cost, payoff);
+    vector<AgeCohort> &cohorts = age_cohorts[type];
+    cohorts.clear();
 
-    //add animal to exhibit
-    addToExhibit(type, new_animal);
+    //animals are oldest first, so each age is one run
+    for (int64_t i=ZERO, k=exhibit_count[type].count; i<k; i++)
+    {
+        int age = animal_exhibits[type][i].getAge();
+        if (cohorts.empty() || cohorts.back().age != age)
+        {
+            AgeCohort cohort = {age, ZERO};
+            cohorts.push_back(cohort);
+        }
+        cohorts.back().count++;
+    }
 
-    //If animal was bought, and not birthed
-    //subtract cost of animal from bank
-    if (!isBirth)
+    //cohorts are not animals, so every handle to the exhibit dies
+    for (size_t i=ZERO; i<animal_slots[type].size(); i++)
     {
-        subFromBank(new_animal->getCost());
+        animal_handles.remove(animal_slots[type][i]);
     }
 
-    //print to screen that a new animal was added
-    printAnimalAdded(new_animal);
+    //release the per-animal storage, a mapped file keeps its size
+    vector<uint32_t>().swap(animal_slots[type]);
+    resizeExhibit(type, ZERO);
+    exhibit_count[type].cohorts = true;
 }
 
 
 /********************************************************************
-** Function: makeAnimal: Creates a new animal of specified type at
- *              specified age. Tigers, penguins, or turtles only.
-** Params:   AnimalType type: type of animal to be created.
- *           Int age: age of animal to be created.
-** Returns:  Animal *: pointer to new animal created.
+** Function: switchToAnimals: Lays an exhibit's age cohorts back out
+ *              as single animals, oldest first, none of them with
+ *              a handle yet.
+** Params:   SpeciesId type: exhibit to switch.
+** Returns:  None
 *********************************************************************/
-Animal *Zoo::makeAnimal(AnimalType type, int age)
+void Zoo::switchToAnimals(SpeciesId type)
 {
-    Animal *new_animal = nullptr;
+    vector<AgeCohort> cohorts;
+    cohorts.swap(age_cohorts[type]);
+
+    exhibit_count[type].cohorts = false;
+    exhibit_count[type].count = ZERO;
 
-    switch(type)
+    //oldest first, so every animal goes at the end of the exhibit
+    for (size_t c=ZERO; c<cohorts.size(); c++)
     {
-        case TIGER:
-            new_animal = new Tiger(age);
-            break;
-        case PENGUIN:
-            new_animal = new Penguin(age);
-            break;
-        case TURTLE:
-            new_animal = new Turtle(age);
-            break;
-        case CUSTOM:
-            break;  //should never reach here
+        for (int64_t i=ZERO; i<cohorts[c].count; i++)
+        {
+            addToExhibit(type, AnimalRecord(type, cohorts[c].age));
+        }
     }
-
-    return new_animal;
 }
 
 
 /********************************************************************
-** Function: makeAnimal(overloaded): Overloaded version of makeAnimal
- *              specifically for creating a new custom animal.
- *              Creates a new animal of specified type at specified
- *              age.
-** Params:   AnimalType type: type of animal to be created.
- *           Int age: age of animal to be created.
- *           const string& name: name of animal.
- *           Int cost: cost of animal.
- *           Int num_babies: number of babies the animal produces.
- *           Int feeding_cost: cost to feed animal.
- *           Int payoff: profit generated by animal.
-** Returns:  Animal *: pointer to new custom animal created.
+** Function: addToCohorts: Adds animals of one age to their age
+ *              cohort, starting a new cohort in age order if they
+ *              are the first of their age. Increase exhibit animal
+ *              count by the animals added.
+** Params:   SpeciesId type: exhibit kept as age cohorts.
+ *           int age: age of the animals.
+ *           int64_t count: animals to add.
+ *              Default = 1.
+** Returns:  None
 *********************************************************************/
-Animal *Zoo::makeAnimal(AnimalType type, int age, const std::string &name,
-                           int cost, int num_babies, int feeding_cost,
-                           int payoff)
+void Zoo::addToCohorts(SpeciesId type, int age, int64_t count)
 {
-    Animal *new_animal = new CustomAnimal(name, age, cost, num_babies,
-                            feeding_cost, payoff);
-
-    return new_animal;
-}
+    AllocationTracker::Scope source(AllocationTracker::INCREASE_EXHIBIT);
 
+    vector<AgeCohort> &cohorts = age_cohorts[type];
 
-/********************************************************************
-** Function: addToExhibit: Adds new animal pointer into their exhibit
- *              array. If exhibit is at capacity, increase the
- *              exhibit size. Increase exhibit animal count by 1.
-** Params:   AnimalType type: type of animal.
- *           Animal *&animal_ptr: Reference to pointer to
- *              Animal to be added to exhibit.
-** Returns:  None
-*********************************************************************/
-void Zoo::addToExhibit(AnimalType type, Animal *&animal_ptr)
-{
-    //check if exhibit is at capacity, if so increase capacity
-    if (exhibit_count[type].count == exhibit_count[type].capacity)
+    //newborns are youngest, so the search from the end is short
+    size_t c = cohorts.size();
+    while (c > 0 && cohorts[c-1].age < age)
     {
-        increaseExhibit(type);
+        c--;
     }
 
-    //add animal pointer to animal exhibit at the next open index
-    animal_exhibits[type][exhibit_count[type].count] = animal_ptr;
+    if (c > 0 && cohorts[c-1].age == age)
+    {
+        if (!CheckedMath::add(cohorts[c-1].count, count,
+                                cohorts[c-1].count))
+        {
+            overflowed = true;
+        }
+    }
+    else
+    {
+        AgeCohort cohort = {age, count};
+        cohorts.insert(cohorts.begin() + c, cohort);
+    }
 
-    //increase exhibit count by 1
-    exhibit_count[type].count++;
+    if (!CheckedMath::add(exhibit_count[type].count, count,
+                            exhibit_count[type].count))
+    {
+        overflowed = true;
+    }
 }
 
 
 /********************************************************************
-** Function: increaseExhibit: Increases exhibit capacity by a factor
- *              of START_EXHIBIT_SIZE. All exhibits will be increased
- *              by a size of 10 at a time. Creates a new dynamically
- *              allocated array of animal pointers, copies the old
- *              array over, deletes the old array, and points the
- *              old array pointer to the new array. Sets the exhibit
- *              capacity to the new value.
-** Params:   AnimalType type: type of exhibit to increase capacity.
-** Returns:  None
+** Function: removeFromCohorts: Removes the animal that would be at
+ *              index if the exhibit were laid out oldest first, so
+ *              a random index picks an age weighted by its cohort.
+ *              Empty cohorts are dropped. The exhibit count is not
+ *              changed.
+** Params:   SpeciesId type: exhibit kept as age cohorts.
+ *           int64_t index: index of the animal, oldest first.
+** Returns:  AnimalRecord: copy of the removed animal.
 *********************************************************************/
-void Zoo::increaseExhibit(AnimalType type)
+AnimalRecord Zoo::removeFromCohorts(SpeciesId type, int64_t index)
 {
-    //exhibit size will increase by 10
-    int new_array_size = exhibit_count[type].capacity + START_EXHIBIT_SIZE;
-
-    //create new array for exhibit with new size
-    Animal **new_array = new Animal*[new_array_size];
+    vector<AgeCohort> &cohorts = age_cohorts[type];
 
-    //initialize all the new pointers to nullptr
-    for (int i=ZERO, k=new_array_size; i<k; i++)
+    size_t c = ZERO;
+    while (index >= cohorts[c].count)
     {
-        new_array[i] = nullptr;
+        index -= cohorts[c].count;
+        c++;
     }
 
-    //copy animal pointers of old array into new array
-    for (int i=ZERO, k=exhibit_count[type].capacity; i<k; i++)
+    AnimalRecord animal(type, cohorts[c].age);
+    cohorts[c].count--;
+    if (cohorts[c].count == ZERO)
     {
-        new_array[i] = animal_exhibits[type][i];
+        cohorts.erase(cohorts.begin() + c);
     }
 
-    //delete old animal exhibit array
-    delete [] animal_exhibits[type];
-
-    //set animal exhibit pointer to new array
-    animal_exhibits[type] = new_array;
-
-    //pointer new array to nullptr
-    new_array = nullptr;
-
-    //set new exhibit capacity
-    exhibit_count[type].capacity = new_array_size;
+    return animal;
 }
 
 
@@ -912,12 +2202,44 @@ void Zoo::increaseExhibit(AnimalType type)
 *********************************************************************/
 void Zoo::increaseAnimalsAge()
 {
-    for (int i=ZERO, k=EXHIBITS_SIZE; i<k; i++)
+    adviseSequentialScan();
+
+    increaseAnimalsAgeShare(ZERO, 1);
+}
+
+
+/********************************************************************
+** Function: increaseAnimalsAgeShare: Increases age of one share of
+ *              the animals in the Zoo by 1 day. The shares split every
+ *              exhibit's age cohorts and animals into runs that do
+ *              not overlap, so threads can age a share each.
+** Params:   int share: share to age, from 0 to shares - 1.
+ *           int shares: shares the animals are split into.
+** Returns:  None
+*********************************************************************/
+void Zoo::increaseAnimalsAgeShare(int share, int shares)
+{
+    for (int i=ZERO, k=num_exhibits; i<k; i++)
     {
-        for (int j=ZERO, p=exhibit_count[i].count; j<p; j++)
+        //a whole age cohort ages at once
+        size_t cohorts = age_cohorts[i].size();
+        for (size_t c=cohorts*share/shares, d=cohorts*(share+1)/shares;
+                c<d; c++)
+        {
+            age_cohorts[i][c].age++;
+        }
+
+        if (exhibit_count[i].cohorts)
+        {
+            continue;
+        }
+
+        int64_t count = exhibit_count[i].count;
+        for (int64_t j=count*share/shares, p=count*(share+1)/shares;
+                j<p; j++)
         {
             //increase animal's age by 1
-            animal_exhibits[i][j]->incrementAge();
+            animal_exhibits[i][j].incrementAge();
         }
     }
 }
@@ -933,16 +2255,58 @@ void Zoo::increaseAnimalsAge()
 *********************************************************************/
 void Zoo::feedAllAnimals()
 {
-    for (int i=ZERO, k=EXHIBITS_SIZE; i<k; i++)
+    adviseSequentialScan();
+
+    subFromBank(getFeedingCost(ZERO, num_exhibits));
+}
+
+
+/********************************************************************
+** Function: getFeedingCost: Adds up the feeding cost of the animals
+ *              in a range of exhibits, times food cost multiplier.
+ *              Every animal in a registered species' exhibit, or in a
+ *              new animals sub-exhibit, has the same feeding cost, so
+ *              it is looked up once per exhibit or group instead of
+ *              once per animal. Dispatching per exhibit stands in for
+ *              a compile-time species layer: no call is made per
+ *              animal at all, and the total is exactly what feeding
+ *              each animal separately would cost.
+** Params:   int first: first exhibit to feed.
+ *           int last: exhibit after the last one to feed.
+** Returns:  Money: feeding cost of the range.
+*********************************************************************/
+Money Zoo::getFeedingCost(int first, int last) const
+{
+    Money feeding_costs;
+
+    for (int i=first; i<last; i++)
     {
-        for (int j=ZERO, p=exhibit_count[i].count; j<p; j++)
+        const SpeciesRegistry::Species &species = SpeciesRegistry::get(i);
+
+        if (!species.custom)
+        {
+            //animal's feeding cost times food cost multiplier, in
+            // whole cents, so the exhibit is fed in one multiply
+            const Money feeding_cost = Money::fromDollars(
+                    food_cost_multiplier * species.feeding_cost);
+
+            feeding_costs += feeding_cost * exhibit_count[i].count;
+        }
+        else
         {
-            //subtract animal's feeding cost times food cost multiplier
-            // from bank account
-            subFromBank
-            (food_cost_multiplier * animal_exhibits[i][j]->getFeedingCost());
+            //new animals are grouped by their interned traits
+            for (size_t j=ZERO; j<custom_groups.size(); j++)
+            {
+                const Money feeding_cost = Money::fromDollars(
+                        food_cost_multiplier * SpeciesRegistry::get(
+                            custom_groups[j].species).feeding_cost);
+
+                feeding_costs += feeding_cost * custom_groups[j].count;
+            }
         }
     }
+
+    return feeding_costs;
 }
 
 
@@ -955,19 +2319,11 @@ void Zoo::feedAllAnimals()
 *********************************************************************/
 void Zoo::calculateAnimalProfits()
 {
-    int total_profit = 0;
-
-    for (int i=ZERO, k=EXHIBITS_SIZE; i<k; i++)
-    {
-        for (int j=ZERO, p=exhibit_count[i].count; j<p; j++)
-        {
-            //add animal's payoff to total profit
-            total_profit += animal_exhibits[i][j]->getPayoff();
-        }
-    }
+    adviseSequentialScan();
 
     //add tiger bonus to total profit
-    total_profit += tiger_bonus;
+    Money total_profit = getAnimalProfits(ZERO, num_exhibits)
+                            + tiger_bonus;
 
     //add total profit to bank account
     addToBank(total_profit);
@@ -977,21 +2333,69 @@ void Zoo::calculateAnimalProfits()
 }
 
 
+/********************************************************************
+** Function: getAnimalProfits: Adds up the payoffs of the animals in
+ *              a range of exhibits, without the tiger bonus. Payoffs
+ *              are looked up once per exhibit or new animals
+ *              sub-exhibit, like feeding costs.
+** Params:   int first: first exhibit to add up.
+ *           int last: exhibit after the last one to add up.
+** Returns:  Money: payoffs of the range.
+*********************************************************************/
+Money Zoo::getAnimalProfits(int first, int last) const
+{
+    Money profits;
+
+    for (int i=first; i<last; i++)
+    {
+        const SpeciesRegistry::Species &species = SpeciesRegistry::get(i);
+
+        if (!species.custom)
+        {
+            //add every animal's payoff to total profit
+            profits += Money::fromDollars(species.payoff)
+                            * exhibit_count[i].count;
+        }
+        else
+        {
+            //new animals are grouped by their interned traits
+            for (size_t j=ZERO; j<custom_groups.size(); j++)
+            {
+                profits += Money::fromDollars(SpeciesRegistry::get(
+                                custom_groups[j].species).payoff)
+                            * custom_groups[j].count;
+            }
+        }
+    }
+
+    return profits;
+}
+
+
 /********************************************************************
 ** Function: printAnimalAdded: Prints out a message that a new
  *              animal was added to the exhibit.
-** Params:   const Animal *animal: Pointer to constant animal object.
+** Params:   const AnimalRecord &animal: Reference to constant
+ *           animal record.
 ** Returns:  None
 *********************************************************************/
-void Zoo::printAnimalAdded(const Animal *animal) const
+void Zoo::printAnimalAdded(const AnimalRecord &animal) const
 {
+    AllocationTracker::Scope source(AllocationTracker::PRINT_ANIMAL_ADDED);
+
+    //headless runs print nothing
+    if (headless)
+    {
+        return;
+    }
+
     //create string message
     string message;
     message += "A new "
-                + animal->getName()
+                + animal.getName()
                 + " was added to the exhibit. ";
     message += "It is only "
-                + std::to_string(animal->getAge())
+                + std::to_string(animal.getAge())
                 + " days old.";
 
     //print message to screen
@@ -1007,6 +2411,12 @@ void Zoo::printAnimalAdded(const Animal *animal) const
 *********************************************************************/
 void Zoo::printAnimalsAgeIncreased() const
 {
+    //headless runs print nothing
+    if (headless)
+    {
+        return;
+    }
+
     const string MESSAGE = "All animals are one day older.";
 
     menu.formatPrompt(MESSAGE);
@@ -1021,6 +2431,12 @@ void Zoo::printAnimalsAgeIncreased() const
 *********************************************************************/
 void Zoo::printAnimalsFed() const
 {
+    //headless runs print nothing
+    if (headless)
+    {
+        return;
+    }
+
     const string MESSAGE = "All animals have been fed! :3";
 
     menu.formatPrompt(MESSAGE);
@@ -1030,16 +2446,24 @@ void Zoo::printAnimalsFed() const
 /********************************************************************
 ** Function: printTodaysProfits: Prints out message that today's
  *              profits have been calculated.
-** Params:   Int profits: today's total profits.
+** Params:   const Money &profits: today's total profits.
 ** Returns:  None
 *********************************************************************/
-void Zoo::printTodaysProfits(int profits) const
+void Zoo::printTodaysProfits(const Money &profits) const
 {
+    //headless runs print nothing
+    if (headless)
+    {
+        return;
+    }
+
     //create string message
     string message;
     message += "Your zoo made a killing today.. ";
+    std::ostringstream amount;
+    amount << profits;
     message += "you earned $"
-                + std::to_string(profits)
+                + amount.str()
                 + " in total profit..";
 
     menu.formatPrompt(message);
@@ -1055,29 +2479,48 @@ void Zoo::printTodaysProfits(int profits) const
 *********************************************************************/
 void Zoo::buyNewAnimal()
 {
-    const string ANIMAL_LIST[] =
-            {"Tiger", "Penguin", "Turtle", "New animal (*extra credit*)"};
-    const int ANIMAL_LIST_SIZE = 4;
+    PhaseTimer::Scope timer(PhaseTimer::PROMPT);
+
     const int ADULT_AGE = 3;
     int confirmation;
 
+    //headless runs buy the policy's animal when they can afford to
+    if (headless)
+    {
+        if (policy.buy_type >= ZERO && policy.buy_type < num_exhibits
+                && !SpeciesRegistry::get(policy.buy_type).custom
+                && bank_account > Money::fromDollars(policy.buy_min_bank))
+        {
+            addAnimal(policy.buy_type, ADULT_AGE);
+        }
+        return;
+    }
+
     //ask user if they want to buy a new animal
     const string BUY_ANIMAL_PROMPT = "Do you want to buy a new animal?";
     confirmation = menu.confirm(BUY_ANIMAL_PROMPT);
 
     if (confirmation == Menu::YES)
     {
+        //list every species in ID order, so a choice is a species ID
+        const string NEW_ANIMAL = "New animal (*extra credit*)";
+        vector<string> animal_list(num_exhibits);
+        for (int i=ZERO; i<num_exhibits; i++)
+        {
+            const SpeciesRegistry::Species &species = SpeciesRegistry::get(i);
+            animal_list[i] = species.custom ? NEW_ANIMAL : species.name;
+        }
+
         //show user a list of animals to choose from.
         // Subtract 1 to account for zero-based index.
         const string CHOOSE_ANIMAL_PROMPT = "Choose an animal";
-        AnimalType animal_selection =
-                static_cast<AnimalType>
-                (menu.chooseOne(ANIMAL_LIST,
-                                ANIMAL_LIST_SIZE,
-                                CHOOSE_ANIMAL_PROMPT)-1);
+        SpeciesId animal_selection =
+                menu.chooseOne(animal_list.data(),
+                                num_exhibits,
+                                CHOOSE_ANIMAL_PROMPT)-1;
 
         //if user wants to buy a new custom animal
-        if (animal_selection == CUSTOM)
+        if (SpeciesRegistry::get(animal_selection).custom)
         {
             buyCustomAnimal();
         }
@@ -1132,8 +2575,10 @@ void Zoo::buyCustomAnimal()
     //prompt for name
     menu.printBorder();
     cout << endl;
-    cout << ANIMAL_TRAIT_PROMPTS[NAME_INDEX];
+    cout << ANIMAL_TRAIT_PROMPTS[NAME_INDEX] << std::flush;
+    ResponseTimer::promptShown();
     getline(cin, name);
+    ResponseTimer::inputAccepted();
     menu.printBorder();
 
     //prompt for cost
@@ -1156,8 +2601,16 @@ void Zoo::buyCustomAnimal()
             (ANIMAL_TRAIT_PROMPTS[PAYOFF_INDEX],
              PAYOFF_RANGE[LOWER_RANGE], PAYOFF_RANGE[UPPER_RANGE]);
 
-    //add the new custom animal
-    addAnimal(CUSTOM, ADULT_AGE, name, cost, num_babies, feeding_cost, payoff);
+    //add the new custom animal, its traits are stored once per species
+    SpeciesId traits = SpeciesRegistry::intern(name, cost, num_babies,
+                                                feeding_cost, payoff);
+    if (traits < ZERO)
+    {
+        cout << "The zoo cannot keep track of any more kinds of animals."
+                << endl;
+        return;
+    }
+    addAnimal(traits, ADULT_AGE);
 }
 
 
@@ -1170,16 +2623,26 @@ void Zoo::buyCustomAnimal()
 *********************************************************************/
 void Zoo::promptForFeedType()
 {
-    //constants for feed type prompt
-    const string MESSAGE = "What type of feed do you want to use today?";
-    const string FEED_CHOICES[] = {"Cheap", "Generic", "Premium"};
-    const int FEED_CHOICES_SIZE = 3;
+    PhaseTimer::Scope timer(PhaseTimer::PROMPT);
 
-    //prompt user for todays feed type
-    // and set it to global todays_feed_type.
-    // Subtract 1 to account for zero-based index.
-    todays_feed_type = static_cast<FeedType>
-            (menu.chooseOne(FEED_CHOICES, FEED_CHOICES_SIZE, MESSAGE)-1);
+    if (headless)
+    {
+        //headless runs always use the policy's feed type
+        todays_feed_type = policy.feed_type;
+    }
+    else
+    {
+        //constants for feed type prompt, only built when asking
+        const string MESSAGE = "What type of feed do you want to use today?";
+        const string FEED_CHOICES[] = {"Cheap", "Generic", "Premium"};
+        const int FEED_CHOICES_SIZE = 3;
+
+        //prompt user for todays feed type
+        // and set it to global todays_feed_type.
+        // Subtract 1 to account for zero-based index.
+        todays_feed_type = static_cast<FeedType>
+                (menu.chooseOne(FEED_CHOICES, FEED_CHOICES_SIZE, MESSAGE)-1);
+    }
 
     //change todays food cost multiplier
     changeFoodCostMultiplier(todays_feed_type);
@@ -1202,10 +2665,10 @@ void Zoo::changeFoodCostMultiplier(FeedType type)
 /********************************************************************
 ** Function: addToBank: Adds amount passed as argument to the Zoo's
  *              bank account.
-** Params:   double amount: amount of $ to add to the bank.
+** Params:   const Money &amount: amount of $ to add to the bank.
 ** Returns:  None
 *********************************************************************/
-void Zoo::addToBank(double amount)
+void Zoo::addToBank(const Money &amount)
 {
     bank_account += amount;
 }
@@ -1214,10 +2677,10 @@ void Zoo::addToBank(double amount)
 /********************************************************************
 ** Function: subFromBank: Subtracts amount passed as argument to
  *              the Zoo's bank account.
-** Params:   double amount: amount of $ to subtract from bank.
+** Params:   const Money &amount: amount of $ to subtract from bank.
 ** Returns:  None
 *********************************************************************/
-void Zoo::subFromBank(double amount)
+void Zoo::subFromBank(const Money &amount)
 {
     bank_account -= amount;
 }
@@ -1230,6 +2693,12 @@ void Zoo::subFromBank(double amount)
 *********************************************************************/
 void Zoo::printBank() const
 {
+    //headless runs print nothing
+    if (headless)
+    {
+        return;
+    }
+
     string message = "Bank account: $";
 
     menu.printBorder();
@@ -1252,7 +2721,7 @@ void Zoo::printBank() const
 *********************************************************************/
 bool Zoo::isBankrupt() const
 {
-    return bank_account < 1;
+    return bank_account < Money::fromDollars(1);
 }
 
 
@@ -1282,6 +2751,18 @@ void Zoo::checkIfBankrupt()
 *********************************************************************/
 void Zoo::promptToKeepPlaying()
 {
+    PhaseTimer::Scope timer(PhaseTimer::PROMPT);
+
+    //headless runs stop once they reach the horizon
+    if (headless)
+    {
+        if (day_counter >= horizon)
+        {
+            gameOver(day_counter, QUIT);
+        }
+        return;
+    }
+
     const string MESSAGE = "Do you want to keep playing?";
     int confirmation = menu.confirm(MESSAGE);
     if (confirmation == Menu::NO)
@@ -1305,6 +2786,15 @@ void Zoo::promptToKeepPlaying()
 *********************************************************************/
 void Zoo::gameOver(int day_counter, ExitReason reason)
 {
+    exit_reason = reason;
+
+    //headless runs only need to stop
+    if (headless)
+    {
+        exit_status = true;
+        return;
+    }
+
     //output messages
     const string GAME_OVER_MSG = "Game Over";
     const string DAYS_OPENED_MSG =
@@ -1359,36 +2849,28 @@ void Zoo::gameOver(int day_counter, ExitReason reason)
 *********************************************************************/
 void Zoo::printExhibitCount() const
 {
+    //headless runs print nothing
+    if (headless)
+    {
+        return;
+    }
+
     const string CAPACITY = "Capacity: ";
     const string COUNT = "Count: ";
 
     menu.printBorder();
     cout << endl;
 
-    cout << "Animal exhibit count" << endl << endl;
-
-    //tiger exhibit
-    cout << "Tiger exhibit:" << endl;
-    cout << CAPACITY << exhibit_count[TIGER].capacity << endl;
-    cout << COUNT << exhibit_count[TIGER].count << endl;
-    cout << endl;
-
-    //penguin exhibit
-    cout << "Penguin exhibit:" << endl;
-    cout << CAPACITY << exhibit_count[PENGUIN].capacity << endl;
-    cout << COUNT << exhibit_count[PENGUIN].count << endl;
-    cout << endl;
-
-    //turtle exhibit
-    cout << "Turtle exhibit:" << endl;
-    cout << CAPACITY << exhibit_count[TURTLE].capacity << endl;
-    cout << COUNT << exhibit_count[TURTLE].count << endl;
-    cout << endl;
+    cout << "Animal exhibit count" << endl;
 
-    //new animals exhibit
-    cout << "New animals exhibit:" << endl;
-    cout << CAPACITY << exhibit_count[CUSTOM].capacity << endl;
-    cout << COUNT << exhibit_count[CUSTOM].count << endl;
+    //one block per registered species
+    for (int i=ZERO; i<num_exhibits; i++)
+    {
+        cout << endl;
+        cout << SpeciesRegistry::get(i).name << " exhibit:" << endl;
+        cout << CAPACITY << exhibit_count[i].capacity << endl;
+        cout << COUNT << exhibit_count[i].count << endl;
+    }
 
     menu.printBorder();
 }
@@ -1399,15 +2881,24 @@ void Zoo::printExhibitCount() const
  *              event to a file. Reads the event from the file, then
  *              prints the event to the screen.
 ** Params:   EventType event: the random event that occured.
- *              const Animal *animal: pointer to constant animal
- *              object that event happened to.
+ *              const AnimalRecord *animal: pointer to constant
+ *              animal record that event happened to.
  *              Default = nullptr.
  *           int todays_bonus: today's tiger bonus per tiger.
  *              Default = 0;
 ** Returns:  None
 *********************************************************************/
-void Zoo::writeRead(EventType event, const Animal *animal, int todays_bonus)
+void Zoo::writeRead(EventType event, const AnimalRecord *animal,
+                    int todays_bonus)
 {
+    AllocationTracker::Scope source(AllocationTracker::WRITE_READ);
+
+    //headless runs do not write or print event messages
+    if (headless)
+    {
+        return;
+    }
+
     std::ostringstream sstream; //used to format dollar amounts
     string message;
 
@@ -1422,7 +2913,7 @@ void Zoo::writeRead(EventType event, const Animal *animal, int todays_bonus)
 
             sstream << "Today.. a boom in zoo attendance occurred..";
 
-            if (tiger_bonus > 0)
+            if (tiger_bonus > Money())
             {
                 sstream << " you earned $";
                 sstream << todays_bonus;
@@ -1455,10 +2946,16 @@ void Zoo::writeRead(EventType event, const Animal *animal, int todays_bonus)
     }
 
     //write message to file
-    writeMessage(message);
+    {
+        PhaseTimer::Scope timer(PhaseTimer::EVENT_WRITE);
+        writeMessage(message);
+    }
 
     //read message from file to screen
-    readMessage();
+    {
+        PhaseTimer::Scope timer(PhaseTimer::EVENT_READ);
+        readMessage();
+    }
 }
 
 
@@ -1471,6 +2968,8 @@ void Zoo::writeRead(EventType event, const Animal *animal, int todays_bonus)
 *********************************************************************/
 void Zoo::writeMessage(const std::string &message)
 {
+    Tracer::Scope span("writeMessage", *this);
+
     //open output file stream
     fileOut.open(EVENT_FILE);
 
@@ -1493,6 +2992,7 @@ void Zoo::writeMessage(const std::string &message)
 *********************************************************************/
 void Zoo::readMessage()
 {
+    Tracer::Scope span("readMessage", *this);
     string message;
 
     //open input file for reading
@@ -34,37 +34,123 @@
 #include "MyRandom.hpp"
 #include "ValidateInput.hpp"
 #include "AnimalConstants.hpp"
-#include "Animal.hpp"
-#include "Tiger.hpp"
-#include "Penguin.hpp"
-#include "Turtle.hpp"
-#include "CustomAnimal.hpp"
+#include "AnimalRecord.hpp"
+#include "SpeciesRegistry.hpp"
+#include "Autosaver.hpp"
+#include "SnapshotWriter.hpp"
+#include "MappedArena.hpp"
+#include "Money.hpp"
+#include "SlotMap.hpp"
+#include "PhaseTimer.hpp"
+#include "Tracer.hpp"
+#include "AllocationTracker.hpp"
+#include "MemoryUsage.hpp"
+#include "ResponseTimer.hpp"
+#include "ProgressReporter.hpp"
 #include <iostream>
 #include <iomanip>
 #include <sstream>
 #include <fstream>
 #include <string>
 #include <vector>
-#include <algorithm> //for std::find
 
 class Zoo
 {
+public:
+    enum FeedType {CHEAP, GENERIC, PREMIUM};
+
+    //Automatic answers to the game's prompts, used for headless runs
+    struct Policy
+    {
+        FeedType feed_type;     //feed type used every day
+        int start_tigers;       //starting animals to buy, 1 or 2 each
+        int start_penguins;
+        int start_turtles;
+        int buy_type;           //species bought each day, -1 for none
+        int buy_min_bank;       //only buy when bank is above this amount
+    };
+
+    //Summary of a finished headless run
+    struct Outcome
+    {
+        int days;               //number of days the zoo was opened
+        bool bankrupt;          //true if the run ended in bankruptcy
+        Money bank_account;     //bank account at the end of the run
+        int64_t population;     //number of animals at the end of the run
+        bool overflowed;        //true if a count or amount was clamped
+    };
+
+    //Storage bytes per animal, split by what they are for. Records
+    // are the 4 bytes of an AnimalRecord, the rest of the total is the
+    // cost of growing exhibits. Handles are not part of keeping an
+    // animal, so they are counted apart from the total
+    struct BytesPerAnimal
+    {
+        double records;     //animal records in use
+        double unused;      //exhibit capacity grown but not filled
+        double index;       //age cohorts and groups
+        double total;       //all of the above
+        double handles;     //handle slots and their slot indexes
+    };
+
+    //Generic feed, one of each starting animal, never buy more
+    static const Policy DEFAULT_POLICY;
+    //Animals an exhibit can hold before it is kept as age cohorts
+    static const int COHORT_THRESHOLD_DEFAULT;
+
 private:
+    //Times the private hot paths directly
+    friend class Benchmark;
+    //Reads the day and population of each span
+    friend class Tracer;
+    //Splits the daily passes of a giant zoo between threads
+    friend class ScalingBenchmark;
+    //Checks the daily passes and exhibit order against every animal
+    friend class UnitTest;
+
     //Structures, enums, and constants
     //Keeps track of exhibit capacity and animal count for an exhibit
     struct Exhibit
     {
-        int capacity;
-        int count;
+        int64_t capacity;
+        int64_t count;
+        bool cohorts;       //true if kept as age cohorts, not animals
+    };
+
+    //Every animal of one age in an exhibit kept as age cohorts
+    struct AgeCohort
+    {
+        int age;            //age of the animals in days
+        int64_t count;      //animals of that age
+    };
+
+    //Memory an exhibit holds, split by what it is for
+    struct ExhibitBytes
+    {
+        int64_t animals;    //animal records in use
+        int64_t unused;     //animal records allocated but empty
+        int64_t index;      //age cohorts and groups
+        int64_t slots;      //slot indexes of its animals' handles
+        int64_t strings;    //names of its species
+    };
+
+    //Sub-exhibit of the new animals exhibit: a run of animals next to
+    // each other that share one set of interned traits
+    struct CustomGroup
+    {
+        SpeciesId species;  //interned traits shared by the group
+        int64_t start;      //index of the group's first animal
+        int64_t count;      //animals in the group
     };
 
-    enum FeedType {CHEAP, GENERIC, PREMIUM};
     //Random event types
     enum EventType {NOTHING, BOOM, BIRTH, SICKNESS};
     enum ExitReason {QUIT, BANKRUPT};
 
     //Start exhibit size for all exhibits is 10
     static const int START_EXHIBIT_SIZE;
+    //Factor a full exhibit's capacity grows by
+    static const int EXHIBIT_GROWTH_FACTOR;
     //Start bank account for the Zoo is $100,000
     static const int START_BANK_ACCOUNT;
     //Values for feed type multiplier lookup table
@@ -76,19 +162,52 @@ private:
     static const std::string EVENT_FILE;
 
     //Variables, and pointers to arrays
-    //Pointer to array of pointers to arrays of pointers to Animal objects
-    Animal ***animal_exhibits;
+    //Pointer to array of pointers to arrays of AnimalRecords, stored
+    // inline so an animal costs 4 bytes and exhibits scan contiguously
+    AnimalRecord **animal_exhibits;
     //Pointer to array of Exhibit structures to hold exhibit capacity and animal counts
     Exhibit *exhibit_count;
+    //Number of exhibits, one per registered species
+    int num_exhibits;
+    //Pointer to array of memory-mapped arenas holding each exhibit's
+    // array, nullptr when exhibits live on the heap
+    MappedArena **exhibit_arenas;
+    //Sub-exhibits of the new animals exhibit, in array order
+    std::vector<CustomGroup> custom_groups;
+    //Stable handles to animals someone asked for, and each exhibit's
+    // slot index for the animal at every position, so moved animals
+    // can be found. An exhibit's slot indexes are only kept once one
+    // of its animals has a handle, the others hold NO_HANDLE's index
+    SlotMap animal_handles;
+    std::vector<std::vector<uint32_t> > animal_slots;
+    //Exhibits tried by the current random pick, one flag each, kept
+    // so picking an animal does not allocate
+    std::vector<bool> exhibits_checked;
+    //Each exhibit's animals by age, oldest first, when it is too
+    // big to keep animal by animal, and the size it switches at
+    std::vector<std::vector<AgeCohort> > age_cohorts;
+    int cohort_threshold;
     Menu menu;
-    double bank_account;
-    double tiger_bonus;
+    Money bank_account;
+    Money tiger_bonus;
+    //True once an animal count clamped at its 64-bit limit. Set by
+    // getPopulation too, which is const
+    mutable bool overflowed;
     double food_cost_multiplier;
     double *feed_multiplier_lookup;
     bool exit_status;
     FeedType todays_feed_type;
     int day_counter;
 
+    //Headless runs answer prompts from policy and print nothing
+    bool headless;
+    Policy policy;
+    int horizon;
+    ExitReason exit_reason;
+
+    //Saves snapshots in the background, nullptr if autosave is off
+    Autosaver *autosaver;
+
     //file stream objects
     std::ifstream fileIn;
     std::ofstream fileOut;
@@ -107,6 +226,18 @@ public:
     Zoo();
 
 
+    /********************************************************************
+    ** Function: Constructor: Headless zoo. Seeds the random number
+     *          generator with the_seed so runs can be repeated, and
+     *          answers all prompts from the policy instead of asking
+     *          the user. Nothing is printed or written to file.
+    ** Params:  const Policy &policy: automatic answers to prompts.
+     *          unsigned int the_seed: seed for the random generator.
+    ** Returns: None
+    *********************************************************************/
+    Zoo(const Policy &policy, unsigned int the_seed);
+
+
     /********************************************************************
     ** Function: Destructor: Delete animal_exhibits arrays,
      *           exhibit_count array, and feed_multiplier_lookup array.
@@ -131,8 +262,233 @@ public:
     *********************************************************************/
     void start();
 
+
+    /********************************************************************
+    ** Function: simulate: Driver function for headless zoos. Buys the
+     *              policy's starting animals, then runs days until the
+     *              zoo goes bankrupt or the horizon is reached.
+    ** Params:  int horizon: maximum number of days to run.
+    ** Returns: Outcome: summary of how the run ended.
+    *********************************************************************/
+    Outcome simulate(int horizon);
+
+
+    /********************************************************************
+    ** Function: describePolicy: Formats every field of a policy on one
+     *              line, separated by spaces.
+    ** Params:  const Policy &policy: policy to describe.
+    ** Returns: string: the formatted policy.
+    *********************************************************************/
+    static std::string describePolicy(const Policy &policy);
+
+
+    /********************************************************************
+    ** Function: describeConstants: Formats every game constant that
+     *              can change the outcome of a run: every registered
+     *              species, starting bank account, and feed multipliers.
+     *              Two builds with the same string play out the same
+     *              seed and policy the same way.
+    ** Params:  None
+    ** Returns: string: the formatted constants.
+    *********************************************************************/
+    static std::string describeConstants();
+
+
+    /********************************************************************
+    ** Function: setAutosaver: Has autosaver save this zoo at the end
+     *              of every day it chooses to. The zoo does not own it.
+    ** Params:  Autosaver *autosaver: autosaver to use, or nullptr.
+    ** Returns: None
+    *********************************************************************/
+    void setAutosaver(Autosaver *autosaver);
+
+
+    /********************************************************************
+    ** Function: setCohortThreshold: Sets how many animals a registered
+     *              species' exhibit can hold before it is kept as age
+     *              cohorts instead. It goes back to single animals
+     *              below half as many. Outcomes are the same either way.
+    ** Params:  int animals: exhibit size to switch above.
+    ** Returns: None
+    *********************************************************************/
+    void setCohortThreshold(int animals);
+
+
+    /********************************************************************
+    ** Function: saveSnapshot: Writes the day, bank account, and every
+     *              animal in every exhibit to a file. New animals'
+     *              traits are written once per sub-exhibit.
+    ** Params:  const string &path: file to write.
+    ** Returns: long long: number of bytes written, or -1 on failure.
+    *********************************************************************/
+    long long saveSnapshot(const std::string &path) const;
+
+
+    /********************************************************************
+    ** Function: writeSnapshot: Writes what saveSnapshot saves with a
+     *              snapshot writer, without allocating, so a forked
+     *              child can write its copy of the zoo.
+    ** Params:  SnapshotWriter &snapshot: writer already started.
+    ** Returns: None
+    *********************************************************************/
+    void writeSnapshot(SnapshotWriter &snapshot) const;
+
+
+    /********************************************************************
+    ** Function: enableOutOfCore: Stores exhibits in memory-mapped files
+     *              in directory instead of on the heap, one file per
+     *              exhibit, so the zoo can grow past physical memory.
+     *              Must be called before any animals are added.
+    ** Params:  const string &directory: directory for exhibit files.
+    ** Returns: bool: true if every exhibit file was mapped.
+    *********************************************************************/
+    bool enableOutOfCore(const std::string &directory);
+
+
+    /********************************************************************
+    ** Function: isOutOfCore: Returns true if animals are stored in
+     *              memory-mapped files.
+    ** Params:  None
+    ** Returns: bool: true if out-of-core storage is enabled.
+    *********************************************************************/
+    bool isOutOfCore() const;
+
+
+    /********************************************************************
+    ** Function: getBytesPerAnimal: Returns bytes of exhibit storage
+     *              and age cohorts, counting unused capacity, for each
+     *              animal in the zoo, and bytes of animal handles apart
+     *              from them.
+    ** Params:  None
+    ** Returns: BytesPerAnimal: storage bytes per animal, split by
+     *              what they are for, all 0 if there are no animals.
+    *********************************************************************/
+    BytesPerAnimal getBytesPerAnimal() const;
+
+
+    /********************************************************************
+    ** Function: printMemoryReport: Prints the bytes each exhibit
+     *              holds for animal records in use, unused capacity,
+     *              indexes, and species names, the zoo's shared
+     *              tables, and the process's resident memory now and
+     *              at its peak. Prints even for headless zoos.
+    ** Params:  std::ostream &out: stream to print to.
+    ** Returns: None
+    *********************************************************************/
+    void printMemoryReport(std::ostream &out = std::cout) const;
+
+
+    /********************************************************************
+    ** Function: printAgeReport: Prints how many animals each exhibit
+     *              holds, how many are young, adults, and over a year
+     *              old, and the ages of its youngest and oldest
+     *              animals, from the age queries below.
+    ** Params:  std::ostream &out: stream to print to.
+    ** Returns: None
+    *********************************************************************/
+    void printAgeReport(std::ostream &out = std::cout) const;
+
+
+    /********************************************************************
+    ** Function: getHandle: Returns a stable handle to the animal at
+     *              index in an exhibit, oldest first for registered
+     *              species, giving it one the first time it is asked
+     *              for. Animals nobody asks about never cost a handle.
+     *              Switching the exhibit to age cohorts invalidates
+     *              every handle to its animals.
+    ** Params:  SpeciesId type: exhibit of the animal.
+     *          int64_t index: index of the animal in the exhibit.
+    ** Returns: SlotMap::Handle: handle to the animal, or NO_HANDLE if
+     *              there is no such animal or the exhibit is kept as
+     *              age cohorts.
+    *********************************************************************/
+    SlotMap::Handle getHandle(SpeciesId type, int64_t index);
+
+
+    /********************************************************************
+    ** Function: findAnimal: Looks up an animal by handle, wherever it
+     *              has moved to in its exhibit.
+    ** Params:  SlotMap::Handle handle: handle from getHandle.
+     *          AnimalRecord &animal: set to a copy of the animal.
+    ** Returns: bool: false if the animal has died, or its exhibit has
+     *              been kept as age cohorts since the handle was given.
+    *********************************************************************/
+    bool findAnimal(SlotMap::Handle handle, AnimalRecord &animal) const;
+
+
+    /********************************************************************
+    ** Function: countAdults: Counts the adults in an exhibit, with a
+     *              binary search for registered species' exhibits.
+    ** Params:  SpeciesId type: exhibit to count.
+    ** Returns: int64_t: number of animals 3 days old or older.
+    *********************************************************************/
+    int64_t countAdults(SpeciesId type) const;
+
+
+    /********************************************************************
+    ** Function: countOlderThan: Counts the animals in an exhibit older
+     *              than age, with a binary search for registered
+     *              species' exhibits.
+    ** Params:  SpeciesId type: exhibit to count.
+     *          int age: age in days the animals must be older than.
+    ** Returns: int64_t: number of animals older than age.
+    *********************************************************************/
+    int64_t countOlderThan(SpeciesId type, int age) const;
+
+
+    /********************************************************************
+    ** Function: countInAgeRange: Counts the animals in an exhibit from
+     *              min_age to max_age days old, inclusive.
+    ** Params:  SpeciesId type: exhibit to count.
+     *          int min_age: youngest age counted.
+     *          int max_age: oldest age counted.
+    ** Returns: int64_t: number of animals in the range.
+    *********************************************************************/
+    int64_t countInAgeRange(SpeciesId type, int min_age, int max_age) const;
+
+
+    /********************************************************************
+    ** Function: findOldest, findYoungest: Finds the oldest or youngest
+     *              animal in an exhibit. Registered species' exhibits
+     *              have them at either end.
+    ** Params:  SpeciesId type: exhibit to search.
+     *          AnimalRecord &animal: set to a copy of the animal.
+    ** Returns: bool: false if the exhibit is empty.
+    *********************************************************************/
+    bool findOldest(SpeciesId type, AnimalRecord &animal) const;
+    bool findYoungest(SpeciesId type, AnimalRecord &animal) const;
+
 private:
 
+    /********************************************************************
+    ** Function: initialize: Shared constructor setup. Initializes
+     *          feed_multiplier_lookup, food_cost_multiplier,
+     *          animal_exhibits, and exhibit_count, with one exhibit for
+     *          every registered species.
+    ** Params:  None
+    ** Returns: None
+    *********************************************************************/
+    void initialize();
+
+
+    /********************************************************************
+    ** Function: getPopulation: Counts all animals in every exhibit.
+    ** Params:  None
+    ** Returns: int: total number of animals in the zoo.
+    *********************************************************************/
+    int64_t getPopulation() const;
+
+
+    /********************************************************************
+    ** Function: hasOverflowed: Returns true if an animal count or the
+     *              bank account was clamped at a 64-bit limit, so the
+     *              zoo's totals are no longer exact.
+    ** Params:  None
+    ** Returns: bool: true if anything overflowed.
+    *********************************************************************/
+    bool hasOverflowed() const;
+
+
     /********************************************************************
     ** Function: runTycoon: Driver function to run the simulation for
      *              "each day" at the Zoo. Contains a while loop to run
@@ -245,35 +601,38 @@ private:
      *              birth, while keeping track of which animal exhibits
      *              are not able to give birth. Recursively calls itself
      *              until it has checked all animals for eligibility.
-    ** Params:  vector<AnimalType> &animals_checked: vector of animal
-     *              types to keep track of which exhibits have already
-     *              been checked.
-     *          Animal *& selected_animal: Reference to pointer to an
-     *              Animal instance to store the selected animal.
-     *          AnimalType &selected_type: Reference to AnimalType
+    ** Params:  vector<bool> &animals_checked: one flag per exhibit to
+     *              keep track of which exhibits have already been
+     *              checked.
+     *          int &num_checked: Reference to number of exhibits
+     *              already checked.
+     *          AnimalRecord &selected_animal: Reference to record to
+     *              store a copy of the selected animal.
+     *          SpeciesId &selected_type: Reference to SpeciesId
      *              variable to keep track of the type of animal selected.
      *          bool &animal_chosen: Reference to boolean to keep track
      *              if animal has been chosen.
     ** Returns: bool: true if eligible animal was selected, false if no
      *              animals were able to be selected.
     *********************************************************************/
-    bool pickAnimalToHaveBaby(std::vector<AnimalType> &animals_checked,
-                                Animal *&selected_animal,
-                                AnimalType &selected_type,
+    bool pickAnimalToHaveBaby(std::vector<bool> &animals_checked,
+                                int &num_checked,
+                                AnimalRecord &selected_animal,
+                                SpeciesId &selected_type,
                                 bool &animal_chosen);
 
 
     /********************************************************************
-    ** Function: giveBirth: An animal of specified type gives birth
-     *              according to how many babies their species produces
-     *              at a time. Write to file the event and read from
+    ** Function: giveBirth: An animal gives birth according to how many
+     *              babies their species produces at a time. Babies share
+     *              their parent's species ID, so custom traits are not
+     *              copied. Write to file the event and read from
      *              file the event, then print the event to the user.
-    ** Params:   AnimalType type: Type of animal to give birth.
-     *           const Animal *animal: Pointer to constant eligible
-     *           animal object to give birth.
+    ** Params:   AnimalRecord animal: copy of eligible animal to give
+     *           birth, since adding babies can move the exhibit array.
     ** Returns:  None
     *********************************************************************/
-    void giveBirth(AnimalType type, const Animal *animal);
+    void giveBirth(AnimalRecord animal);
 
 
     /********************************************************************
@@ -308,19 +667,22 @@ private:
      *              either give birth or get sick and die. Keeps track of
      *              which exhibits have been checked, and if an eligible
      *              animal has been found.
-    ** Params:  vector<AnimalType> &animals_checked: Reference to vector
-     *              of animal types to keep track of which animal
+    ** Params:  vector<bool> &animals_checked: Reference to vector
+     *              of one flag per exhibit to keep track of which animal
      *              exhibits have already been checked, as to prevent
      *              infinite loops due to random selection of animals.
-     *          AnimalType &selected_type: Reference to AnimalType
+     *          int &num_checked: Reference to number of exhibits
+     *              already checked.
+     *          SpeciesId &selected_type: Reference to SpeciesId
      *              variable denoting which animal type was randomly
      *              selected.
      *          bool &animal_chosen: Reference to boolean variable
      *              denoting if an eligible animal has been chosen.
     ** Returns: None
     *********************************************************************/
-    void checkAnimalsCount(std::vector<AnimalType> &animals_checked,
-                            AnimalType &selected_type,
+    void checkAnimalsCount(std::vector<bool> &animals_checked,
+                            int &num_checked,
+                            SpeciesId &selected_type,
                             bool &animal_chosen);
 
 
@@ -329,27 +691,25 @@ private:
      *              an animal type. Pick a random number
      *              between 0 to animal exhibit count - 1.
     ** Params:  None
-    ** Returns: int: randomly chosen number static_casted into AnimalType.
+    ** Returns: SpeciesId: randomly chosen exhibit.
      *              i.e. randomly chosen animal type.
     *********************************************************************/
-    AnimalType pickRandomAnimal() const;
+    SpeciesId pickRandomAnimal() const;
 
 
     /********************************************************************
     ** Function: removeAnimal: Randomly selects an animal from a specific
-     *              exhibit passed as an argument. Deletes randomly
-     *              selected animal in the exhibit. Shifts the rest of
-     *              the animal pointers in the animal's exhibit array
-     *              down to fill in the space of the deleted animal.
-     *              Deletes the pointer of the last animal in the exhibit,
-     *              because it is now duplicated (set the last pointer
-     *              to nullptr). Decreases exhibit count of that animal
+     *              exhibit passed as an argument. Removes randomly
+     *              selected animal in the exhibit and frees its handle.
+     *              One animal per younger age run (or per later new
+     *              animals sub-exhibit) moves to close the gap, so
+     *              nothing else shifts. Decreases exhibit count of that animal
      *              by 1. Write to file the event and read from
      *              file the event, then print the event to the user.
-    ** Params:  AnimalType selected_type: Type of animal to remove.
+    ** Params:  SpeciesId selected_type: Type of animal to remove.
     ** Returns: None
     *********************************************************************/
-    void removeAnimal(AnimalType selected_type);
+    void removeAnimal(SpeciesId selected_type);
 
 
     /********************************************************************
@@ -357,7 +717,7 @@ private:
      *              a new animal, adds them to the exhibit, subtracts
      *              their cost from the bank, then prints out a message
      *              saying that a new animal has been added.
-    ** Params:   AnimalType type: type of animal to add.
+    ** Params:   SpeciesId type: type of animal to add.
      *           Int age: age of animal to be added.
      *              Default = 0;
      *           Bool isBirth: boolean to denote if animal was added
@@ -366,87 +726,233 @@ private:
      *              Default = false.
     ** Returns: None
     *********************************************************************/
-    void addAnimal(AnimalType type, int age = ZERO, bool isBirth = false);
+    void addAnimal(SpeciesId type, int age = ZERO, bool isBirth = false);
 
 
     /********************************************************************
-    ** Function: addAnimal(overloaded): Overloaded version of addAnimal
-     *              specifically for creating new custom animals. Adds a
-     *              new animal to the exhibit by creating a new animal,
-     *              adds them to the exhibit, subtracts their cost from
-     *              the bank, then prints out a message saying a new
-     *              animal has been added.
-    ** Params:  AnimalType type: type of animal to add.
-     *          Int age: age of animal to be added.
-     *          const string& name: name of animal.
-     *          Int cost: cost of animal.
-     *          Int num_babies: number of babies the animal produces.
-     *          Int feeding_cost: cost to feed animal.
-     *          Int payoff: profit generated by animal.
-     *          Bool isBirth: boolean to denote if animal was added
-     *              by birth, if true, does not subtract the animal's
-     *              cost from the bank.
-     *              Default = false.
-    ** Returns: None
+    ** Function: makeAnimal: Creates a new animal record of specified
+     *              type at specified age.
+    ** Params:   SpeciesId type: type of animal to be created.
+     *           Int age: age of animal to be created.
+    ** Returns:  AnimalRecord: new animal created.
     *********************************************************************/
-    void addAnimal(AnimalType type, int age, const std::string &name,
-                    int cost, int num_babies, int feeding_cost,
-                        int payoff, bool isBirth = false);
+    AnimalRecord makeAnimal(SpeciesId type, int age) const;
 
 
     /********************************************************************
-    ** Function: makeAnimal: Creates a new animal of specified type at
-     *              specified age. Tigers, penguins, or turtles only.
-    ** Params:   AnimalType type: type of animal to be created.
-     *           Int age: age of animal to be created.
-    ** Returns:  Animal *: pointer to new animal created.
+    ** Function: isMapped: Returns true if an exhibit's array lives in
+     *              its mapped arena rather than on the heap.
+    ** Params:   SpeciesId type: exhibit to check.
+    ** Returns:  bool: true if the array is in the arena.
     *********************************************************************/
-    Animal *makeAnimal(AnimalType type, int age);
+    bool isMapped(SpeciesId type) const;
 
 
     /********************************************************************
-    ** Function: makeAnimal(overloaded): Overloaded version of makeAnimal
-     *              specifically for creating a new custom animal.
-     *              Creates a new animal of specified type at specified
-     *              age.
-    ** Params:   AnimalType type: type of animal to be created.
-     *           Int age: age of animal to be created.
-     *           const string& name: name of animal.
-     *           Int cost: cost of animal.
-     *           Int num_babies: number of babies the animal produces.
-     *           Int feeding_cost: cost to feed animal.
-     *           Int payoff: profit generated by animal.
-    ** Returns:  Animal *: pointer to new custom animal created.
-    *********************************************************************/
-    Animal *makeAnimal(AnimalType type, int age, const std::string &name,
-                        int cost, int num_babies, int feeding_cost,
-                            int payoff);
-    
+    ** Function: getExhibitBytes: Measures the memory an exhibit holds.
+     *              Unused capacity is what increaseExhibit grew it by
+     *              beyond its animals, or all of it for an exhibit kept
+     *              as age cohorts.
+    ** Params:   int exhibit: exhibit to measure.
+    ** Returns:  ExhibitBytes: its bytes, split by what they are for.
+    *********************************************************************/
+    ExhibitBytes getExhibitBytes(int exhibit) const;
+
+
+    /********************************************************************
+    ** Function: adviseSequentialScan: Hints to the kernel that every
+     *              mapped exhibit is about to be scanned front to back.
+    ** Params:   None
+    ** Returns:  None
+    *********************************************************************/
+    void adviseSequentialScan() const;
+
+
+    /********************************************************************
+    ** Function: addToExhibit: Copies new animal record into their
+     *              exhibit array, after every animal at least as old.
+     *              If exhibit is at capacity, increase the exhibit
+     *              size. Increase exhibit animal count by 1.
+    ** Params:   SpeciesId type: type of animal.
+     *           const AnimalRecord &animal: Reference to constant
+     *              record to be added to exhibit.
+    ** Returns:  None
+    *********************************************************************/
+    void addToExhibit(SpeciesId type, const AnimalRecord &animal);
+
+
+    /********************************************************************
+    ** Function: moveAnimal: Moves an animal to another index in its
+     *              exhibit, keeping its handle pointed at it if it
+     *              has one.
+    ** Params:   SpeciesId type: exhibit of the animal.
+     *           int64_t from: index the animal is at.
+     *           int64_t to: index to move it to, overwriting what is there.
+    ** Returns:  None
+    *********************************************************************/
+    void moveAnimal(SpeciesId type, int64_t from, int64_t to);
+
+
+    /********************************************************************
+    ** Function: isAgeSorted: Returns true if an exhibit is kept oldest
+     *              first. Every exhibit is, except new animals, which
+     *              are kept in sub-exhibits instead.
+    ** Params:   SpeciesId type: exhibit to check.
+    ** Returns:  bool: true if the exhibit is in age order.
+    *********************************************************************/
+    bool isAgeSorted(SpeciesId type) const;
+
+
+    /********************************************************************
+    ** Function: countAtLeast: Counts the animals at least age days old
+     *              among the first end animals of an exhibit. In an age
+     *              sorted exhibit that is also the index of the first
+     *              younger animal, found with a binary search. Age
+     *              cohorts are summed oldest first.
+    ** Params:   SpeciesId type: exhibit to count.
+     *           int age: youngest age counted.
+     *           int64_t end: number of animals at the front to look at.
+    ** Returns:  int64_t: number of animals at least age days old.
+    *********************************************************************/
+    int64_t countAtLeast(SpeciesId type, int age, int64_t end) const;
+
+
+    /********************************************************************
+    ** Function: makeRoomForAge: Opens a space in an age sorted exhibit
+     *              after every animal at least age days old. Each run
+     *              of younger animals of one age moves its first animal
+     *              to its end, so a newborn moves nothing. The exhibit
+     *              must have room for one more animal.
+    ** Params:   SpeciesId type: exhibit to add to.
+     *           int age: age of the new animal.
+    ** Returns:  int64_t: index to put the new animal.
+    *********************************************************************/
+    int64_t makeRoomForAge(SpeciesId type, int age);
+
+
+    /********************************************************************
+    ** Function: closeAgeGap: Fills the gap left by the animal at index
+     *              in an age sorted exhibit. The last animal of its age
+     *              moves into the gap, then each younger run moves its
+     *              last animal into the gap before it, keeping the
+     *              exhibit in order. The exhibit count is not changed.
+    ** Params:   SpeciesId type: exhibit the animal is removed from.
+     *           int64_t index: index of the removed animal.
+    ** Returns:  None
+    *********************************************************************/
+    void closeAgeGap(SpeciesId type, int64_t index);
+
 
     /********************************************************************
-    ** Function: addToExhibit: Adds new animal pointer into their exhibit
-     *              array. If exhibit is at capacity, increase the
-     *              exhibit size. Increase exhibit animal count by 1.
-    ** Params:   AnimalType type: type of animal.
-     *           Animal *&animal_ptr: Reference to pointer to
-     *              Animal to be added to exhibit.
+    ** Function: makeRoomInGroup: Opens a space at the end of the new
+     *              animals sub-exhibit for traits, making the group if
+     *              it is the first of its kind. Each later group moves
+     *              its first animal to its end to make room, so only
+     *              one animal per group moves. The exhibit must have
+     *              room for one more animal.
+    ** Params:   SpeciesId traits: interned traits of the new animal.
+    ** Returns:  int64_t: index in the new animals exhibit to put it.
+    *********************************************************************/
+    int64_t makeRoomInGroup(SpeciesId traits);
+
+
+    /********************************************************************
+    ** Function: removeFromGroup: Fills the gap left by the animal at
+     *              index with the last animal of its sub-exhibit, then
+     *              each later group moves its last animal into the gap
+     *              before it, so only one animal per group moves.
+     *              Empty groups are dropped.
+    ** Params:   int64_t index: index of the removed animal.
     ** Returns:  None
     *********************************************************************/
-    void addToExhibit(AnimalType type, Animal *&animal_ptr);
+    void removeFromGroup(int64_t index);
 
 
     /********************************************************************
-    ** Function: increaseExhibit: Increases exhibit capacity by a factor
-     *              of START_EXHIBIT_SIZE. All exhibits will be increased
-     *              by a size of 10 at a time. Creates a new dynamically
-     *              allocated array of animal pointers, copies the old
+    ** Function: increaseExhibit: Doubles exhibit capacity, or sets it
+     *              to START_EXHIBIT_SIZE if it is empty, so filling an
+     *              exhibit copies each animal a constant number of times
+     *              on average. Creates a new dynamically
+     *              allocated array of animal records, copies the old
      *              array over, deletes the old array, and points the
-     *              old array pointer to the new array. Sets the exhibit
+     *              old array pointer to the new array. A mapped exhibit
+     *              grows its arena in place instead. Sets the exhibit
      *              capacity to the new value.
-    ** Params:   AnimalType type: type of exhibit to increase capacity.
+    ** Params:   SpeciesId type: type of exhibit to increase capacity.
+    ** Returns:  None
+    *********************************************************************/
+    void increaseExhibit(SpeciesId type);
+
+
+    /********************************************************************
+    ** Function: resizeExhibit: Sets an exhibit's capacity, growing a
+     *              mapped arena in place or copying the animals into a
+     *              new heap array. A capacity of 0 frees a heap array.
+    ** Params:   SpeciesId type: type of exhibit to resize.
+     *           int64_t new_capacity: animals it must hold, at least
+     *              its animal count.
+    ** Returns:  None
+    *********************************************************************/
+    void resizeExhibit(SpeciesId type, int64_t new_capacity);
+
+
+    /********************************************************************
+    ** Function: adaptExhibit: Switches a registered species' exhibit
+     *              to age cohorts once it holds more than the cohort
+     *              threshold, and back to single animals below half of
+     *              it. The new animals exhibit never switches.
+    ** Params:   SpeciesId type: exhibit that just changed size.
+    ** Returns:  None
+    *********************************************************************/
+    void adaptExhibit(SpeciesId type);
+
+
+    /********************************************************************
+    ** Function: switchToCohorts: Counts an age sorted exhibit's
+     *              animals by age, frees the heap array, and frees
+     *              the handles of any of its animals, which stop
+     *              finding them.
+    ** Params:   SpeciesId type: exhibit to switch.
     ** Returns:  None
     *********************************************************************/
-    void increaseExhibit(AnimalType type);
+    void switchToCohorts(SpeciesId type);
+
+
+    /********************************************************************
+    ** Function: switchToAnimals: Lays an exhibit's age cohorts back out
+     *              as single animals, oldest first, none of them with
+     *              a handle yet.
+    ** Params:   SpeciesId type: exhibit to switch.
+    ** Returns:  None
+    *********************************************************************/
+    void switchToAnimals(SpeciesId type);
+
+
+    /********************************************************************
+    ** Function: addToCohorts: Adds animals of one age to their age
+     *              cohort, starting a new cohort in age order if they
+     *              are the first of their age. Increase exhibit animal
+     *              count by the animals added.
+    ** Params:   SpeciesId type: exhibit kept as age cohorts.
+     *           int age: age of the animals.
+     *           int64_t count: animals to add.
+     *              Default = 1.
+    ** Returns:  None
+    *********************************************************************/
+    void addToCohorts(SpeciesId type, int age, int64_t count = 1);
+
+
+    /********************************************************************
+    ** Function: removeFromCohorts: Removes the animal that would be at
+     *              index if the exhibit were laid out oldest first, so
+     *              a random index picks an age weighted by its cohort.
+     *              Empty cohorts are dropped. The exhibit count is not
+     *              changed.
+    ** Params:   SpeciesId type: exhibit kept as age cohorts.
+     *           int64_t index: index of the animal, oldest first.
+    ** Returns:  AnimalRecord: copy of the removed animal.
+    *********************************************************************/
+    AnimalRecord removeFromCohorts(SpeciesId type, int64_t index);
 
 
     /********************************************************************
@@ -458,6 +964,18 @@ private:
     void increaseAnimalsAge();
 
 
+    /********************************************************************
+    ** Function: increaseAnimalsAgeShare: Increases age of one share of
+     *              the animals in the Zoo by 1 day. The shares split every
+     *              exhibit's age cohorts and animals into runs that do
+     *              not overlap, so threads can age a share each.
+    ** Params:   int share: share to age, from 0 to shares - 1.
+     *           int shares: shares the animals are split into.
+    ** Returns:  None
+    *********************************************************************/
+    void increaseAnimalsAgeShare(int share, int shares);
+
+
     /********************************************************************
     ** Function: feedAllAnimals: Feeds all the animals in the Zoo.
      *              Subtracts their feeding cost times food cost
@@ -469,6 +987,16 @@ private:
     void feedAllAnimals();
 
 
+    /********************************************************************
+    ** Function: getFeedingCost: Adds up the feeding cost of the animals
+     *              in a range of exhibits, times food cost multiplier.
+    ** Params:   int first: first exhibit to feed.
+     *           int last: exhibit after the last one to feed.
+    ** Returns:  Money: feeding cost of the range.
+    *********************************************************************/
+    Money getFeedingCost(int first, int last) const;
+
+
     /********************************************************************
     ** Function: calculateAnimalProfits: Loops through the exhibits and
      *              adds all animal's payoffs to the bank, including
@@ -479,13 +1007,24 @@ private:
     void calculateAnimalProfits();
 
 
+    /********************************************************************
+    ** Function: getAnimalProfits: Adds up the payoffs of the animals in
+     *              a range of exhibits, without the tiger bonus.
+    ** Params:   int first: first exhibit to add up.
+     *           int last: exhibit after the last one to add up.
+    ** Returns:  Money: payoffs of the range.
+    *********************************************************************/
+    Money getAnimalProfits(int first, int last) const;
+
+
     /********************************************************************
     ** Function: printAnimalAdded: Prints out a message that a new
      *              animal was added to the exhibit.
-    ** Params:   const Animal *animal: Pointer to constant animal object.
+    ** Params:   const AnimalRecord &animal: Reference to constant
+     *           animal record.
     ** Returns:  None
     *********************************************************************/
-    void printAnimalAdded(const Animal *animal) const;
+    void printAnimalAdded(const AnimalRecord &animal) const;
 
 
     /********************************************************************
@@ -509,10 +1048,10 @@ private:
     /********************************************************************
     ** Function: printTodaysProfits: Prints out message that today's
      *              profits have been calculated.
-    ** Params:   Int profits: today's total profits.
+    ** Params:   const Money &profits: today's total profits.
     ** Returns:  None
     *********************************************************************/
-    void printTodaysProfits(int profits) const;
+    void printTodaysProfits(const Money &profits) const;
 
 
     /********************************************************************
@@ -558,19 +1097,19 @@ private:
     /********************************************************************
     ** Function: addToBank: Adds amount passed as argument to the Zoo's
      *              bank account.
-    ** Params:   double amount: amount of $ to add to the bank.
+    ** Params:   const Money &amount: amount of $ to add to the bank.
     ** Returns:  None
     *********************************************************************/
-    void addToBank(double amount);
+    void addToBank(const Money &amount);
 
 
     /********************************************************************
     ** Function: subFromBank: Subtracts amount passed as argument to
      *              the Zoo's bank account.
-    ** Params:   double amount: amount of $ to subtract from bank.
+    ** Params:   const Money &amount: amount of $ to subtract from bank.
     ** Returns:  None
     *********************************************************************/
-    void subFromBank(double amount);
+    void subFromBank(const Money &amount);
 
 
     /********************************************************************
@@ -639,14 +1178,14 @@ private:
      *              event to a file. Reads the event from the file, then
      *              prints the event to the screen.
     ** Params:   EventType event: the random event that occured.
-     *              const Animal *animal: pointer to constant animal
-     *              object that event happened to.
+     *              const AnimalRecord *animal: pointer to constant
+     *              animal record that event happened to.
      *              Default = nullptr.
      *           int todays_bonus: today's tiger bonus per tiger.
      *              Default = 0;
     ** Returns:  None
     *********************************************************************/
-    void writeRead(EventType event, const Animal *animal = nullptr,
+    void writeRead(EventType event, const AnimalRecord *animal = nullptr,
                     int todays_bonus = ZERO);
 
 
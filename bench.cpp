@@ -0,0 +1,146 @@
+/*********************************************************************
+** Program name: bench.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 4:00 AM
+** Description: Driver for the Zoo benchmark, built by make bench. It
+ *              times the Zoo's hot paths at populations of 10, 100,
+ *              ... up to the maximum, prints a table, and can write
+ *              the results as JSON. It fails if the ops leave a wrong
+ *              population, age, or bank account total. Given a baseline written by an
+ *              earlier run, it also prints how every result changed,
+ *              and fails if any got significantly slower, see
+ *              RegressionGate:
+ *
+ *              zoo_bench [--max POPULATION] [--json FILE]
+ *                  [--repeat N] [--baseline FILE] [--threshold PERCENT]
+ *
+ *              --repeat runs the whole suite N times, giving each
+ *              result N samples to test. --scaling runs the thread
+ *              scaling benchmark instead, on up to --threads threads,
+ *              see ScalingBenchmark:
+ *
+ *              zoo_bench --scaling [--threads N]
+*********************************************************************/
+
+
+#include "Benchmark.hpp"
+#include "RegressionGate.hpp"
+#include "ScalingBenchmark.hpp"
+#include <cstring>
+
+/********************************************************************
+** Function: printUsage: Prints command line usage to stderr.
+** Params:   const char *program: name the program was run as.
+** Returns:  None
+*********************************************************************/
+static void printUsage(const char *program)
+{
+    std::cerr << "Usage: " << program
+            << " [--max POPULATION] [--json FILE]"
+            << " [--repeat N] [--baseline FILE] [--threshold PERCENT]"
+            << std::endl;
+    std::cerr << "       " << program << " --scaling [--threads N]"
+            << std::endl;
+}
+
+
+int main(int argc, char *argv[])
+{
+    int max_population =
+            static_cast<int>(Benchmark::MAX_POPULATION_DEFAULT);
+    std::string json_file;
+    int repetitions = 1;
+    std::string baseline_file;
+    double threshold = RegressionGate::THRESHOLD_DEFAULT;
+    int threshold_percent;
+    bool scaling = false;
+    int max_threads = 0;
+
+    for (int i=1; i<argc; i++)
+    {
+        if (!std::strcmp(argv[i], "--max") && i+1 < argc
+                && ValidateInput::parseInteger(argv[i+1], max_population)
+                && max_population > ZERO)
+        {
+            i++;
+        }
+        else if (!std::strcmp(argv[i], "--json") && i+1 < argc)
+        {
+            json_file = argv[++i];
+        }
+        else if (!std::strcmp(argv[i], "--repeat") && i+1 < argc
+                && ValidateInput::parseInteger(argv[i+1], repetitions)
+                && repetitions > ZERO)
+        {
+            i++;
+        }
+        else if (!std::strcmp(argv[i], "--baseline") && i+1 < argc)
+        {
+            baseline_file = argv[++i];
+        }
+        else if (!std::strcmp(argv[i], "--threshold") && i+1 < argc
+                && ValidateInput::parseInteger(argv[i+1], threshold_percent)
+                && threshold_percent >= ZERO)
+        {
+            threshold = threshold_percent / 100.0;
+            i++;
+        }
+        else if (!std::strcmp(argv[i], "--scaling"))
+        {
+            scaling = true;
+        }
+        else if (!std::strcmp(argv[i], "--threads") && i+1 < argc
+                && ValidateInput::parseInteger(argv[i+1], max_threads)
+                && max_threads > ZERO)
+        {
+            i++;
+        }
+        else
+        {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (scaling)
+    {
+        ScalingBenchmark scaling_benchmark(max_threads);
+        scaling_benchmark.run();
+        scaling_benchmark.printReport();
+        return 0;
+    }
+
+    //read the baseline first, so a bad one fails before the long run
+    RegressionGate gate(threshold);
+    if (!baseline_file.empty() && !gate.loadBaseline(baseline_file))
+    {
+        return 1;
+    }
+
+    Benchmark benchmark(max_population, repetitions);
+    benchmark.run();
+    benchmark.printResults();
+    if (benchmark.getMismatchCount() > 0)
+    {
+        std::cerr << benchmark.getMismatchCount()
+                << " benchmark totals were wrong" << std::endl;
+        return 1;
+    }
+
+    if (!json_file.empty() && !benchmark.writeJson(json_file))
+    {
+        std::cerr << "Could not write " << json_file << std::endl;
+        return 1;
+    }
+
+    if (!baseline_file.empty())
+    {
+        std::cout << std::endl << "Compared with " << baseline_file
+                << ":" << std::endl;
+        gate.compare(benchmark.getResults());
+        gate.printTable();
+        return gate.getRegressionCount() > 0 ? 1 : 0;
+    }
+
+    return 0;
+}
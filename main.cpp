@@ -5,19 +5,703 @@
 ** Date: Apr 25, 2019 at 8:22 PM
 ** Description: Main is the driver function for the Zoo Tycoon Game.
  *              It instantiates the Zoo class, and runs the game via
- *              Zoo's start function.
+ *              Zoo's start function. With command line arguments it
+ *              runs headless simulations instead:
+ *
+ *              zoo [--autosave FILE] [--autosave-every DAYS]
+ *                  [--out-of-core DIRECTORY] [--species FILE]
+ *                  [--cohort-above N] [--phase-times] [--trace FILE]
+ *                  [--allocations] [--check-allocations]
+ *                  [--perf-counters] [--memory] [--ages]
+ *                  [--response-times]
+ *              zoo run SEED HORIZON [options]
+ *              zoo sweep FIRST_SEED NUM_SEEDS HORIZON [CHECKPOINT]
+ *                  [options]
+ *
+ *              options: [--feed cheap|generic|premium]
+ *                  [--buy none|SPECIES] [--buy-above N]
+ *                  [--start TIGERS PENGUINS TURTLES]
+ *                  [--cache DIRECTORY] [--cache-size MEGABYTES]
+ *                  [--autosave FILE] [--autosave-every DAYS]
+ *                  [--out-of-core DIRECTORY] [--species FILE]
+ *                  [--cohort-above N] [--phase-times] [--trace FILE]
+ *                  [--allocations] [--check-allocations]
+ *                  [--perf-counters] [--memory] [--ages]
+ *                  [--progress] [--progress-every SECONDS]
+ *
+ *              --species registers more species from FILE, see
+ *              SpeciesRegistry::load, and --buy takes any species name.
+ *              --cohort-above keeps exhibits of more than N animals
+ *              as age cohorts, see Zoo::setCohortThreshold.
+ *              --phase-times times each phase of every day and prints
+ *              the times on exit, or on SIGUSR1, see PhaseTimer.
+ *              --trace writes spans of the run to FILE as a Chrome
+ *              trace, see Tracer.
+ *              --allocations counts heap allocations by day phase
+ *              and source, see AllocationTracker, and
+ *              --check-allocations also fails if a day allocated for
+ *              anything but exhibit growth.
+ *              --perf-counters adds hardware counters to the phase
+ *              times, when the machine allows, see PerfCounters.
+ *              --memory prints the bytes each exhibit holds and the
+ *              resident memory of the process, see
+ *              Zoo::printMemoryReport. A sweep only prints the
+ *              resident memory.
+ *              --ages prints how many animals in each exhibit are
+ *              young, adults, and over a year old, and its youngest
+ *              and oldest ages, see Zoo::printAgeReport. A sweep does
+ *              not print it.
+ *              --response-times times how long each command of an
+ *              interactive game takes, from its input to the next
+ *              prompt, and prints the percentiles on exit, see
+ *              ResponseTimer.
+ *              --progress prints the share done, days per second,
+ *              population, and time left of a run or sweep to stderr
+ *              every 10 seconds, or every SECONDS with
+ *              --progress-every, see ProgressReporter.
 *********************************************************************/
 
 
 #include "Zoo.hpp"
+#include "Sweep.hpp"
+#include "ResultCache.hpp"
+#include <cstring>
 
-int main()
+//Settings shared by the headless commands
+struct Options
 {
+    Zoo::Policy policy;
+    std::string checkpoint_file;
+    std::string cache_directory;
+    long long cache_size;
+    std::string autosave_file;
+    int autosave_days;
+    std::string out_of_core_directory;
+    int cohort_threshold;
+    bool phase_times;
+    std::string trace_file;
+    bool allocations;
+    bool check_allocations;
+    bool perf_counters;
+    bool memory;
+    bool ages;
+    bool response_times;
+    bool progress;
+    int progress_seconds;
+    std::string species_file;
+    std::string buy_name;       //species to buy, resolved after loading
+};
+
+/********************************************************************
+** Function: printUsage: Prints command line usage to stderr.
+** Params:   const char *program: name the program was run as.
+** Returns:  None
+*********************************************************************/
+static void printUsage(const char *program)
+{
+    std::cerr << "Usage: " << program
+            << " [--autosave FILE] [--autosave-every DAYS]"
+            << " [--out-of-core DIRECTORY] [--species FILE]"
+            << " [--cohort-above N] [--phase-times] [--trace FILE]"
+            << " [--allocations] [--check-allocations]"
+            << " [--perf-counters] [--memory] [--ages]"
+            << " [--response-times]"
+            << std::endl
+            << "       " << program << " run SEED HORIZON [options]"
+            << std::endl
+            << "       " << program
+            << " sweep FIRST_SEED NUM_SEEDS HORIZON [CHECKPOINT] [options]"
+            << std::endl
+            << "Options: [--feed cheap|generic|premium]"
+            << " [--buy none|SPECIES] [--buy-above N]"
+            << " [--start TIGERS PENGUINS TURTLES]"
+            << " [--cache DIRECTORY] [--cache-size MEGABYTES]"
+            << " [--autosave FILE] [--autosave-every DAYS]"
+            << " [--out-of-core DIRECTORY] [--species FILE]"
+            << " [--cohort-above N] [--phase-times] [--trace FILE]"
+            << " [--allocations] [--check-allocations]"
+            << " [--perf-counters] [--memory] [--ages]"
+            << " [--progress] [--progress-every SECONDS]" << std::endl;
+}
+
+
+/********************************************************************
+** Function: parseNumber: Parses a non-negative integer argument.
+** Params:   const char *arg: argument to parse.
+ *           int &out_num: set to parsed value on success.
+** Returns:  bool: true if arg was a non-negative integer.
+*********************************************************************/
+static bool parseNumber(const char *arg, int &out_num)
+{
+    return ValidateInput::parseInteger(arg, out_num) && out_num >= ZERO;
+}
+
+
+/********************************************************************
+** Function: parsePolicyOption: Parses one policy option starting at
+ *           argv[index], advancing index past its values.
+** Params:   int argc, char *argv[]: command line arguments.
+ *           int &index: index of the option, moved to its last value.
+ *           Zoo::Policy &policy: policy to update.
+** Returns:  bool: true if the option was valid.
+*********************************************************************/
+static bool parsePolicyOption(int argc, char *argv[], int &index,
+                                Zoo::Policy &policy)
+{
+    const char *FEED_NAMES[] = {"cheap", "generic", "premium"};
+    const int NAMES_SIZE = 3;
+    const char *option = argv[index];
+
+    if (!std::strcmp(option, "--feed") && index+1 < argc)
+    {
+        index++;
+        for (int i=ZERO; i<NAMES_SIZE; i++)
+        {
+            if (!std::strcmp(argv[index], FEED_NAMES[i]))
+            {
+                policy.feed_type = static_cast<Zoo::FeedType>(i);
+                return true;
+            }
+        }
+    }
+    else if (!std::strcmp(option, "--buy-above") && index+1 < argc)
+    {
+        index++;
+        return parseNumber(argv[index], policy.buy_min_bank);
+    }
+    else if (!std::strcmp(option, "--start") && index+3 < argc)
+    {
+        index += 3;
+        return parseNumber(argv[index-2], policy.start_tigers)
+                && parseNumber(argv[index-1], policy.start_penguins)
+                && parseNumber(argv[index], policy.start_turtles);
+    }
+
+    return false;
+}
+
+
+/********************************************************************
+** Function: parseOptions: Parses the options of a headless command,
+ *           starting at argv[first]. Loads the species file, if one
+ *           was given, before looking up the species to buy.
+** Params:   int argc, char *argv[]: command line arguments.
+ *           int first: index of the first option.
+ *           bool allow_checkpoint: if a checkpoint file may be given.
+ *           Options &options: options to fill in.
+** Returns:  bool: true if every option was valid.
+*********************************************************************/
+static bool parseOptions(int argc, char *argv[], int first,
+                            bool allow_checkpoint, Options &options)
+{
+    const long long MEGABYTE = 1024 * 1024;
+
+    options.policy = Zoo::DEFAULT_POLICY;
+    options.cache_size = ResultCache::SIZE_LIMIT_DEFAULT;
+    options.autosave_days = Autosaver::EVERY_DAYS_DEFAULT;
+    options.cohort_threshold = Zoo::COHORT_THRESHOLD_DEFAULT;
+    options.phase_times = false;
+    options.allocations = false;
+    options.check_allocations = false;
+    options.perf_counters = false;
+    options.memory = false;
+    options.ages = false;
+    options.response_times = false;
+    options.progress = false;
+    options.progress_seconds = ProgressReporter::EVERY_SECONDS_DEFAULT;
+
+    for (int i=first; i<argc; i++)
+    {
+        if (std::strncmp(argv[i], "--", 2))
+        {
+            //the only positional option is a checkpoint file
+            if (!allow_checkpoint || !options.checkpoint_file.empty())
+            {
+                return false;
+            }
+            options.checkpoint_file = argv[i];
+        }
+        else if (!std::strcmp(argv[i], "--cache") && i+1 < argc)
+        {
+            options.cache_directory = argv[++i];
+        }
+        else if (!std::strcmp(argv[i], "--cache-size") && i+1 < argc)
+        {
+            int megabytes;
+            if (!parseNumber(argv[++i], megabytes))
+            {
+                return false;
+            }
+            options.cache_size = megabytes * MEGABYTE;
+        }
+        else if (!std::strcmp(argv[i], "--autosave") && i+1 < argc)
+        {
+            options.autosave_file = argv[++i];
+        }
+        else if (!std::strcmp(argv[i], "--out-of-core") && i+1 < argc)
+        {
+            options.out_of_core_directory = argv[++i];
+        }
+        else if (!std::strcmp(argv[i], "--species") && i+1 < argc)
+        {
+            options.species_file = argv[++i];
+        }
+        else if (!std::strcmp(argv[i], "--buy") && i+1 < argc)
+        {
+            options.buy_name = argv[++i];
+        }
+        else if (!std::strcmp(argv[i], "--autosave-every") && i+1 < argc)
+        {
+            if (!parseNumber(argv[++i], options.autosave_days))
+            {
+                return false;
+            }
+        }
+        else if (!std::strcmp(argv[i], "--progress-every") && i+1 < argc)
+        {
+            options.progress = true;
+            if (!parseNumber(argv[++i], options.progress_seconds)
+                    || options.progress_seconds == ZERO)
+            {
+                return false;
+            }
+        }
+        else if (!std::strcmp(argv[i], "--cohort-above") && i+1 < argc)
+        {
+            if (!parseNumber(argv[++i], options.cohort_threshold))
+            {
+                return false;
+            }
+        }
+        else if (!std::strcmp(argv[i], "--trace") && i+1 < argc)
+        {
+            options.trace_file = argv[++i];
+        }
+        else if (!std::strcmp(argv[i], "--allocations"))
+        {
+            options.allocations = true;
+        }
+        else if (!std::strcmp(argv[i], "--check-allocations"))
+        {
+            options.allocations = true;
+            options.check_allocations = true;
+        }
+        else if (!std::strcmp(argv[i], "--phase-times"))
+        {
+            options.phase_times = true;
+        }
+        else if (!std::strcmp(argv[i], "--response-times"))
+        {
+            options.response_times = true;
+        }
+        else if (!std::strcmp(argv[i], "--memory"))
+        {
+            options.memory = true;
+        }
+        else if (!std::strcmp(argv[i], "--ages"))
+        {
+            options.ages = true;
+        }
+        else if (!std::strcmp(argv[i], "--progress"))
+        {
+            options.progress = true;
+        }
+        else if (!std::strcmp(argv[i], "--perf-counters"))
+        {
+            options.phase_times = true;
+            options.perf_counters = true;
+        }
+        else if (!parsePolicyOption(argc, argv, i, options.policy))
+        {
+            return false;
+        }
+    }
+
+    //species must be registered before --buy can name one
+    if (!options.species_file.empty()
+            && !SpeciesRegistry::load(options.species_file))
+    {
+        return false;
+    }
+
+    if (!options.buy_name.empty() && options.buy_name != "none")
+    {
+        options.policy.buy_type = SpeciesRegistry::find(options.buy_name);
+        if (options.policy.buy_type < ZERO
+                || SpeciesRegistry::get(options.policy.buy_type).custom)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/********************************************************************
+** Function: setUpZoo: Applies storage and autosave options to a new
+ *           zoo, before any animals are added.
+** Params:   Zoo &zoo: zoo to set up.
+ *           const Options &options: parsed options.
+ *           Autosaver *&autosaver: set to a new autosaver if one was
+ *              asked for, caller deletes it.
+** Returns:  bool: false if out-of-core storage could not be set up.
+*********************************************************************/
+static bool setUpZoo(Zoo &zoo, const Options &options, Autosaver *&autosaver)
+{
+    if (!options.out_of_core_directory.empty()
+            && !zoo.enableOutOfCore(options.out_of_core_directory))
+    {
+        std::cerr << "Could not map exhibits in "
+                << options.out_of_core_directory << std::endl;
+        return false;
+    }
+
+    zoo.setCohortThreshold(options.cohort_threshold);
+
+    if (!options.autosave_file.empty())
+    {
+        autosaver = new Autosaver(options.autosave_file,
+                                    options.autosave_days);
+        zoo.setAutosaver(autosaver);
+    }
+
+    return true;
+}
+
+
+/********************************************************************
+** Function: startInstruments: Turns the phase timers on, with
+ *           SIGUSR1 printing them, if --phase-times was given, and
+ *           hardware counters too if --perf-counters was, tracing if
+ *           --trace was, allocation counting if either allocations
+ *           option was, and response timing if --response-times was.
+** Params:   const Options &options: parsed options.
+** Returns:  None
+*********************************************************************/
+static void startInstruments(const Options &options)
+{
+    if (options.allocations)
+    {
+        AllocationTracker::enable();
+    }
+
+    if (options.phase_times)
+    {
+        PhaseTimer::enable();
+        PhaseTimer::installSignalHandler();
+    }
+
+    if (options.perf_counters)
+    {
+        //the run goes on without them if none open
+        PerfCounters::open();
+        PerfCounters::printStatus();
+    }
+
+    if (!options.trace_file.empty())
+    {
+        Tracer::enable();
+    }
+
+    if (options.response_times)
+    {
+        ResponseTimer::enable();
+    }
+}
+
+
+/********************************************************************
+** Function: finishInstruments: Prints the phase times, response
+ *           times, and allocations, and writes the trace, if they
+ *           were asked for.
+** Params:   const Options &options: parsed options.
+** Returns:  bool: false if --check-allocations was given and a day
+ *              made a stray allocation.
+*********************************************************************/
+static bool finishInstruments(const Options &options)
+{
+    //stop counting, so printing below is not counted
+    AllocationTracker::enable(false);
+
+    if (options.phase_times)
+    {
+        PhaseTimer::print();
+    }
+
+    if (options.response_times)
+    {
+        ResponseTimer::print();
+    }
+
+    if (!options.trace_file.empty())
+    {
+        if (Tracer::writeJson(options.trace_file))
+        {
+            std::cout << "Trace spans: " << Tracer::getSpanCount()
+                    << " written to " << options.trace_file << std::endl;
+        }
+        else
+        {
+            std::cerr << "Could not write trace " << options.trace_file
+                    << std::endl;
+        }
+    }
+
+    if (options.allocations)
+    {
+        AllocationTracker::print();
+    }
+
+    if (options.check_allocations
+            && AllocationTracker::getAllocatingDays() > 0)
+    {
+        std::cerr << "Allocation check failed: "
+                << AllocationTracker::getAllocatingDays()
+                << " days allocated outside exhibit growth" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+
+/********************************************************************
+** Function: runOne: Runs the "run" command, a single headless
+ *           simulation, and prints its outcome.
+** Params:   int argc, char *argv[]: command line arguments.
+** Returns:  int: exit status.
+*********************************************************************/
+static int runOne(int argc, char *argv[])
+{
+    const int SEED_ARG = 2;
+    const int HORIZON_ARG = 3;
+    const int OPTIONS_ARG = 4;
+
+    Options options;
+    int seed;
+    int horizon;
+
+    if (argc < OPTIONS_ARG
+            || !parseNumber(argv[SEED_ARG], seed)
+            || !parseNumber(argv[HORIZON_ARG], horizon)
+            || !parseOptions(argc, argv, OPTIONS_ARG, false, options))
+    {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    startInstruments(options);
+    if (options.progress)
+    {
+        ProgressReporter::start(1, horizon, options.progress_seconds);
+    }
+
+    Zoo::Outcome outcome;
+    bool cached = false;
+    Zoo::BytesPerAnimal bytes_per_animal = {0, 0, 0, 0, 0};
+    ResultCache *cache = nullptr;
+    Autosaver *autosaver = nullptr;
+
+    if (!options.cache_directory.empty())
+    {
+        cache = new ResultCache(options.cache_directory, options.cache_size);
+        cached = cache->find(options.policy, seed, horizon, outcome);
+    }
+
+    if (!cached)
+    {
+        Zoo zoo(options.policy, seed);
+        if (!setUpZoo(zoo, options, autosaver))
+        {
+            delete cache;
+            return 1;
+        }
+
+        outcome = zoo.simulate(horizon);
+        bytes_per_animal = zoo.getBytesPerAnimal();
+        if (options.memory)
+        {
+            zoo.printMemoryReport();
+        }
+        if (options.ages)
+        {
+            zoo.printAgeReport();
+        }
+
+        if (cache)
+        {
+            cache->store(options.policy, seed, horizon, outcome);
+        }
+    }
+    ProgressReporter::runFinished();
+    ProgressReporter::stop();
+
+    std::cout << std::fixed << std::setprecision(2)
+            << "Days opened: " << outcome.days << std::endl
+            << "Bankrupt: " << (outcome.bankrupt ? "yes" : "no") << std::endl
+            << "Final bank account: $" << outcome.bank_account << std::endl
+            << "Final population: " << outcome.population << std::endl
+            << "Cached: " << (cached ? "yes" : "no") << std::endl;
+
+    //only shown when it happened, so normal outcomes stay the same
+    if (outcome.overflowed)
+    {
+        std::cout << "Overflowed: yes, totals clamped at 64-bit limits"
+                << std::endl;
+    }
+
+    //storage is only measured when the zoo was actually simulated
+    if (!cached)
+    {
+        //an animal record is 4 bytes, the rest is growth and cohorts,
+        // handles are not part of storing an animal
+        std::cout << "Bytes per animal: " << bytes_per_animal.total
+                << " (records " << bytes_per_animal.records
+                << ", unused capacity " << bytes_per_animal.unused
+                << ", index " << bytes_per_animal.index
+                << "), plus handles " << bytes_per_animal.handles
+                << std::endl;
+    }
+
+    if (autosaver)
+    {
+        autosaver->finish();
+        autosaver->printStats();
+        delete autosaver;
+        autosaver = nullptr;
+    }
+
+    delete cache;
+    cache = nullptr;
+
+    return finishInstruments(options) ? 0 : 1;
+}
+
+
+/********************************************************************
+** Function: runSweep: Runs the "sweep" command.
+** Params:   int argc, char *argv[]: command line arguments.
+** Returns:  int: exit status.
+*********************************************************************/
+static int runSweep(int argc, char *argv[])
+{
+    const int FIRST_SEED_ARG = 2;
+    const int NUM_SEEDS_ARG = 3;
+    const int HORIZON_ARG = 4;
+    const int OPTIONS_ARG = 5;
+
+    Options options;
+    int first_seed;
+    int num_seeds;
+    int horizon;
+
+    if (argc < OPTIONS_ARG
+            || !parseNumber(argv[FIRST_SEED_ARG], first_seed)
+            || !parseNumber(argv[NUM_SEEDS_ARG], num_seeds)
+            || !parseNumber(argv[HORIZON_ARG], horizon)
+            || !parseOptions(argc, argv, OPTIONS_ARG, true, options))
+    {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    startInstruments(options);
+
+    Sweep sweep(options.policy, horizon, first_seed, num_seeds,
+                options.checkpoint_file);
+
+    ResultCache *cache = nullptr;
+    if (!options.cache_directory.empty())
+    {
+        cache = new ResultCache(options.cache_directory, options.cache_size);
+        sweep.setCache(cache);
+    }
+
+    if (options.progress)
+    {
+        ProgressReporter::start(num_seeds, horizon, options.progress_seconds);
+    }
+    bool finished = sweep.run();
+    ProgressReporter::stop();
+    sweep.printSummary();
+    if (options.memory)
+    {
+        MemoryUsage::print();
+    }
+
+    if (cache)
+    {
+        std::cout << "Cache hits: " << cache->getHits()
+                << ", misses: " << cache->getMisses() << std::endl;
+        delete cache;
+        cache = nullptr;
+    }
+
+    bool checks_passed = finishInstruments(options);
+
+    return finished && checks_passed ? 0 : 1;
+}
+
+
+int main(int argc, char *argv[])
+{
+    if (argc > 1)
+    {
+        if (!std::strcmp(argv[1], "run"))
+        {
+            return runOne(argc, argv);
+        }
+        if (!std::strcmp(argv[1], "sweep"))
+        {
+            return runSweep(argc, argv);
+        }
+
+        if (std::strncmp(argv[1], "--", 2))
+        {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    //Options for interactive games, only autosave, storage, and
+    // species apply
+    Options options;
+    if (!parseOptions(argc, argv, 1, false, options))
+    {
+        printUsage(argv[0]);
+        return 1;
+    }
+
+    startInstruments(options);
+
     //Create zoo instance
     Zoo zoo;
 
+    Autosaver *autosaver = nullptr;
+    if (!setUpZoo(zoo, options, autosaver))
+    {
+        return 1;
+    }
+
     //Start the game
     zoo.start();
+    if (options.memory)
+    {
+        zoo.printMemoryReport();
+    }
+    if (options.ages)
+    {
+        zoo.printAgeReport();
+    }
+
+    if (autosaver)
+    {
+        autosaver->finish();
+        autosaver->printStats();
+        delete autosaver;
+        autosaver = nullptr;
+    }
 
-    return 0;
-}
\ No newline at end of file
+    return finishInstruments(options) ? 0 : 1;
+}
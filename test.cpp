@@ -0,0 +1,21 @@
+/*********************************************************************
+** Program name: test.cpp
+** Author: Huy Nguyen <nguyehu6@oregonstate.edu>
+** Date: Oct 19, 2026 at 11:30 AM
+** Description: Driver for the unit tests, built and run by make
+ *              test. It runs every check in UnitTest and fails if
+ *              any of them does:
+ *
+ *              zoo_test
+*********************************************************************/
+
+
+#include "UnitTest.hpp"
+
+int main()
+{
+    UnitTest tests;
+    tests.run();
+
+    return tests.getFailureCount() > 0 ? 1 : 0;
+}